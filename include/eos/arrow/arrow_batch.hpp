@@ -0,0 +1,140 @@
+#pragma once
+
+#include <arrow/api.h>
+#include <arrow/util/bitmap_ops.h>
+
+#include <cstdint>  // std::int64_t
+#include <gsl/gsl>  // gsl::span
+#include <memory>   // std::shared_ptr
+
+#include "eos/cubic_eos/root_selection.hpp"
+#include "eos/viscosity/lucas_method.hpp"
+
+namespace eos {
+
+/// @brief Allocates float64 array data to be filled by batch functions
+/// @param[in] length Length of the array
+/// @param[in] pool Memory pool
+inline arrow::Result<std::shared_ptr<arrow::ArrayData>> make_double_array_data(
+    std::int64_t length,
+    arrow::MemoryPool *pool = arrow::default_memory_pool()) {
+  ARROW_ASSIGN_OR_RAISE(auto values,
+                        arrow::AllocateBuffer(length * sizeof(double), pool));
+  return arrow::ArrayData::Make(
+      arrow::float64(), length,
+      {nullptr, std::shared_ptr<arrow::Buffer>(std::move(values))}, 0);
+}
+
+namespace detail {
+
+/// @brief Returns values of an array without copy
+inline gsl::span<const double> values(const arrow::DoubleArray &x) noexcept {
+  return gsl::make_span(x.raw_values(), static_cast<std::size_t>(x.length()));
+}
+
+/// @brief Returns mutable values of array data without copy
+inline gsl::span<double> mutable_values(arrow::ArrayData &x) noexcept {
+  return gsl::make_span(x.GetMutableValues<double>(1),
+                        static_cast<std::size_t>(x.length));
+}
+
+/// @brief Checks an output and sets its validity bitmap from inputs
+/// @param[in] x First input
+/// @param[in] y Second input
+/// @param[in,out] out Preallocated float64 output
+/// @param[in] pool Memory pool for the validity bitmap
+///
+/// A value of the output is null if either of the input values is null.
+/// Values are computed even at null slots.
+inline arrow::Status prepare_output(const arrow::DoubleArray &x,
+                                    const arrow::DoubleArray &y,
+                                    arrow::ArrayData &out,
+                                    arrow::MemoryPool *pool) {
+  if (x.length() != y.length() || out.length != x.length()) {
+    return arrow::Status::Invalid("Lengths of arrays are different");
+  }
+  const auto size =
+      (out.offset + out.length) * static_cast<std::int64_t>(sizeof(double));
+  if (!out.type || out.type->id() != arrow::Type::DOUBLE ||
+      out.buffers.size() != 2 || !out.buffers[1] ||
+      !out.buffers[1]->is_mutable() || out.buffers[1]->size() < size) {
+    return arrow::Status::Invalid("Output must be a mutable float64 array");
+  }
+
+  if (x.null_count() == 0 && y.null_count() == 0) {
+    out.buffers[0] = nullptr;
+    out.null_count = 0;
+    return arrow::Status::OK();
+  }
+
+  // An input without nulls is replaced by the other one
+  const auto &a = x.null_count() > 0 ? x : y;
+  const auto &b = y.null_count() > 0 ? y : x;
+  ARROW_ASSIGN_OR_RAISE(
+      out.buffers[0],
+      arrow::internal::BitmapAnd(pool, a.null_bitmap_data(), a.offset(),
+                                 b.null_bitmap_data(), b.offset(), x.length(),
+                                 out.offset));
+  out.null_count = arrow::kUnknownNullCount;
+  return arrow::Status::OK();
+}
+
+}  // namespace detail
+
+/// @brief Computes Z-factors on Arrow memory
+/// @param[in] eos Cubic EoS
+/// @param[in] p Pressures
+/// @param[in] t Temperatures
+/// @param[in] selection Selection of a root
+/// @param[out] z Preallocated float64 array data of Z-factors
+/// @param[in] pool Memory pool for the validity bitmap
+///
+/// Values are read from and written to Arrow buffers without copy.
+template <typename CubicEos>
+arrow::Status zfactor(const CubicEos &eos, const arrow::DoubleArray &p,
+                      const arrow::DoubleArray &t, root_selection selection,
+                      arrow::ArrayData &z,
+                      arrow::MemoryPool *pool = arrow::default_memory_pool()) {
+  ARROW_RETURN_NOT_OK(detail::prepare_output(p, t, z, pool));
+  eos.zfactor(detail::values(p), detail::values(t), detail::mutable_values(z),
+              selection);
+  return arrow::Status::OK();
+}
+
+/// @brief Computes natural logarithms of fugacity coefficients on Arrow
+/// memory
+/// @param[in] eos Cubic EoS
+/// @param[in] p Pressures
+/// @param[in] t Temperatures
+/// @param[in] selection Selection of a root
+/// @param[out] ln_phi Preallocated float64 array data
+/// @param[in] pool Memory pool for the validity bitmap
+template <typename CubicEos>
+arrow::Status ln_fugacity_coeff(
+    const CubicEos &eos, const arrow::DoubleArray &p,
+    const arrow::DoubleArray &t, root_selection selection,
+    arrow::ArrayData &ln_phi,
+    arrow::MemoryPool *pool = arrow::default_memory_pool()) {
+  ARROW_RETURN_NOT_OK(detail::prepare_output(p, t, ln_phi, pool));
+  eos.ln_fugacity_coeff(detail::values(p), detail::values(t),
+                        detail::mutable_values(ln_phi), selection);
+  return arrow::Status::OK();
+}
+
+/// @brief Computes gas viscosities by Lucas' method on Arrow memory
+/// @param[in] lucas Lucas' method
+/// @param[in] p Pressures [Pa]
+/// @param[in] t Temperatures [K]
+/// @param[out] mu Preallocated float64 array data of viscosities [Pa-s]
+/// @param[in] pool Memory pool for the validity bitmap
+inline arrow::Status viscosity(
+    const lucas_method &lucas, const arrow::DoubleArray &p,
+    const arrow::DoubleArray &t, arrow::ArrayData &mu,
+    arrow::MemoryPool *pool = arrow::default_memory_pool()) {
+  ARROW_RETURN_NOT_OK(detail::prepare_output(p, t, mu, pool));
+  lucas.viscosity_at_high_pressure(detail::values(p), detail::values(t),
+                                   detail::mutable_values(mu));
+  return arrow::Status::OK();
+}
+
+}  // namespace eos
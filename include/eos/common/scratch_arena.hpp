@@ -0,0 +1,99 @@
+#pragma once
+
+#include <cstddef>      // std::size_t, std::max_align_t
+#include <gsl/gsl>      // gsl::span
+#include <memory>       // std::unique_ptr
+#include <type_traits>  // std::is_trivially_destructible_v
+#include <vector>       // std::vector
+
+namespace eos {
+
+/// @brief Bump allocator of temporary arrays
+///
+/// Arrays are allocated from a single block by advancing an offset, and
+/// released all at once when a scope is closed. Allocations exceeding the
+/// block are served by separate overflow blocks, which are freed when the
+/// scope of their allocation is closed. When the arena becomes empty, the
+/// main block grows to the peak usage. Once the main block has grown to
+/// the peak usage, allocations perform no heap allocation.
+///
+/// An arena must not be shared among threads. Use thread_scratch_arena() to
+/// obtain the arena of the calling thread.
+class scratch_arena {
+ public:
+  /// @brief Releases arrays allocated in its lifetime on destruction
+  class scope {
+   public:
+    explicit scope(scratch_arena& arena) noexcept
+        : arena_{arena},
+          offset_{arena.offset_},
+          used_{arena.used_},
+          overflow_{arena.overflow_.size()} {}
+    scope(const scope&) = delete;
+    scope& operator=(const scope&) = delete;
+    ~scope() { arena_.release(offset_, used_, overflow_); }
+
+   private:
+    scratch_arena& arena_;
+    std::size_t offset_;
+    std::size_t used_;
+    std::size_t overflow_;
+  };
+
+  /// @param[in] capacity Initial size of the main block in bytes
+  explicit scratch_arena(std::size_t capacity = 4096);
+  scratch_arena(const scratch_arena&) = delete;
+  scratch_arena(scratch_arena&&) = default;
+
+  ~scratch_arena();
+
+  scratch_arena& operator=(const scratch_arena&) = delete;
+  scratch_arena& operator=(scratch_arena&&) = default;
+
+  /// @brief Allocates an uninitialized array
+  /// @param[in] n Number of elements
+  template <typename T>
+  gsl::span<T> allocate(std::size_t n) {
+    static_assert(std::is_trivially_destructible_v<T>,
+                  "T must be trivially destructible");
+    static_assert(alignof(T) <= alignof(std::max_align_t),
+                  "T must not be over-aligned");
+    return gsl::make_span(
+        static_cast<T*>(this->allocate_bytes(n * sizeof(T), alignof(T))), n);
+  }
+
+  /// @brief Releases all the arrays and merges overflow blocks
+  void reset();
+
+  /// @brief Returns bytes in use
+  std::size_t used() const noexcept { return used_; }
+
+  /// @brief Returns the peak of bytes in use
+  std::size_t peak() const noexcept { return peak_; }
+
+  /// @brief Returns the size of the main block in bytes
+  std::size_t capacity() const noexcept { return capacity_; }
+
+  /// @brief Returns the number of overflow blocks in use
+  std::size_t overflow_blocks() const noexcept { return overflow_.size(); }
+
+  /// @brief Returns the number of heap allocations made by the arena
+  std::size_t heap_allocations() const noexcept { return heap_allocations_; }
+
+ private:
+  void* allocate_bytes(std::size_t size, std::size_t alignment);
+  void release(std::size_t offset, std::size_t used, std::size_t overflow);
+
+  std::unique_ptr<std::max_align_t[]> block_;
+  std::vector<std::unique_ptr<std::max_align_t[]>> overflow_;
+  std::size_t capacity_;
+  std::size_t offset_;
+  std::size_t used_;
+  std::size_t peak_;
+  std::size_t heap_allocations_;
+};
+
+/// @brief Returns the scratch arena of the calling thread
+scratch_arena& thread_scratch_arena();
+
+}  // namespace eos
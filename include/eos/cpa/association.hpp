@@ -0,0 +1,198 @@
+#pragma once
+
+#include <algorithm>  // std::max, std::swap
+#include <array>      // std::array
+#include <cassert>    // assert
+#include <cmath>      // std::fabs, std::sqrt
+#include <cstddef>    // std::size_t
+
+namespace eos {
+
+/// @brief Association scheme of Huang and Radosz
+enum class association_scheme {
+  one_a,    /// One self-associating site, e.g. organic acids
+  two_b,    /// One donor and one acceptor, e.g. alcohols
+  three_b,  /// Two donors and one acceptor, e.g. glycols
+  four_c    /// Two donors and two acceptors, e.g. water
+};
+
+/// @brief Types of association sites of a molecule
+///
+/// Sites of the same type have the same site fraction. All the bonded pairs
+/// of types share the association strength of a pure component.
+struct association_sites {
+  static constexpr std::size_t max_types = 4;
+
+  std::size_t num_types;                /// Number of site types
+  std::array<double, max_types> count;  /// Number of sites of each type
+  /// True if sites of two types form bonds
+  std::array<std::array<bool, max_types>, max_types> bond;
+};
+
+/// @brief Makes association sites of a scheme
+inline association_sites make_association_sites(association_scheme scheme) {
+  association_sites s{};
+  switch (scheme) {
+    case association_scheme::one_a:
+      s.num_types = 1;
+      s.count[0] = 1;
+      s.bond[0][0] = true;
+      break;
+    case association_scheme::two_b:
+    case association_scheme::three_b:
+    case association_scheme::four_c:
+      // Donors and acceptors
+      s.num_types = 2;
+      s.count[0] = scheme == association_scheme::two_b ? 1 : 2;
+      s.count[1] = scheme == association_scheme::four_c ? 2 : 1;
+      s.bond[0][1] = true;
+      s.bond[1][0] = true;
+      break;
+  }
+  return s;
+}
+
+namespace detail {
+
+/// @brief Solves a linear system in an augmented matrix by Gaussian
+/// elimination with partial pivoting
+/// @param[in,out] h Augmented matrix of n rows
+/// @param[in] n Size of the system
+/// @param[out] x Solution
+template <std::size_t N>
+void solve_augmented(std::array<std::array<double, N + 1>, N> &h,
+                     std::size_t n, std::array<double, N> &x) noexcept {
+  for (std::size_t j = 0; j < n; ++j) {
+    auto pivot = j;
+    for (auto k = j + 1; k < n; ++k) {
+      if (std::fabs(h[k][j]) > std::fabs(h[pivot][j])) {
+        pivot = k;
+      }
+    }
+    std::swap(h[j], h[pivot]);
+    for (auto k = j + 1; k < n; ++k) {
+      const auto r = h[k][j] / h[j][j];
+      for (auto l = j; l <= n; ++l) {
+        h[k][l] -= r * h[j][l];
+      }
+    }
+  }
+  for (auto j = n; j-- > 0;) {
+    auto s = h[j][n];
+    for (auto k = j + 1; k < n; ++k) {
+      s -= h[j][k] * x[k];
+    }
+    x[j] = s / h[j][j];
+  }
+}
+
+}  // namespace detail
+
+/// @brief Site fractions carried between calls to warm-start the solver
+struct association_state {
+  /// Fractions of sites not bonded of each type
+  std::array<double, association_sites::max_types> x;
+  bool valid = false;  /// True if x holds a solution of a previous call
+  int iterations = 0;  /// Accumulated number of Newton iterations
+};
+
+/// @brief Solves site fractions by Newton's method of Michelsen
+/// @param[in] sites Association sites
+/// @param[in] rho_delta Product of molar density and association strength
+/// @param[in,out] state Initial guess and solution of site fractions
+/// @param[in] tol Tolerance of the change of site fractions
+/// @param[in] maxiter Maximum iteration
+/// @return Number of iterations
+///
+/// Site fractions are the stationary point of
+/// \f[ Q = \sum_i m_i (\ln X_i - X_i + 1) - \frac{\rho \Delta}{2}
+/// \sum_i \sum_j m_i m_j X_i X_j, \f]
+/// where the second sum is over bonded pairs, and the analytic Hessian
+/// \f$ H_{ij} = -m_i / X_i^2 \delta_{ij} - \rho \Delta m_i m_j \f$ is used.
+/// A step leaving site fractions non-positive is replaced by a fifth of the
+/// current value. The analytic solution of a single type is used as the
+/// initial guess unless the state is valid.
+inline int solve_site_fractions(const association_sites &sites,
+                                double rho_delta, association_state &state,
+                                double tol = 1e-12, int maxiter = 50) noexcept {
+  constexpr auto max_types = association_sites::max_types;
+  const auto n = sites.num_types;
+  auto &x = state.x;
+  if (!state.valid) {
+    // Solution with all the sites bonded to a single type
+    double m = 0.0;
+    for (std::size_t i = 0; i < n; ++i) {
+      m = std::max(m, sites.count[i]);
+    }
+    const auto k = rho_delta * m;
+    const auto x0 = k > 0 ? 2 / (1 + std::sqrt(1 + 4 * k)) : 1.0;
+    x.fill(x0);
+  }
+
+  int iter = 0;
+  for (; iter < maxiter; ++iter) {
+    // Gradient and Hessian of Q
+    std::array<std::array<double, max_types + 1>, max_types> h;
+    for (std::size_t i = 0; i < n; ++i) {
+      const auto mi = sites.count[i];
+      double s = 0.0;
+      for (std::size_t j = 0; j < n; ++j) {
+        const auto hij =
+            sites.bond[i][j] ? rho_delta * mi * sites.count[j] : 0.0;
+        s += hij * x[j];
+        h[i][j] = -hij;
+      }
+      h[i][i] -= mi / (x[i] * x[i]);
+      h[i][n] = -(mi * (1 / x[i] - 1) - s);
+    }
+
+    std::array<double, max_types> dx;
+    detail::solve_augmented(h, n, dx);
+    double eps = 0.0;
+    for (std::size_t i = 0; i < n; ++i) {
+      const auto xi = x[i] + dx[i];
+      x[i] = xi > 0 ? xi : 0.2 * x[i];
+      eps = std::max(eps, std::fabs(dx[i]));
+    }
+    if (!(eps > tol)) {
+      ++iter;
+      break;
+    }
+  }
+  state.valid = true;
+  state.iterations += iter;
+  return iter;
+}
+
+/// @brief Computes derivatives of site fractions with respect to
+/// \f$ \rho \Delta \f$
+/// @param[in] sites Association sites
+/// @param[in] rho_delta Product of molar density and association strength
+/// @param[in] x Site fractions solved at rho_delta
+/// @param[out] dx Derivatives of site fractions
+///
+/// The derivatives are obtained by differentiating the stationarity
+/// condition, \f$ H \, \partial X / \partial (\rho \Delta) =
+/// -\partial g / \partial (\rho \Delta) \f$, where g is the gradient of Q.
+inline void site_fraction_derivatives(
+    const association_sites &sites, double rho_delta,
+    const std::array<double, association_sites::max_types> &x,
+    std::array<double, association_sites::max_types> &dx) noexcept {
+  constexpr auto max_types = association_sites::max_types;
+  const auto n = sites.num_types;
+  std::array<std::array<double, max_types + 1>, max_types> h;
+  for (std::size_t i = 0; i < n; ++i) {
+    const auto mi = sites.count[i];
+    double s = 0.0;
+    for (std::size_t j = 0; j < n; ++j) {
+      const auto bij = sites.bond[i][j] ? mi * sites.count[j] : 0.0;
+      s += bij * x[j];
+      h[i][j] = -rho_delta * bij;
+    }
+    h[i][i] -= mi / (x[i] * x[i]);
+    h[i][n] = s;
+  }
+  detail::solve_augmented(h, n, dx);
+}
+
+}  // namespace eos
@@ -0,0 +1,336 @@
+#pragma once
+
+#include <algorithm>  // std::clamp, std::min
+#include <cassert>    // assert
+#include <cmath>      // std::exp, std::fabs, std::log, std::sqrt
+#include <cstddef>    // std::size_t
+#include <gsl/gsl>    // gsl::span
+#include <utility>    // std::pair
+
+#include "eos/common/thermodynamic_constants.hpp"  // eos::gas_constant
+#include "eos/cpa/association.hpp"
+#include "eos/cubic_eos/flash_iteration_result.hpp"
+#include "eos/cubic_eos/root_selection.hpp"
+#include "eos/cubic_eos/soave_redlich_kwong_eos.hpp"
+
+namespace eos {
+
+/// @brief Properties of a phase computed by CPA EoS
+struct cpa_properties {
+  double z;                  /// Z-factor
+  double ln_fugacity_coeff;  /// Natural logarithm of fugacity coefficient
+  double density;            /// Molar density [mol/m3]
+};
+
+/// @brief State carried between calls of CPA EoS to warm-start solvers
+struct cpa_state {
+  association_state association;  /// Site fractions of the previous call
+  double liquid_density = 0.0;    /// Previous liquid density, zero if none
+};
+
+/// @brief Cubic-plus-association (CPA) EoS of a pure component
+///
+/// The physical term is Soave-Redlich-Kwong EoS, and the association term
+/// of Wertheim's theory uses the radial distribution function of simplified
+/// CPA, \f$ g = 1 / (1 - 1.9 \eta) \f$ with \f$ \eta = b \rho / 4 \f$:
+/// \f[ P = \frac{RT}{V - b} - \frac{a(T)}{V (V + b)} - \frac{RT}{2V}
+/// \left( 1 + \rho \frac{\partial \ln g}{\partial \rho} \right) \sum_i m_i
+/// (1 - X_i), \f]
+/// \f[ a(T) = a_0 \left( 1 + c_1 (1 - \sqrt{T_r}) \right)^2, \quad
+/// \Delta = g \left( \exp \frac{\epsilon}{RT} - 1 \right) b \beta. \f]
+///
+/// Molar volume is solved by Newton's method with the analytic derivative of
+/// pressure including that of site fractions, and site fractions are solved
+/// by solve_site_fractions() warm-started from the previous iteration.
+/// Functions taking cpa_state warm-start site fractions and liquid density
+/// from the previous call, and batch functions carry the state along points.
+class cpa_eos {
+ public:
+  cpa_eos() = default;
+  cpa_eos(const cpa_eos &) = default;
+  cpa_eos(cpa_eos &&) = default;
+
+  cpa_eos &operator=(const cpa_eos &) = default;
+  cpa_eos &operator=(cpa_eos &&) = default;
+
+  /// @brief Constructs CPA EoS
+  /// @param[in] tc Critical temperature [K]
+  /// @param[in] a0 Attraction parameter [Pa-m6/mol2]
+  /// @param[in] b Repulsion parameter [m3/mol]
+  /// @param[in] c1 Parameter of the temperature dependence of a
+  /// @param[in] epsilon Association energy [J/mol]
+  /// @param[in] beta Association volume
+  /// @param[in] scheme Association scheme
+  cpa_eos(double tc, double a0, double b, double c1, double epsilon,
+          double beta, association_scheme scheme)
+      : tc_{tc},
+        a0_{a0},
+        b_{b},
+        c1_{c1},
+        epsilon_{epsilon},
+        beta_{beta},
+        sites_{make_association_sites(scheme)} {}
+
+  /// @brief Computes attraction parameter
+  /// @param[in] t Temperature
+  double attraction_param(double t) const noexcept {
+    const auto x = 1 + c1_ * (1 - std::sqrt(t / tc_));
+    return a0_ * x * x;
+  }
+
+  /// @brief Computes association strength
+  /// @param[in] t Temperature
+  /// @param[in] rho Molar density
+  double association_strength(double t, double rho) const noexcept {
+    return this->radial_distribution(rho) * this->association_factor(t);
+  }
+
+  /// @brief Computes pressure
+  /// @param[in] t Temperature
+  /// @param[in] v Molar volume
+  /// @param[in,out] state Site fractions
+  double pressure(double t, double v, association_state &state) const
+      noexcept {
+    return this->evaluate(t, 1 / v, state).p;
+  }
+
+  /// @brief Computes pressure
+  /// @param[in] t Temperature
+  /// @param[in] v Molar volume
+  double pressure(double t, double v) const noexcept {
+    association_state state;
+    return this->pressure(t, v, state);
+  }
+
+  /// @brief Computes properties of a phase
+  /// @param[in] p Pressure
+  /// @param[in] t Temperature
+  /// @param[in] selection Selection of a root of density
+  /// @param[in,out] state State of the selected phase
+  cpa_properties properties(double p, double t, root_selection selection,
+                            cpa_state &state) const noexcept {
+    if (selection == root_selection::stable) {
+      auto vapor_state = state;
+      const auto liquid =
+          this->properties(p, t, root_selection::smallest, state);
+      const auto vapor =
+          this->properties(p, t, root_selection::largest, vapor_state);
+      if (vapor.ln_fugacity_coeff < liquid.ln_fugacity_coeff) {
+        state = vapor_state;
+        return vapor;
+      }
+      return liquid;
+    }
+
+    constexpr auto R = gas_constant<double>();
+    const auto rt = R * t;
+    auto rho = p / rt;
+    if (selection == root_selection::smallest) {
+      // Falls back to the vapor root if no liquid root is found
+      auto liquid_state = state.association;
+      rho = state.liquid_density > 0 ? std::min(state.liquid_density, 0.9 / b_)
+                                     : 0.9 / b_;
+      if (this->solve_density(p, true, t, liquid_state, rho)) {
+        state.association = liquid_state;
+        state.liquid_density = rho;
+      } else {
+        rho = p / rt;
+        this->solve_density(p, false, t, state.association, rho);
+      }
+    } else {
+      this->solve_density(p, false, t, state.association, rho);
+    }
+
+    const auto x = this->evaluate(t, rho, state.association);
+    const auto z = p / (rho * rt);
+    const auto a = this->attraction_param(t) * p / (rt * rt);
+    const auto b = b_ * p / rt;
+    return {z,
+            soave_redlich_kwong_eos::ln_fugacity_coeff(z, a, b) +
+                x.helmholtz,
+            rho};
+  }
+
+  /// @brief Computes Z-factor
+  /// @param[in] p Pressure
+  /// @param[in] t Temperature
+  /// @param[in] selection Selection of a root
+  double zfactor(double p, double t, root_selection selection) const
+      noexcept {
+    cpa_state state;
+    return this->properties(p, t, selection, state).z;
+  }
+
+  /// @brief Computes natural logarithm of fugacity coefficient
+  /// @param[in] p Pressure
+  /// @param[in] t Temperature
+  /// @param[in] selection Selection of a root
+  double ln_fugacity_coeff(double p, double t, root_selection selection) const
+      noexcept {
+    cpa_state state;
+    return this->properties(p, t, selection, state).ln_fugacity_coeff;
+  }
+
+  /// @brief Computes Z-factors at multiple points
+  /// @param[in] p Pressures
+  /// @param[in] t Temperatures
+  /// @param[out] z Z-factors
+  /// @param[in] selection Selection of a root
+  /// @param[in,out] state Site fractions carried along points
+  void zfactor(gsl::span<const double> p, gsl::span<const double> t,
+               gsl::span<double> z, root_selection selection,
+               cpa_state &state) const noexcept {
+    assert(p.size() == t.size() && p.size() == z.size());
+    for (std::size_t i = 0; i < p.size(); ++i) {
+      z[i] = this->properties(p[i], t[i], selection, state).z;
+    }
+  }
+
+  /// @brief Computes natural logarithms of fugacity coefficients at
+  /// multiple points
+  /// @param[in] p Pressures
+  /// @param[in] t Temperatures
+  /// @param[out] ln_phi Logarithms of fugacity coefficients
+  /// @param[in] selection Selection of a root
+  /// @param[in,out] state Site fractions carried along points
+  void ln_fugacity_coeff(gsl::span<const double> p, gsl::span<const double> t,
+                         gsl::span<double> ln_phi, root_selection selection,
+                         cpa_state &state) const noexcept {
+    assert(p.size() == t.size() && p.size() == ln_phi.size());
+    for (std::size_t i = 0; i < p.size(); ++i) {
+      ln_phi[i] =
+          this->properties(p[i], t[i], selection, state).ln_fugacity_coeff;
+    }
+  }
+
+  /// @brief Computes vapor pressure by successive substitution
+  /// @param[in] p_init Initial pressure
+  /// @param[in] t Temperature
+  /// @param[in] tol Tolerance of the relative difference of fugacity
+  /// @param[in] maxiter Maximum iteration
+  /// @return A pair of vapor pressure and iteration report
+  std::pair<double, flash_iteration_result> vapor_pressure(
+      double p_init, double t, double tol = 1e-8, int maxiter = 100) const
+      noexcept {
+    cpa_state liquid_state, vapor_state;
+    auto p = p_init;
+    double eps = 1.0;
+    int iter = 0;
+    while (eps > tol && iter < maxiter) {
+      const auto liquid =
+          this->properties(p, t, root_selection::smallest, liquid_state);
+      const auto vapor =
+          this->properties(p, t, root_selection::largest, vapor_state);
+      if (!(liquid.density > (1 + 1e-6) * vapor.density)) {
+        return {0.0,
+                {eps, iter, flash_iteration_error::multiple_roots_not_found}};
+      }
+      const auto ratio =
+          std::exp(liquid.ln_fugacity_coeff - vapor.ln_fugacity_coeff);
+      eps = std::fabs(1 - ratio);
+      p *= ratio;
+      ++iter;
+    }
+    if (eps > tol) {
+      return {0.0, {eps, iter, flash_iteration_error::not_converged}};
+    }
+    return {p, {eps, iter, flash_iteration_error::success}};
+  }
+
+  double critical_temperature() const noexcept { return tc_; }
+  double repulsion_param() const noexcept { return b_; }
+  const association_sites &sites() const noexcept { return sites_; }
+
+ private:
+  /// @brief Pressure and related quantities at given density
+  struct density_point {
+    double p;          /// Pressure
+    double dpdrho;     /// Derivative of pressure with respect to density
+    double helmholtz;  /// Residual Helmholtz energy of association / RT
+  };
+
+  static constexpr double k_eta = 1.9 / 4;  /// Coefficient of g by b rho
+
+  double radial_distribution(double rho) const noexcept {
+    return 1 / (1 - k_eta * b_ * rho);
+  }
+
+  double association_factor(double t) const noexcept {
+    constexpr auto R = gas_constant<double>();
+    return (std::exp(epsilon_ / (R * t)) - 1) * b_ * beta_;
+  }
+
+  /// @brief Evaluates pressure and its derivative at given density
+  density_point evaluate(double t, double rho, association_state &state) const
+      noexcept {
+    constexpr auto R = gas_constant<double>();
+    const auto rt = R * t;
+    const auto v = 1 / rho;
+    const auto a = this->attraction_param(t);
+    const auto p_srk = soave_redlich_kwong_eos::pressure(t, v, a, b_);
+    const auto dp_srk =
+        -v * v * soave_redlich_kwong_eos::pressure_derivative(t, v, a, b_);
+
+    // 1 + rho d(ln g)/d(rho) equals g, and d(rho Delta)/d(rho) = F g^2
+    const auto g = this->radial_distribution(rho);
+    const auto f = this->association_factor(t);
+    const auto rho_delta = rho * g * f;
+    solve_site_fractions(sites_, rho_delta, state);
+    std::array<double, association_sites::max_types> dx;
+    site_fraction_derivatives(sites_, rho_delta, state.x, dx);
+
+    double s = 0.0, ds = 0.0, helmholtz = 0.0;
+    for (std::size_t i = 0; i < sites_.num_types; ++i) {
+      const auto m = sites_.count[i];
+      const auto x = state.x[i];
+      s += m * (1 - x);
+      ds -= m * dx[i] * f * g * g;
+      helmholtz += m * (std::log(x) - 0.5 * x + 0.5);
+    }
+    const auto z_assoc = -0.5 * g * s;
+    const auto dz_assoc = -0.5 * (k_eta * b_ * g * g * s + g * ds);
+    return {p_srk + rho * rt * z_assoc,
+            dp_srk + rt * (z_assoc + rho * dz_assoc), helmholtz};
+  }
+
+  /// @brief Solves density at given pressure by Newton's method
+  /// @param[in] p Pressure
+  /// @param[in] liquid True to search from the dense side
+  /// @param[in] t Temperature
+  /// @param[in,out] state Site fractions
+  /// @param[in,out] rho Initial guess and solution of density
+  /// @return True if converged to a mechanically stable root
+  bool solve_density(double p, bool liquid, double t,
+                     association_state &state, double &rho) const noexcept {
+    const auto rho_max = 1 / b_;
+    for (int iter = 0; iter < 100; ++iter) {
+      const auto x = this->evaluate(t, rho, state);
+      if (!(x.dpdrho > 0)) {
+        // Leaves the mechanically unstable region
+        rho = liquid ? 0.5 * (rho + rho_max) : 0.5 * rho;
+        continue;
+      }
+      const auto upper = 0.5 * (rho + rho_max);
+      const auto lower = 0.5 * rho;
+      const auto rho_new =
+          std::clamp(rho - (x.p - p) / x.dpdrho, lower,
+                     liquid ? upper : std::min(upper, 2 * rho));
+      const auto converged = std::fabs(rho_new - rho) < 1e-12 * rho;
+      rho = rho_new;
+      if (converged) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  double tc_;       /// Critical temperature
+  double a0_;       /// Attraction parameter
+  double b_;        /// Repulsion parameter
+  double c1_;       /// Parameter of the temperature dependence of a
+  double epsilon_;  /// Association energy
+  double beta_;     /// Association volume
+  association_sites sites_;
+};
+
+}  // namespace eos
@@ -1,10 +1,13 @@
 #pragma once
 
-#include <vector>  // std::vector
+#include <cassert>  // assert
+#include <gsl/gsl>  // gsl::span
+#include <vector>   // std::vector
 
 #include "eos/common/thermodynamic_constants.hpp"  // eos::gas_constant
 #include "eos/cubic_eos/isobaric_isothermal_state.hpp"
 #include "eos/cubic_eos/isothermal_line.hpp"
+#include "eos/cubic_eos/memoized_isobaric_isothermal_state.hpp"
 
 namespace eos {
 
@@ -76,6 +79,12 @@ class cubic_eos_crtp_base {
     bc_ = critical_repulsion_param(pc, tc);
   }
 
+  /// @brief Returns critical pressure
+  double critical_pressure() const noexcept { return pc_; }
+
+  /// @brief Returns critical temperature
+  double critical_temperature() const noexcept { return tc_; }
+
   /// @brief Computes reduced pressure
   /// @param[in] p Pressure
   double reduced_pressure(double p) const noexcept { return p / pc_; }
@@ -108,12 +117,18 @@ class cubic_eos_crtp_base {
 ///    - fugacity_coeff(z, ar, br)
 ///    - residual_enthalpy(z, t, ar, br, beta)
 ///    - residual_entropy(z, ar, br, beta)
+///    - attraction_term(z, ar, br)
+///    - derivatives(z, ar, br, beta, gamma)
+///    - pressure_derivative(t, v, a, b)
+///    - pressure_integral(t, v1, v2, a, b)
+///    - spinodal_quartic_eq(k)
 ///    - alpha(tr)
-///    - beta()
+///    - beta(tr)
+///    - gamma(tr)
 /// where t is temperature, v is volume, a is attraction parameter, b is
 /// repulsion parameter, ar is reduced attraction parameter, br is reduced
-/// repulsion parameter, z is z-factor, and beta is a temperature correction
-/// factor.
+/// repulsion parameter, z is z-factor, and beta and gamma are the first and
+/// second order temperature correction factors.
 ///
 /// cubic_eos_traits class specialized for each concrete EoS class must be
 /// defined in the detail namespace. cubic_eos_traits class must define the
@@ -151,7 +166,7 @@ class cubic_eos_base : public cubic_eos_crtp_base<Derived> {
   isothermal_line<Derived> create_isothermal_line(double t) const noexcept {
     const auto tr = this->reduced_temperature(t);
     const auto alpha = this->derived().alpha(tr);
-    return {t, alpha * ac_, bc_};
+    return {t, alpha * this->ac_, this->bc_};
   }
 
   /// @brief Creates isobaric-isothermal state
@@ -165,7 +180,17 @@ class cubic_eos_base : public cubic_eos_crtp_base<Derived> {
         this->derived().alpha(tr) * this->reduced_attraction_param(pr, tr);
     const auto br = this->reduced_repulsion_param(pr, tr);
     const auto beta = this->derived().beta(tr);
-    return {t, ar, br, beta};
+    const auto gamma = this->derived().gamma(tr);
+    return {p, t, ar, br, beta, gamma};
+  }
+
+  /// @brief Creates isobaric-isothermal state caching Z-factors and
+  /// logarithms
+  /// @param[in] p Pressure
+  /// @param[in] t Temperature
+  memoized_isobaric_isothermal_state<Derived, UseTemperatureCorrectionFactor>
+  create_memoized_isobaric_isothermal_state(double p, double t) const noexcept {
+    return {this->create_isobaric_isothermal_state(p, t)};
   }
 
   /// @brief Computes pressure at given temperature and volume
@@ -173,8 +198,8 @@ class cubic_eos_base : public cubic_eos_crtp_base<Derived> {
   /// @param[in] v Volume
   double pressure(double t, double v) const noexcept {
     const auto tr = this->reduced_temperature(t);
-    const auto a = this->derived().alpha(tr) * this->attraction_param();
-    const auto b = this->repulsion_param();
+    const auto a = this->derived().alpha(tr) * this->ac_;
+    const auto b = this->bc_;
     return Derived::pressure(t, v, a, b);
   }
 
@@ -185,6 +210,55 @@ class cubic_eos_base : public cubic_eos_crtp_base<Derived> {
   std::vector<double> zfactor(double p, double t) const noexcept {
     return this->create_isobaric_isothermal_state(p, t).zfactor();
   }
+
+  /// @brief Computes Z-factors at multiple points
+  /// @param[in] p Pressures
+  /// @param[in] t Temperatures
+  /// @param[out] z Z-factors
+  /// @param[in] selection Selection of a root
+  void zfactor(gsl::span<const double> p, gsl::span<const double> t,
+               gsl::span<double> z, root_selection selection) const noexcept {
+    assert(p.size() == t.size() && p.size() == z.size());
+    for (std::size_t i = 0; i < z.size(); ++i) {
+      z[i] = this->create_isobaric_isothermal_state(p[i], t[i])
+                 .zfactor(selection);
+    }
+  }
+
+  /// @brief Computes natural logarithms of fugacity coefficients at multiple
+  /// points
+  /// @param[in] p Pressures
+  /// @param[in] t Temperatures
+  /// @param[out] ln_phi Logarithms of fugacity coefficients
+  /// @param[in] selection Selection of a root
+  void ln_fugacity_coeff(gsl::span<const double> p, gsl::span<const double> t,
+                         gsl::span<double> ln_phi,
+                         root_selection selection) const noexcept {
+    assert(p.size() == t.size() && p.size() == ln_phi.size());
+    for (std::size_t i = 0; i < ln_phi.size(); ++i) {
+      const auto state = this->create_isobaric_isothermal_state(p[i], t[i]);
+      ln_phi[i] = state.ln_fugacity_coeff(state.zfactor(selection));
+    }
+  }
+
+  /// @brief Computes thermodynamic derivatives at multiple points
+  /// @param[in] p Pressures
+  /// @param[in] t Temperatures
+  /// @param[in] z Z-factors
+  /// @param[in] cp Ideal gas isobaric heat capacities [J/mol-K]
+  /// @param[in] mw Molecular weight [kg/kmol]
+  /// @param[out] d Thermodynamic derivatives
+  void derivatives(gsl::span<const double> p, gsl::span<const double> t,
+                   gsl::span<const double> z, gsl::span<const double> cp,
+                   double mw,
+                   gsl::span<thermodynamic_derivatives> d) const noexcept {
+    assert(p.size() == t.size() && p.size() == z.size() &&
+           p.size() == cp.size() && p.size() == d.size());
+    for (std::size_t i = 0; i < d.size(); ++i) {
+      d[i] = this->create_isobaric_isothermal_state(p[i], t[i])
+                 .derivatives(z[i], cp[i], mw);
+    }
+  }
 };
 
 template <typename Derived>
@@ -214,7 +288,7 @@ class cubic_eos_base<Derived, false> : public cubic_eos_crtp_base<Derived> {
   /// @brief Creates isothermal state
   /// @param[in] t Temperature
   isothermal_line<Derived> create_isothermal_line(double t) const noexcept {
-    return {t, ac_, bc_};
+    return {t, this->ac_, this->bc_};
   }
 
   /// @brief Creates isobaric-isothermal state
@@ -226,14 +300,23 @@ class cubic_eos_base<Derived, false> : public cubic_eos_crtp_base<Derived> {
     const auto tr = this->reduced_temperature(t);
     const auto ar = this->reduced_attraction_param(pr, tr);
     const auto br = this->reduced_repulsion_param(pr, tr);
-    return {t, ar, br};
+    return {p, t, ar, br};
+  }
+
+  /// @brief Creates isobaric-isothermal state caching Z-factors and
+  /// logarithms
+  /// @param[in] p Pressure
+  /// @param[in] t Temperature
+  memoized_isobaric_isothermal_state<Derived, false>
+  create_memoized_isobaric_isothermal_state(double p, double t) const noexcept {
+    return {this->create_isobaric_isothermal_state(p, t)};
   }
 
   /// @brief Computes pressure at given temperature and volume
   /// @param[in] t Temperature
   /// @param[in] v Volume
   double pressure(double t, double v) const noexcept {
-    return Derived::pressure(t, v, ac_, bc_);
+    return Derived::pressure(t, v, this->ac_, this->bc_);
   }
 
   /// @brief Computes Z-factor at given pressure and temperature
@@ -243,6 +326,55 @@ class cubic_eos_base<Derived, false> : public cubic_eos_crtp_base<Derived> {
   std::vector<double> zfactor(double p, double t) const noexcept {
     return this->create_isobaric_isothermal_state(p, t).zfactor();
   }
+
+  /// @brief Computes Z-factors at multiple points
+  /// @param[in] p Pressures
+  /// @param[in] t Temperatures
+  /// @param[out] z Z-factors
+  /// @param[in] selection Selection of a root
+  void zfactor(gsl::span<const double> p, gsl::span<const double> t,
+               gsl::span<double> z, root_selection selection) const noexcept {
+    assert(p.size() == t.size() && p.size() == z.size());
+    for (std::size_t i = 0; i < z.size(); ++i) {
+      z[i] = this->create_isobaric_isothermal_state(p[i], t[i])
+                 .zfactor(selection);
+    }
+  }
+
+  /// @brief Computes natural logarithms of fugacity coefficients at multiple
+  /// points
+  /// @param[in] p Pressures
+  /// @param[in] t Temperatures
+  /// @param[out] ln_phi Logarithms of fugacity coefficients
+  /// @param[in] selection Selection of a root
+  void ln_fugacity_coeff(gsl::span<const double> p, gsl::span<const double> t,
+                         gsl::span<double> ln_phi,
+                         root_selection selection) const noexcept {
+    assert(p.size() == t.size() && p.size() == ln_phi.size());
+    for (std::size_t i = 0; i < ln_phi.size(); ++i) {
+      const auto state = this->create_isobaric_isothermal_state(p[i], t[i]);
+      ln_phi[i] = state.ln_fugacity_coeff(state.zfactor(selection));
+    }
+  }
+
+  /// @brief Computes thermodynamic derivatives at multiple points
+  /// @param[in] p Pressures
+  /// @param[in] t Temperatures
+  /// @param[in] z Z-factors
+  /// @param[in] cp Ideal gas isobaric heat capacities [J/mol-K]
+  /// @param[in] mw Molecular weight [kg/kmol]
+  /// @param[out] d Thermodynamic derivatives
+  void derivatives(gsl::span<const double> p, gsl::span<const double> t,
+                   gsl::span<const double> z, gsl::span<const double> cp,
+                   double mw,
+                   gsl::span<thermodynamic_derivatives> d) const noexcept {
+    assert(p.size() == t.size() && p.size() == z.size() &&
+           p.size() == cp.size() && p.size() == d.size());
+    for (std::size_t i = 0; i < d.size(); ++i) {
+      d[i] = this->create_isobaric_isothermal_state(p[i], t[i])
+                 .derivatives(z[i], cp[i], mw);
+    }
+  }
 };
 
 }  // namespace eos
\ No newline at end of file
@@ -0,0 +1,18 @@
+#pragma once
+
+namespace eos {
+
+enum class flash_iteration_error {
+  success,
+  not_converged,
+  multiple_roots_not_found,
+  initial_guess_not_set,
+};
+
+struct flash_iteration_result {
+  double rsd;                   /// Relative residual
+  int iter;                     /// Iteration count
+  flash_iteration_error error;  /// Error code
+};
+
+}  // namespace eos
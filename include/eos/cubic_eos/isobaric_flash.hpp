@@ -0,0 +1,271 @@
+#pragma once
+
+#include <algorithm>  // std::min_element
+#include <array>      // std::array
+#include <cassert>    // assert
+#include <cmath>      // std::fabs, std::isinf
+#include <gsl/gsl>    // gsl::span
+#include <limits>     // std::numeric_limits
+#include <utility>    // std::make_pair
+
+#include "eos/cubic_eos/vapor_liquid_flash.hpp"
+#include "eos/ideal_gas/ideal_gas_heat_capacity.hpp"
+
+namespace eos {
+
+/// @brief Result of isobaric flash calculation
+///
+/// The vapor fraction of a single phase is zero for liquid and one for vapor.
+/// When a single phase is found without passing the saturation temperature,
+/// it is identified as liquid if \f$ V / b < 1.75 \f$.
+struct isobaric_flash_result {
+  double t;                       /// Temperature
+  double vapor_fraction;          /// Molar fraction of vapor phase
+  flash_iteration_result report;  /// Iteration report
+};
+
+/// @brief Pressure-enthalpy and pressure-entropy flash of a pure component
+/// @tparam CubicEos Cubic EoS
+///
+/// Temperature is solved by Newton's method with analytic derivatives,
+/// \f$ (\partial H / \partial T)_P = C_p \f$ and
+/// \f$ (\partial S / \partial T)_P = C_p / T \f$, where \f$ C_p \f$ is the sum
+/// of ideal gas and residual isobaric heat capacities. Newton steps leaving
+/// the bracket of the solution fall back to bisection. Once an iterate enters
+/// the three-root region, the saturation temperature is solved and the
+/// specified enthalpy (entropy) is compared with those of saturated liquid and
+/// vapor to detect the two-phase region.
+template <typename CubicEos>
+class isobaric_flash {
+ public:
+  isobaric_flash() = default;
+  isobaric_flash(const isobaric_flash &) = default;
+  isobaric_flash(isobaric_flash &&) = default;
+
+  isobaric_flash &operator=(const isobaric_flash &) = default;
+  isobaric_flash &operator=(isobaric_flash &&) = default;
+
+  /// @brief Constructs flash object
+  /// @param[in] eos EoS
+  /// @param[in] cp Ideal gas heat capacity
+  ///
+  /// The default values of tolerance and maxixum iteration are 1e-6 and 100,
+  /// respectively.
+  isobaric_flash(const CubicEos &eos, const ideal_gas_heat_capacity &cp)
+      : eos_{eos}, cp_{cp}, flash_{eos}, tol_{1e-6}, maxiter_{100} {}
+
+  /// @brief Constructs flash object
+  /// @param[in] eos EoS
+  /// @param[in] cp Ideal gas heat capacity
+  /// @param[in] tol Tolerance for the relative change of temperature
+  /// @param[in] maxiter Maximum iteration
+  isobaric_flash(const CubicEos &eos, const ideal_gas_heat_capacity &cp,
+                 double tol, int maxiter)
+      : eos_{eos},
+        cp_{cp},
+        flash_{eos, tol, maxiter},
+        tol_{tol},
+        maxiter_{maxiter} {}
+
+  /// @brief Computes temperature at given pressure and enthalpy
+  /// @param[in] p Pressure [Pa]
+  /// @param[in] h Molar enthalpy [J/mol]
+  /// @param[in] t_init Initial temperature [K]
+  isobaric_flash_result ph_flash(double p, double h,
+                                 double t_init) const noexcept {
+    return this->solve(
+        p, h, t_init, [this, p](const auto &state, double z, double t) {
+          const auto cp = cp_.isobaric_heat_capacity(t) +
+                          state.residual_isobaric_heat_capacity(z);
+          return std::make_pair(cp_.enthalpy(t) + state.residual_enthalpy(z),
+                                cp);
+        });
+  }
+
+  /// @brief Computes temperature at given pressure and entropy
+  /// @param[in] p Pressure [Pa]
+  /// @param[in] s Molar entropy [J/mol-K]
+  /// @param[in] t_init Initial temperature [K]
+  isobaric_flash_result ps_flash(double p, double s,
+                                 double t_init) const noexcept {
+    return this->solve(
+        p, s, t_init, [this, p](const auto &state, double z, double t) {
+          const auto cp = cp_.isobaric_heat_capacity(t) +
+                          state.residual_isobaric_heat_capacity(z);
+          return std::make_pair(cp_.entropy(p, t) + state.residual_entropy(z),
+                                cp / t);
+        });
+  }
+
+  /// @brief Computes temperatures at given pressures and enthalpies
+  /// @param[in] p Pressures [Pa]
+  /// @param[in] h Molar enthalpies [J/mol]
+  /// @param[in] t_init Initial temperatures [K]
+  /// @param[out] r Flash results
+  void ph_flash(gsl::span<const double> p, gsl::span<const double> h,
+                gsl::span<const double> t_init,
+                gsl::span<isobaric_flash_result> r) const noexcept {
+    assert(p.size() == h.size() && p.size() == t_init.size() &&
+           p.size() == r.size());
+    for (std::size_t i = 0; i < r.size(); ++i) {
+      r[i] = this->ph_flash(p[i], h[i], t_init[i]);
+    }
+  }
+
+  /// @brief Computes temperatures at given pressures and entropies
+  /// @param[in] p Pressures [Pa]
+  /// @param[in] s Molar entropies [J/mol-K]
+  /// @param[in] t_init Initial temperatures [K]
+  /// @param[out] r Flash results
+  void ps_flash(gsl::span<const double> p, gsl::span<const double> s,
+                gsl::span<const double> t_init,
+                gsl::span<isobaric_flash_result> r) const noexcept {
+    assert(p.size() == s.size() && p.size() == t_init.size() &&
+           p.size() == r.size());
+    for (std::size_t i = 0; i < r.size(); ++i) {
+      r[i] = this->ps_flash(p[i], s[i], t_init[i]);
+    }
+  }
+
+  double tolerance() const noexcept { return tol_; }
+  int maxIter() const noexcept { return maxiter_; }
+
+  void set_params(double tol, int maxiter) {
+    tol_ = tol;
+    maxiter_ = maxiter;
+    flash_.set_params(tol, maxiter);
+  }
+
+ private:
+  enum class phase_selection { stable, liquid, vapor };
+
+  /// @brief Selects a Z-factor from multiple roots
+  template <typename State>
+  static double select_zfactor(const State &state,
+                               const std::array<double, 3> &z, std::size_t n,
+                               phase_selection phase) noexcept {
+    switch (phase) {
+      case phase_selection::liquid:
+        return z[0];
+      case phase_selection::vapor:
+        return z[n - 1];
+      default:
+        // The root of the smallest Gibbs energy
+        return *std::min_element(
+            z.begin(), z.begin() + n, [&state](auto z1, auto z2) {
+              return state.ln_fugacity_coeff(z1) < state.ln_fugacity_coeff(z2);
+            });
+    }
+  }
+
+  /// @brief Solves temperature so that a property matches its specification
+  /// @param[in] p Pressure
+  /// @param[in] spec Specified value of the property
+  /// @param[in] t_init Initial temperature
+  /// @param[in] f Function returning the property and its temperature
+  /// derivative from state, Z-factor and temperature
+  template <typename Function>
+  isobaric_flash_result solve(double p, double spec, double t_init,
+                              Function &&f) const noexcept {
+    auto lo = 0.0;
+    auto hi = std::numeric_limits<double>::infinity();
+    auto phase = phase_selection::stable;
+    auto saturation_checked = false;
+    auto t = t_init;
+    double eps = 1.0;
+    int iter = 0;
+
+    while (eps > tol_ && iter < maxiter_) {
+      const auto state = eos_.create_isobaric_isothermal_state(p, t);
+      std::array<double, 3> z;
+      const auto n = state.zfactor(z);
+
+      if (n > 1 && !saturation_checked) {
+        saturation_checked = true;
+        const auto [tsat, result] = flash_.saturation_temperature(t, p);
+        if (result.error == flash_iteration_error::success) {
+          const auto sat = eos_.create_isobaric_isothermal_state(p, tsat);
+          std::array<double, 3> zsat;
+          const auto nsat = sat.zfactor(zsat);
+          const auto fl = f(sat, zsat[0], tsat).first;
+          const auto fv = f(sat, zsat[nsat - 1], tsat).first;
+          if (fl <= spec && spec <= fv) {
+            return {tsat,
+                    (spec - fl) / (fv - fl),
+                    {0.0, iter, flash_iteration_error::success}};
+          } else if (spec < fl) {
+            phase = phase_selection::liquid;
+            hi = std::min(hi, tsat);
+          } else {
+            phase = phase_selection::vapor;
+            lo = std::max(lo, tsat);
+          }
+          if (t <= lo || t >= hi) {
+            t = tsat;
+            continue;
+          }
+        }
+      }
+
+      const auto [value, derivative] =
+          f(state, select_zfactor(state, z, n, phase), t);
+      const auto residual = value - spec;
+
+      // The property increases monotonically with temperature
+      if (residual < 0) {
+        lo = std::max(lo, t);
+      } else {
+        hi = std::min(hi, t);
+      }
+
+      auto t_new = t - residual / derivative;
+      if (!(t_new > lo && t_new < hi)) {
+        if (std::isinf(hi)) {
+          t_new = 2 * lo;
+        } else {
+          t_new = lo > 0 ? 0.5 * (lo + hi) : 0.5 * hi;
+        }
+      }
+
+      eps = std::fabs(t_new - t) / t;
+      t = t_new;
+      ++iter;
+    }
+
+    if (phase == phase_selection::stable) {
+      constexpr auto R = gas_constant<double>();
+      const auto state = eos_.create_isobaric_isothermal_state(p, t);
+      std::array<double, 3> z;
+      const auto n = state.zfactor(z);
+      const auto v = select_zfactor(state, z, n, phase) * R * t / p;
+      const auto b = CubicEos::critical_repulsion_param(
+          eos_.critical_pressure(), eos_.critical_temperature());
+      phase = v < 1.75 * b ? phase_selection::liquid : phase_selection::vapor;
+    }
+
+    const auto vapor_fraction = phase == phase_selection::liquid ? 0.0 : 1.0;
+    if (iter >= maxiter_) {
+      return {0.0, vapor_fraction,
+              {eps, iter, flash_iteration_error::not_converged}};
+    } else {
+      return {t, vapor_fraction, {eps, iter, flash_iteration_error::success}};
+    }
+  }
+
+  CubicEos eos_;
+  ideal_gas_heat_capacity cp_;
+  vapor_liquid_flash<CubicEos> flash_;
+  double tol_;
+  int maxiter_;
+};
+
+/// @brief Makes isobaric flash object
+/// @param[in] eos EoS
+/// @param[in] cp Ideal gas heat capacity
+template <typename CubicEos>
+inline isobaric_flash<CubicEos> make_isobaric_flash(
+    const CubicEos &eos, const ideal_gas_heat_capacity &cp) {
+  return {eos, cp};
+}
+
+}  // namespace eos
@@ -1,17 +1,25 @@
 #pragma once
 
+#include <array>   // std::array
+#include <vector>  // std::vector
+
+#include "eos/cubic_eos/root_selection.hpp"
+#include "eos/cubic_eos/thermodynamic_derivatives.hpp"
+
 namespace eos {
 
 template <typename Eos, bool UseTemperatureCorrectionFactor>
 class isobaric_isothermal_state {
  public:
+  /// @param[in] p Pressure
   /// @param[in] t Temperature
   /// @param[in] ar Reduced attraction parameter
   /// @param[in] br Reduced repulsion parameter
   /// @param[in] beta The derivative of temperature correction factor
-  isobaric_isothermal_state(double t, double ar, double br,
-                            double beta) noexcept
-      : t_{t}, ar_{ar}, br_{br}, beta_{beta} {}
+  /// @param[in] gamma The second derivative of temperature correction factor
+  isobaric_isothermal_state(double p, double t, double ar, double br,
+                            double beta, double gamma) noexcept
+      : p_{p}, t_{t}, ar_{ar}, br_{br}, beta_{beta}, gamma_{gamma} {}
 
   isobaric_isothermal_state() = default;
   isobaric_isothermal_state(const isobaric_isothermal_state &) = default;
@@ -28,6 +36,19 @@ class isobaric_isothermal_state {
     return Eos::zfactor_cubic_eq(ar_, br_).real_roots();
   }
 
+  /// @brief Computes Z-factors without allocation
+  /// @param[out] z Z-factors in the ascending order
+  /// @return The number of Z-factors
+  std::size_t zfactor(std::array<double, 3> &z) const noexcept {
+    return Eos::zfactor_cubic_eq(ar_, br_).real_roots(z);
+  }
+
+  /// @brief Computes a Z-factor without allocation
+  /// @param[in] selection Selection of a root
+  double zfactor(root_selection selection) const noexcept {
+    return select_zfactor<Eos>(ar_, br_, selection);
+  }
+
   /// @brief Computes the natural logarithm of a fugacity coefficient
   /// @param[in] z Z-factor
   double ln_fugacity_coeff(double z) const noexcept {
@@ -58,22 +79,60 @@ class isobaric_isothermal_state {
     return Eos::residual_helmholtz_energy(z, t_, ar_, br_);
   }
 
+  /// @brief Computes residual isobaric heat capacity
+  /// @param[in] z Z-factor
+  double residual_isobaric_heat_capacity(double z) const noexcept {
+    constexpr auto R = gas_constant<double>();
+    const auto d = Eos::derivatives(z, ar_, br_, beta_, gamma_);
+    return R * (d.cv - d.dpdt * d.dpdt / d.dpdv - 1);
+  }
+
+  /// @brief Computes heat capacities, speed of sound and Joule-Thomson
+  /// coefficient from shared intermediates
+  /// @param[in] z Z-factor
+  /// @param[in] cp Ideal gas isobaric heat capacity [J/mol-K]
+  /// @param[in] mw Molecular weight [kg/kmol]
+  thermodynamic_derivatives derivatives(double z, double cp,
+                                        double mw) const noexcept {
+    return make_thermodynamic_derivatives(
+        Eos::derivatives(z, ar_, br_, beta_, gamma_), p_, t_, z, cp, mw);
+  }
+
+  /// @brief Returns pressure
+  double pressure() const noexcept { return p_; }
+
+  /// @brief Returns temperature
+  double temperature() const noexcept { return t_; }
+
+  /// @brief Returns reduced attraction parameter
+  double reduced_attraction_param() const noexcept { return ar_; }
+
+  /// @brief Returns reduced repulsion parameter
+  double reduced_repulsion_param() const noexcept { return br_; }
+
+  /// @brief Returns the derivative of temperature correction factor
+  double beta() const noexcept { return beta_; }
+
  private:
+  double p_;     /// Pressure
   double t_;     /// Temperature
   double ar_;    /// Reduced attraction parameter
   double br_;    /// Reduced repulsion parameter
   double beta_;  /// The derivative of temperature correction factor for
                  /// attraction parameter
+  double gamma_;  /// The second derivative of temperature correction factor
+                  /// for attraction parameter
 };
 
 template <typename Eos>
 class isobaric_isothermal_state<Eos, false> {
  public:
+  /// @param[in] p Pressure
   /// @param[in] t Temperature
   /// @param[in] ar Reduced attraction parameter
   /// @param[in] br Reduced repulsion parameter
-  isobaric_isothermal_state(double t, double ar, double br) noexcept
-      : t_{t}, ar_{ar}, br_{br} {}
+  isobaric_isothermal_state(double p, double t, double ar, double br) noexcept
+      : p_{p}, t_{t}, ar_{ar}, br_{br} {}
 
   isobaric_isothermal_state() = default;
   isobaric_isothermal_state(const isobaric_isothermal_state &) = default;
@@ -90,6 +149,19 @@ class isobaric_isothermal_state<Eos, false> {
     return Eos::zfactor_cubic_eq(ar_, br_).real_roots();
   }
 
+  /// @brief Computes Z-factors without allocation
+  /// @param[out] z Z-factors in the ascending order
+  /// @return The number of Z-factors
+  std::size_t zfactor(std::array<double, 3> &z) const noexcept {
+    return Eos::zfactor_cubic_eq(ar_, br_).real_roots(z);
+  }
+
+  /// @brief Computes a Z-factor without allocation
+  /// @param[in] selection Selection of a root
+  double zfactor(root_selection selection) const noexcept {
+    return select_zfactor<Eos>(ar_, br_, selection);
+  }
+
   /// @brief Computes the natural logarithm of a fugacity coefficient
   /// @param[in] z Z-factor
   double ln_fugacity_coeff(double z) const noexcept {
@@ -120,7 +192,39 @@ class isobaric_isothermal_state<Eos, false> {
     return Eos::residual_helmholtz_energy(z, t_, ar_, br_);
   }
 
+  /// @brief Computes residual isobaric heat capacity
+  /// @param[in] z Z-factor
+  double residual_isobaric_heat_capacity(double z) const noexcept {
+    constexpr auto R = gas_constant<double>();
+    const auto d = Eos::derivatives(z, ar_, br_);
+    return R * (d.cv - d.dpdt * d.dpdt / d.dpdv - 1);
+  }
+
+  /// @brief Computes heat capacities, speed of sound and Joule-Thomson
+  /// coefficient from shared intermediates
+  /// @param[in] z Z-factor
+  /// @param[in] cp Ideal gas isobaric heat capacity [J/mol-K]
+  /// @param[in] mw Molecular weight [kg/kmol]
+  thermodynamic_derivatives derivatives(double z, double cp,
+                                        double mw) const noexcept {
+    return make_thermodynamic_derivatives(Eos::derivatives(z, ar_, br_), p_,
+                                          t_, z, cp, mw);
+  }
+
+  /// @brief Returns pressure
+  double pressure() const noexcept { return p_; }
+
+  /// @brief Returns temperature
+  double temperature() const noexcept { return t_; }
+
+  /// @brief Returns reduced attraction parameter
+  double reduced_attraction_param() const noexcept { return ar_; }
+
+  /// @brief Returns reduced repulsion parameter
+  double reduced_repulsion_param() const noexcept { return br_; }
+
  private:
+  double p_;   /// Pressure
   double t_;   /// Temperature
   double ar_;  /// Reduced attraction parameter
   double br_;  /// Reduced repulsion parameter
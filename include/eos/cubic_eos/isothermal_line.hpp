@@ -1,5 +1,17 @@
 #pragma once
 
+#include <algorithm>  // std::max
+#include <array>      // std::array
+#include <cassert>    // assert
+#include <cmath>      // std::fabs
+#include <gsl/gsl>    // gsl::span
+#include <utility>    // std::pair
+#include <vector>     // std::vector
+
+#include "eos/common/thermodynamic_constants.hpp"  // eos::gas_constant
+#include "eos/cubic_eos/flash_iteration_result.hpp"
+#include "eos/cubic_eos/root_selection.hpp"
+
 namespace eos {
 
 template <typename Eos>
@@ -24,6 +36,148 @@ class isothermal_line {
     return Eos::pressure(t_, v, a_, b_);
   }
 
+  /// @brief Computes pressures at given volumes
+  /// @param[in] v Volumes
+  /// @param[out] p Pressures
+  void pressure(gsl::span<const double> v,
+                gsl::span<double> p) const noexcept {
+    assert(v.size() == p.size());
+    for (std::size_t i = 0; i < v.size(); ++i) {
+      p[i] = Eos::pressure(t_, v[i], a_, b_);
+    }
+  }
+
+  /// @brief Computes pressures and their derivatives with respect to volume
+  /// @param[in] v Volumes
+  /// @param[out] p Pressures
+  /// @param[out] dpdv Derivatives of pressure with respect to volume
+  void pressure(gsl::span<const double> v, gsl::span<double> p,
+                gsl::span<double> dpdv) const noexcept {
+    assert(v.size() == p.size() && v.size() == dpdv.size());
+    for (std::size_t i = 0; i < v.size(); ++i) {
+      p[i] = Eos::pressure(t_, v[i], a_, b_);
+      dpdv[i] = Eos::pressure_derivative(t_, v[i], a_, b_);
+    }
+  }
+
+  /// @brief Computes molar volume at given pressure
+  /// @param[in] p Pressure
+  /// @param[in] selection Selection of a root
+  double volume(double p, root_selection selection) const noexcept {
+    constexpr auto R = gas_constant<double>();
+    const auto rt = R * t_;
+    const auto ar = a_ * p / (rt * rt);
+    const auto br = b_ * p / rt;
+
+    return select_zfactor<Eos>(ar, br, selection) * rt / p;
+  }
+
+  /// @brief Computes molar volumes at given pressures
+  /// @param[in] p Pressures
+  /// @param[out] v Molar volumes
+  /// @param[in] selection Selection of a root
+  void volume(gsl::span<const double> p, gsl::span<double> v,
+              root_selection selection) const noexcept {
+    assert(p.size() == v.size());
+    for (std::size_t i = 0; i < p.size(); ++i) {
+      v[i] = this->volume(p[i], selection);
+    }
+  }
+
+  /// @brief Computes mass densities at given pressures
+  /// @param[in] p Pressures
+  /// @param[in] mw Molecular weight [kg/kmol]
+  /// @param[out] rho Mass densities [kg/m3]
+  /// @param[in] selection Selection of a root
+  void density(gsl::span<const double> p, double mw, gsl::span<double> rho,
+               root_selection selection) const noexcept {
+    assert(p.size() == rho.size());
+    const auto m = 1e-3 * mw;
+    for (std::size_t i = 0; i < p.size(); ++i) {
+      rho[i] = m / this->volume(p[i], selection);
+    }
+  }
+
+  /// @brief Computes spinodal volumes
+  /// @return Volumes at the local minimum and maximum of pressure in the
+  /// ascending order. Empty if the temperature is supercritical.
+  ///
+  /// Spinodal volumes are the roots of
+  /// \f$ (\partial P / \partial V)_T = 0 \f$, which is a quartic equation of
+  /// volume and solved in the closed form.
+  std::vector<double> spinodal_volumes() const {
+    constexpr auto R = gas_constant<double>();
+    std::array<double, 4> x;
+    const auto n = Eos::spinodal_quartic_eq(a_ / (b_ * R * t_)).real_roots(x);
+
+    std::vector<double> v;
+    v.reserve(2);
+    for (std::size_t i = 0; i < n; ++i) {
+      if (x[i] > 1) {
+        v.push_back(x[i] * b_);
+      }
+    }
+    if (v.size() != 2) {
+      v.clear();
+    }
+    return v;
+  }
+
+  /// @brief Computes saturation pressure by Maxwell's equal-area rule
+  /// @param[in] tol Tolerance for the relative change of pressure
+  /// @param[in] maxiter Maximum iteration
+  /// @return A pair of saturation pressure and iteration report
+  ///
+  /// Pressure is updated by Newton's method,
+  /// \f[ P^{k+1} = P^k + \frac{\int_{V_L}^{V_V} P \mathrm{d} V - P^k (V_V -
+  /// V_L)}{V_V - V_L}, \f]
+  /// within the bracket of the spinodal pressures.
+  std::pair<double, flash_iteration_result> saturation_pressure(
+      double tol = 1e-10, int maxiter = 100) const {
+    const auto vs = this->spinodal_volumes();
+    if (vs.empty()) {
+      return {0.0, {1.0, 0, flash_iteration_error::multiple_roots_not_found}};
+    }
+
+    auto lo = std::max(this->pressure(vs[0]), 0.0);
+    auto hi = this->pressure(vs[1]);
+    auto p = 0.5 * (lo + hi);
+    double eps = 1.0;
+    int iter = 0;
+
+    while (eps > tol && iter < maxiter) {
+      const auto vl = this->volume(p, root_selection::smallest);
+      const auto vv = this->volume(p, root_selection::largest);
+      const auto dv = vv - vl;
+      const auto area = Eos::pressure_integral(t_, vl, vv, a_, b_) - p * dv;
+
+      // Positive area means that pressure is lower than saturation pressure
+      if (area > 0) {
+        lo = p;
+      } else {
+        hi = p;
+      }
+
+      auto p_new = p + area / dv;
+      if (!(p_new > lo && p_new < hi)) {
+        p_new = 0.5 * (lo + hi);
+      }
+
+      eps = std::fabs(p_new - p) / p;
+      p = p_new;
+      ++iter;
+    }
+
+    if (iter >= maxiter) {
+      return {0.0, {eps, iter, flash_iteration_error::not_converged}};
+    } else {
+      return {p, {eps, iter, flash_iteration_error::success}};
+    }
+  }
+
+  /// @brief Returns temperature
+  double temperature() const noexcept { return t_; }
+
  private:
   double t_;  /// Temperature
   double a_;  /// Attraction parameter
@@ -0,0 +1,156 @@
+#pragma once
+
+#include <array>    // std::array
+#include <cmath>    // std::exp, std::log
+#include <cstdint>  // std::uint8_t
+#include <vector>   // std::vector
+
+#include "eos/common/thermodynamic_constants.hpp"  // eos::gas_constant
+#include "eos/cubic_eos/isobaric_isothermal_state.hpp"
+
+namespace eos {
+
+/// @brief Isobaric-isothermal state lazily caching Z-factors and logarithms
+/// @tparam Eos Cubic EoS
+/// @tparam UseTemperatureCorrectionFactor True if the attraction parameter
+/// depends on temperature
+///
+/// Z-factors are computed on the first call of zfactor(), and
+/// \f$ \ln (Z - B) \f$ and the attraction term of each root are computed on the
+/// first property evaluation of the root and shared by the fugacity
+/// coefficient, residual enthalpy, entropy and Helmholtz energy. Properties of
+/// a Z-factor which is not one of the cached roots are computed without
+/// caching.
+///
+/// This class is not thread-safe because the cache is updated from const
+/// member functions. Use isobaric_isothermal_state when caching is not needed.
+template <typename Eos, bool UseTemperatureCorrectionFactor>
+class memoized_isobaric_isothermal_state {
+ public:
+  using state_type =
+      isobaric_isothermal_state<Eos, UseTemperatureCorrectionFactor>;
+
+  /// @param[in] s Isobaric-isothermal state
+  memoized_isobaric_isothermal_state(const state_type &s) noexcept
+      : state_{s}, z_{}, ln_zb_{}, q_{} {}
+
+  memoized_isobaric_isothermal_state() = default;
+  memoized_isobaric_isothermal_state(
+      const memoized_isobaric_isothermal_state &) = default;
+  memoized_isobaric_isothermal_state(memoized_isobaric_isothermal_state &&) =
+      default;
+
+  memoized_isobaric_isothermal_state &operator=(
+      const memoized_isobaric_isothermal_state &) = default;
+  memoized_isobaric_isothermal_state &operator=(
+      memoized_isobaric_isothermal_state &&) = default;
+
+  /// @brief Computes Z-factors on the first call and returns cached ones
+  /// @return A list of Z-factors in the ascending order
+  const std::vector<double> &zfactor() const {
+    if (!(computed_ & roots_computed)) {
+      z_ = state_.zfactor();
+      computed_ |= roots_computed;
+    }
+    return z_;
+  }
+
+  /// @brief Computes the natural logarithm of a fugacity coefficient
+  /// @param[in] z Z-factor
+  double ln_fugacity_coeff(double z) const noexcept {
+    const auto [ln_zb, q] = this->log_terms(z);
+    return z - 1 - ln_zb - q;
+  }
+
+  /// @brief Computes fugacity coefficient
+  /// @param[in] z Z-factor
+  double fugacity_coeff(double z) const noexcept {
+    return std::exp(this->ln_fugacity_coeff(z));
+  }
+
+  /// @brief Computes residual enthalpy
+  /// @param[in] z Z-factor
+  double residual_enthalpy(double z) const noexcept {
+    constexpr auto R = gas_constant<double>();
+    const auto q = this->log_terms(z)[1];
+    return R * state_.temperature() * (z - 1 - (1 - this->beta()) * q);
+  }
+
+  /// @brief Computes residual entropy
+  /// @param[in] z Z-factor
+  double residual_entropy(double z) const noexcept {
+    constexpr auto R = gas_constant<double>();
+    const auto [ln_zb, q] = this->log_terms(z);
+    return R * (ln_zb + this->beta() * q);
+  }
+
+  /// @brief Computes residual Helmholtz energy
+  /// @param[in] z Z-factor
+  double residual_helmholtz_energy(double z) const noexcept {
+    constexpr auto R = gas_constant<double>();
+    const auto [ln_zb, q] = this->log_terms(z);
+    return R * state_.temperature() * (ln_zb + q);
+  }
+
+  /// @brief Computes residual isobaric heat capacity
+  /// @param[in] z Z-factor
+  double residual_isobaric_heat_capacity(double z) const noexcept {
+    return state_.residual_isobaric_heat_capacity(z);
+  }
+
+  /// @brief Computes heat capacities, speed of sound and Joule-Thomson
+  /// coefficient from shared intermediates
+  /// @param[in] z Z-factor
+  /// @param[in] cp Ideal gas isobaric heat capacity [J/mol-K]
+  /// @param[in] mw Molecular weight [kg/kmol]
+  thermodynamic_derivatives derivatives(double z, double cp,
+                                        double mw) const noexcept {
+    return state_.derivatives(z, cp, mw);
+  }
+
+  /// @brief Returns the underlying state without caching
+  const state_type &state() const noexcept { return state_; }
+
+ private:
+  static constexpr std::uint8_t roots_computed = 1 << 3;
+
+  /// @brief Returns the temperature correction factor
+  double beta() const noexcept {
+    if constexpr (UseTemperatureCorrectionFactor) {
+      return state_.beta();
+    } else {
+      return 0.0;
+    }
+  }
+
+  /// @brief Returns \f$ \ln (Z - B) \f$ and the attraction term
+  /// @param[in] z Z-factor
+  std::array<double, 2> log_terms(double z) const noexcept {
+    const auto a = state_.reduced_attraction_param();
+    const auto b = state_.reduced_repulsion_param();
+
+    if (computed_ & roots_computed) {
+      for (std::size_t i = 0; i < z_.size(); ++i) {
+        if (z_[i] != z) {
+          continue;
+        }
+        const auto bit = static_cast<std::uint8_t>(1 << i);
+        if (!(computed_ & bit)) {
+          ln_zb_[i] = std::log(z - b);
+          q_[i] = Eos::attraction_term(z, a, b);
+          computed_ |= bit;
+        }
+        return {ln_zb_[i], q_[i]};
+      }
+    }
+    return {std::log(z - b), Eos::attraction_term(z, a, b)};
+  }
+
+  state_type state_;                     /// Isobaric-isothermal state
+  mutable std::vector<double> z_;        /// Z-factors
+  mutable std::array<double, 3> ln_zb_;  /// ln(Z - B) of each root
+  mutable std::array<double, 3> q_;      /// Attraction term of each root
+  mutable std::uint8_t computed_ = 0;    /// Bit flags of computed values
+};
+
+}  // namespace eos
@@ -0,0 +1,167 @@
+#pragma once
+
+#include <algorithm>  // std::max
+#include <cassert>    // assert
+#include <cmath>      // std::fabs
+#include <cstddef>    // std::size_t
+#include <limits>     // std::numeric_limits
+#include <gsl/gsl>    // gsl::span
+#include <vector>     // std::vector
+
+#include "eos/common/scratch_arena.hpp"
+#include "eos/cubic_eos/root_selection.hpp"
+#include "eos/math/vector_math.hpp"  // eos::vector_math, eos::branch_free_math
+
+namespace eos {
+
+/// @brief Report of mixed-precision evaluation
+struct mixed_precision_report {
+  std::size_t size;         /// Number of points
+  std::size_t refined;      /// Number of points refined in double precision
+  double max_error_z;       /// Maximum absolute error of Z-factor
+  double max_error_ln_phi;  /// Maximum absolute error of ln(phi)
+};
+
+/// @brief Computes Z-factors and logarithms of fugacity coefficients in
+/// mixed precision
+/// @tparam CubicEos Cubic EoS
+/// @param[in] eos EoS
+/// @param[in] p Pressures
+/// @param[in] t Temperatures
+/// @param[out] z Z-factors of the stable phase
+/// @param[out] ln_phi Logarithms of fugacity coefficients
+/// @param[in] threshold Threshold of the residual of the cubic equation
+/// @return Report without errors
+///
+/// Reduced parameters are computed in double precision. Then, the cubic
+/// equation and logarithms are evaluated in float by the branch-free
+/// functions of eos::vector_math, where the smallest and largest roots are
+/// both evaluated and the root of the smaller Gibbs energy is selected, so
+/// that the loop is vectorized in lanes of eight floats with AVX2. The
+/// residual of the cubic equation is evaluated in double precision in
+/// another vectorized loop, and only for points whose residual exceeds the
+/// threshold, Z-factor is refined by one step of Newton's method and the
+/// logarithm of fugacity coefficient is recomputed in double precision.
+/// Near the vapor pressure, where the Gibbs energies of the two roots differ
+/// within the error of float, the roots are recomputed in double precision
+/// and the phase is selected again.
+template <typename CubicEos>
+mixed_precision_report zfactor_mixed_precision(const CubicEos &eos,
+                                               gsl::span<const double> p,
+                                               gsl::span<const double> t,
+                                               gsl::span<double> z,
+                                               gsl::span<double> ln_phi,
+                                               double threshold = 1e-7) {
+  assert(p.size() == t.size() && p.size() == z.size() &&
+         p.size() == ln_phi.size());
+  const auto n = p.size();
+  auto &arena = thread_scratch_arena();
+  scratch_arena::scope scope(arena);
+  // Pointers instead of spans keep bounds checks out of the loops
+  const auto a = arena.allocate<double>(n).data();
+  const auto b = arena.allocate<double>(n).data();
+  const auto zf = arena.allocate<float>(n).data();
+  const auto ln_phi_f = arena.allocate<float>(n).data();
+  const auto flagged = arena.allocate<int>(n).data();
+  const auto ambiguous = arena.allocate<int>(n).data();
+  const auto zd = z.data();
+  const auto ln_phi_d = ln_phi.data();
+
+  for (std::size_t i = 0; i < n; ++i) {
+    const auto state = eos.create_isobaric_isothermal_state(p[i], t[i]);
+    a[i] = state.reduced_attraction_param();
+    b[i] = state.reduced_repulsion_param();
+  }
+
+  // Float lanes
+  constexpr auto tol = 1024 * std::numeric_limits<float>::epsilon();
+  for (std::size_t i = 0; i < n; ++i) {
+    const auto eq = CubicEos::zfactor_cubic_eq(a[i], b[i]);
+    const auto af = static_cast<float>(a[i]);
+    const auto bf = static_cast<float>(b[i]);
+    float x0, x1, x2;
+    vector_math::solve_cubic(static_cast<float>(eq.a),
+                             static_cast<float>(eq.b),
+                             static_cast<float>(eq.c), x0, x1, x2);
+    // The largest root is the smallest one if the equation has one root
+    const auto f0 =
+        x0 - 1 - branch_free_math::log(x0 - bf) -
+        CubicEos::template attraction_term<float, branch_free_math>(x0, af,
+                                                                    bf);
+    const auto f2 =
+        x2 - 1 - branch_free_math::log(x2 - bf) -
+        CubicEos::template attraction_term<float, branch_free_math>(x2, af,
+                                                                    bf);
+    // The root of the smallest Gibbs energy; the smallest root may be
+    // below the covolume at low pressure
+    const auto use_largest = !(x0 > bf) || f2 < f0;
+    zf[i] = use_largest ? x2 : x0;
+    ln_phi_f[i] = use_largest ? f2 : f0;
+    ambiguous[i] = x0 > bf && x2 > x0 &&
+                   std::fabs(f2 - f0) <=
+                       tol * (1 + std::fabs(f0) + std::fabs(f2));
+  }
+
+  // Residuals in double precision
+  for (std::size_t i = 0; i < n; ++i) {
+    const auto eq = CubicEos::zfactor_cubic_eq(a[i], b[i]);
+    const auto zi = static_cast<double>(zf[i]);
+    const auto f = ((zi + eq.a) * zi + eq.b) * zi + eq.c;
+    const auto flag =
+        std::fabs(f) > threshold || !(zi > b[i]) || ambiguous[i];
+    zd[i] = zi;
+    ln_phi_d[i] = static_cast<double>(ln_phi_f[i]);
+    flagged[i] = flag;
+  }
+
+  // Refinement in double precision
+  std::size_t refined = 0;
+  for (std::size_t i = 0; i < n; ++i) {
+    if (flagged[i]) {
+      const auto eq = CubicEos::zfactor_cubic_eq(a[i], b[i]);
+      if (ambiguous[i]) {
+        double x0, x1, x2;
+        vector_math::solve_cubic(eq.a, eq.b, eq.c, x0, x1, x2);
+        const auto f0 = CubicEos::ln_fugacity_coeff(x0, a[i], b[i]);
+        const auto f2 = CubicEos::ln_fugacity_coeff(x2, a[i], b[i]);
+        zd[i] = !(x0 > b[i]) || f2 < f0 ? x2 : x0;
+      }
+      const auto f = ((zd[i] + eq.a) * zd[i] + eq.b) * zd[i] + eq.c;
+      const auto df = (3 * zd[i] + 2 * eq.a) * zd[i] + eq.b;
+      if (df != 0) {
+        zd[i] -= f / df;
+      }
+      ln_phi_d[i] = CubicEos::ln_fugacity_coeff(zd[i], a[i], b[i]);
+      ++refined;
+    }
+  }
+
+  return {n, refined, 0.0, 0.0};
+}
+
+/// @brief Measures the accuracy of mixed-precision evaluation against the
+/// double-precision path
+/// @param[in] eos EoS
+/// @param[in] p Pressures
+/// @param[in] t Temperatures
+/// @param[in] threshold Threshold of the residual of the cubic equation
+/// @return Report with the maximum absolute errors of Z-factor and ln(phi)
+template <typename CubicEos>
+mixed_precision_report measure_mixed_precision_accuracy(
+    const CubicEos &eos, gsl::span<const double> p, gsl::span<const double> t,
+    double threshold = 1e-7) {
+  const auto n = p.size();
+  std::vector<double> z(n), ln_phi(n), z_ref(n), ln_phi_ref(n);
+  auto report = zfactor_mixed_precision(eos, p, t, z, ln_phi, threshold);
+  eos.zfactor(p, t, z_ref, root_selection::stable);
+  eos.ln_fugacity_coeff(p, t, ln_phi_ref, root_selection::stable);
+  for (std::size_t i = 0; i < n; ++i) {
+    report.max_error_z =
+        std::max(report.max_error_z, std::fabs(z[i] - z_ref[i]));
+    report.max_error_ln_phi = std::max(report.max_error_ln_phi,
+                                       std::fabs(ln_phi[i] - ln_phi_ref[i]));
+  }
+  return report;
+}
+
+}  // namespace eos
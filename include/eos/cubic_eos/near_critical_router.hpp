@@ -0,0 +1,169 @@
+#pragma once
+
+#include <array>    // std::array
+#include <cassert>  // assert
+#include <cstddef>  // std::size_t
+#include <gsl/gsl>  // gsl::span
+#include <tuple>    // std::tie
+#include <utility>  // std::pair
+
+#include "eos/cubic_eos/flash_iteration_result.hpp"
+#include "eos/cubic_eos/vapor_liquid_flash.hpp"
+
+namespace eos {
+
+/// @brief Route of a vapor pressure calculation
+enum class saturation_route {
+  fast,          /// Successive substitution of vapor_liquid_flash
+  robust,        /// Maxwell's equal-area rule of isothermal_line
+  supercritical  /// No saturation exists in the EoS
+};
+
+/// @brief Criteria to classify a point as near-critical
+struct near_critical_criteria {
+  /// Minimum of \f$ k / k_c - 1 \f$ for the fast path, where
+  /// \f$ k = a / (b R T) \f$ and \f$ k_c = \Omega_a / \Omega_b \f$ is its
+  /// value at the critical point of the EoS
+  double min_distance = 0.1;
+  /// Maximum reduced vapor pressure estimated by Wilson equation for the
+  /// fast path
+  double max_wilson_pressure = 0.6;
+};
+
+/// @brief Vapor pressure calculation routing near-critical points to a
+/// robust solver
+/// @tparam CubicEos Cubic EoS
+///
+/// Successive substitution converges linearly with a rate approaching one at
+/// the critical point, and fails if the initial pressure is outside the
+/// three-root region. Each point is classified by the distance to the
+/// critical point of the EoS, the reduced vapor pressure estimated by Wilson
+/// equation, and the discriminant of the cubic equation at the initial
+/// pressure. Near-critical points are solved by Maxwell's equal-area rule
+/// bracketed by the spinodal pressures, and the others by successive
+/// substitution, falling back to the robust solver on failure.
+template <typename CubicEos>
+class near_critical_router {
+ public:
+  /// @param[in] eos EoS
+  /// @param[in] omega Acentric factor used for Wilson equation
+  /// @param[in] criteria Criteria of near-critical points
+  /// @param[in] tol Tolerance of successive substitution
+  /// @param[in] maxiter Maximum iteration
+  near_critical_router(const CubicEos &eos, double omega,
+                       const near_critical_criteria &criteria = {},
+                       double tol = 1e-6, int maxiter = 100)
+      : eos_{eos},
+        flash_{eos, tol, maxiter},
+        omega_{omega},
+        criteria_{criteria},
+        maxiter_{maxiter},
+        counts_{},
+        fallbacks_{0} {}
+
+  /// @brief Classifies a point
+  /// @param[in] p_init Initial pressure
+  /// @param[in] t Temperature
+  saturation_route classify(double p_init, double t) const noexcept {
+    const auto state = eos_.create_isobaric_isothermal_state(p_init, t);
+    const auto ar = state.reduced_attraction_param();
+    const auto br = state.reduced_repulsion_param();
+    const auto distance =
+        (ar / br) * (CubicEos::omega_b / CubicEos::omega_a) - 1;
+    if (!(distance > 0)) {
+      return saturation_route::supercritical;
+    }
+    if (distance < criteria_.min_distance) {
+      return saturation_route::robust;
+    }
+
+    const auto pc = eos_.critical_pressure();
+    const auto tc = eos_.critical_temperature();
+    if (t >= tc || estimate_vapor_pressure(t, pc, tc, omega_) >
+                       criteria_.max_wilson_pressure * pc) {
+      return saturation_route::robust;
+    }
+
+    // Successive substitution fails immediately with one real root
+    if (!(CubicEos::zfactor_cubic_eq(ar, br).discriminant() > 0)) {
+      return saturation_route::robust;
+    }
+    return saturation_route::fast;
+  }
+
+  /// @brief Computes vapor pressure
+  /// @param[in] p_init Initial pressure
+  /// @param[in] t Temperature
+  /// @return A pair of vapor pressure and iteration report
+  std::pair<double, flash_iteration_result> vapor_pressure(double p_init,
+                                                           double t) {
+    const auto route = this->classify(p_init, t);
+    ++counts_[static_cast<std::size_t>(route)];
+    switch (route) {
+      case saturation_route::supercritical:
+        return {0.0,
+                {1.0, 0, flash_iteration_error::multiple_roots_not_found}};
+      case saturation_route::robust:
+        return this->robust_vapor_pressure(t);
+      default: {
+        const auto result = flash_.vapor_pressure(p_init, t);
+        if (result.second.error == flash_iteration_error::success) {
+          return result;
+        }
+        ++fallbacks_;
+        auto robust = this->robust_vapor_pressure(t);
+        robust.second.iter += result.second.iter;
+        return robust;
+      }
+    }
+  }
+
+  /// @brief Computes vapor pressures at multiple temperatures
+  /// @param[in] p_init Initial pressures
+  /// @param[in] t Temperatures
+  /// @param[out] p Vapor pressures
+  /// @param[out] r Iteration reports
+  void vapor_pressure(gsl::span<const double> p_init,
+                      gsl::span<const double> t, gsl::span<double> p,
+                      gsl::span<flash_iteration_result> r) {
+    assert(p_init.size() == t.size() && p_init.size() == p.size() &&
+           p_init.size() == r.size());
+    for (std::size_t i = 0; i < p.size(); ++i) {
+      std::tie(p[i], r[i]) = this->vapor_pressure(p_init[i], t[i]);
+    }
+  }
+
+  /// @brief Returns the number of points classified to a route
+  std::size_t count(saturation_route route) const noexcept {
+    return counts_[static_cast<std::size_t>(route)];
+  }
+
+  /// @brief Returns the number of points falling back from the fast path to
+  /// the robust solver
+  std::size_t fallbacks() const noexcept { return fallbacks_; }
+
+  /// @brief Resets counters
+  void reset_counters() noexcept {
+    counts_ = {};
+    fallbacks_ = 0;
+  }
+
+  const near_critical_criteria &criteria() const noexcept { return criteria_; }
+
+ private:
+  std::pair<double, flash_iteration_result> robust_vapor_pressure(
+      double t) const {
+    return eos_.create_isothermal_line(t).saturation_pressure(1e-10,
+                                                              maxiter_);
+  }
+
+  CubicEos eos_;
+  vapor_liquid_flash<CubicEos> flash_;
+  double omega_;
+  near_critical_criteria criteria_;
+  int maxiter_;
+  std::array<std::size_t, 3> counts_;  /// Number of points of each route
+  std::size_t fallbacks_;
+};
+
+}  // namespace eos
@@ -5,7 +5,10 @@
 
 #include "eos/common/mathematical_constants.hpp"  // eos::sqrt_two
 #include "eos/cubic_eos/cubic_eos_base.hpp"       // eos::cubic_eos_base
-#include "eos/math/cubic_equation.hpp"            // eos::cubic_equation
+#include "eos/cubic_eos/thermodynamic_derivatives.hpp"
+#include "eos/math/cubic_equation.hpp"    // eos::cubic_equation
+#include "eos/math/quartic_equation.hpp"  // eos::quartic_equation
+#include "eos/math/vector_math.hpp"      // eos::standard_math
 
 namespace eos {
 
@@ -21,6 +24,9 @@ struct cubic_eos_traits<peng_robinson_eos> {
 class peng_robinson_eos : public cubic_eos_base<peng_robinson_eos, true> {
  public:
   using base_type = cubic_eos_base<peng_robinson_eos, true>;
+  using base_type::derivatives;
+  using base_type::ln_fugacity_coeff;
+  using base_type::pressure;
 
   // Static functions
 
@@ -35,6 +41,47 @@ class peng_robinson_eos : public cubic_eos_base<peng_robinson_eos, true> {
     return R * t / (v - b) - a / (v * (v + b) + b * (v - b));
   }
 
+  /// @brief Computes the derivative of pressure with respect to volume at
+  /// constant temperature
+  /// @param[in] t Temperature
+  /// @param[in] v Volume
+  /// @param[in] a Attraction parameter
+  /// @param[in] b Repulsion parameter
+  static double pressure_derivative(double t, double v, double a,
+                                    double b) noexcept {
+    constexpr auto R = gas_constant<double>();
+    const auto vb = 1 / (v - b);
+    const auto d = v * (v + b) + b * (v - b);
+    return 2 * a * (v + b) / (d * d) - R * t * vb * vb;
+  }
+
+  /// @brief Computes the integral of pressure with respect to volume at
+  /// constant temperature
+  /// @param[in] t Temperature
+  /// @param[in] v1 Lower bound of volume
+  /// @param[in] v2 Upper bound of volume
+  /// @param[in] a Attraction parameter
+  /// @param[in] b Repulsion parameter
+  static double pressure_integral(double t, double v1, double v2, double a,
+                                  double b) noexcept {
+    constexpr auto R = gas_constant<double>();
+    constexpr auto sqrt2 = sqrt_two<double>();
+    constexpr auto delta1 = 1 + sqrt2;
+    constexpr auto delta2 = 1 - sqrt2;
+    return R * t * std::log((v2 - b) / (v1 - b)) -
+           a / (2 * sqrt2 * b) *
+               std::log((v2 + delta2 * b) * (v1 + delta1 * b) /
+                        ((v2 + delta1 * b) * (v1 + delta2 * b)));
+  }
+
+  /// @brief Computes coefficients of the quartic equation of spinodal volume
+  /// @param[in] k Dimensionless attraction parameter, \f$ a / (b R T) \f$
+  /// @returns Coefficients of the quartic equation of \f$ V / b \f$, whose
+  /// roots satisfy \f$ (\partial P / \partial V)_T = 0 \f$
+  static quartic_equation spinodal_quartic_eq(double k) noexcept {
+    return {4 - 2 * k, 2 + 2 * k, 2 * k - 4, 1 - 2 * k};
+  }
+
   /// @brief Computes coefficients of the cubic equation of z-factor.
   /// @param[in] a Reduced attraction parameter
   /// @param[in] b Reduced repulsion parameter
@@ -95,6 +142,38 @@ class peng_robinson_eos : public cubic_eos_base<peng_robinson_eos, true> {
     return R * t * (std::log(z - b) + q(z, a, b));
   }
 
+  /// @brief Computes the attraction term shared by the fugacity coefficient,
+  /// residual enthalpy, entropy and Helmholtz energy
+  /// @tparam T Floating-point type
+  /// @param[in] z Z-factor
+  /// @param[in] a Reduced attraction parameter
+  /// @param[in] b Reduced repulsion parameter
+  ///
+  /// Together with \f$ \ln (Z - B) \f$, this gives
+  /// \f$ \ln \phi = Z - 1 - \ln (Z - B) - q \f$. Math provides the
+  /// logarithm, e.g., eos::branch_free_math in vectorized loops.
+  template <typename T, typename Math = standard_math>
+  static T attraction_term(T z, T a, T b) noexcept {
+    return q<T, Math>(z, a, b);
+  }
+
+  /// @brief Computes dimensionless derivatives of pressure and residual
+  /// isochoric heat capacity
+  /// @param[in] z Z-factor
+  /// @param[in] a Reduced attraction parameter
+  /// @param[in] b Reduced repulsion parameter
+  /// @param[in] beta Temperature correction factor
+  /// @param[in] gamma Second order temperature correction factor
+  static dimensionless_derivatives derivatives(double z, double a, double b,
+                                               double beta,
+                                               double gamma) noexcept {
+    const auto zb = 1 / (z - b);
+    const auto d = z * (z + 2 * b) - b * b;
+    const auto ad = a / d;
+    return {2 * ad * (z + b) / d - zb * zb, zb - beta * ad,
+            gamma * q(z, a, b)};
+  }
+
   // Constructors
 
   peng_robinson_eos() = default;
@@ -137,7 +216,16 @@ class peng_robinson_eos : public cubic_eos_base<peng_robinson_eos, true> {
   /// @param[in] tr Reduced temperature
   double beta(double tr) const noexcept {
     const auto sqrt_tr = std::sqrt(tr);
-    return -m_ * sqrt_tr * (1 + m_ * (1 - sqrt_tr));
+    return -m_ * sqrt_tr / (1 + m_ * (1 - sqrt_tr));
+  }
+
+  /// @brief Computes \f[ \gamma = \frac{T_r^2}{\alpha} \cdot
+  /// \frac{\mathrm{d}^2 \alpha}{\mathrm{d} T_r^2} \f]
+  /// @param[in] tr Reduced temperature
+  double gamma(double tr) const noexcept {
+    const auto sqrt_tr = std::sqrt(tr);
+    const auto a = 1 + m_ * (1 - sqrt_tr);
+    return m_ / (2 * a * a) * (m_ * tr + a * sqrt_tr);
   }
 
  private:
@@ -152,25 +240,14 @@ class peng_robinson_eos : public cubic_eos_base<peng_robinson_eos, true> {
   /// @param[in] z Z-factor
   /// @param[in] a Reduced attraction parameter
   /// @param[in] b Reduced repulsion parameter
-  static double q(double z, double a, double b) noexcept {
-    constexpr auto sqrt2 = sqrt_two<double>();
+  template <typename T, typename Math = standard_math>
+  static T q(T z, T a, T b) noexcept {
+    constexpr auto sqrt2 = sqrt_two<T>();
     constexpr auto delta1 = 1 + sqrt2;
     constexpr auto delta2 = 1 - sqrt2;
-    return a / (2 * sqrt2 * b) * std::log((z + delta1 * b) / (z + delta2 * b));
-  }
-
-  /*
-  /// @brief Computes  \f[ \gamma = \frac{T_r^2}{\alpha} \cdot
-  /// \frac{\mathrm{d}^2 \alpha}{\mathrm{d} T_r^2} \f]
-  /// @param[in] tr Reduced temperature
-  double  gamma(double tr) const noexcept {
-    using std::sqrt;
-    const auto sqrt_tr = sqrt(tr);
-    const auto a = 1 + m_ * (1 - sqrt_tr);
-    const auto alpha = a * a;
-    return m_ / (2 * alpha) * (m_ * tr + a * sqrt_tr);
+    return a / (2 * sqrt2 * b) *
+           Math::log((z + delta1 * b) / (z + delta2 * b));
   }
-  */
 
   /// Acentric factor
   double omega_;
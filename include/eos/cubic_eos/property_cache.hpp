@@ -0,0 +1,305 @@
+#pragma once
+
+#include <algorithm>  // std::max
+#include <array>      // std::array
+#include <atomic>     // std::atomic
+#include <cassert>    // assert
+#include <cmath>      // std::exp, std::isfinite, std::llround
+#include <cstddef>    // std::size_t
+#include <cstdint>    // std::int64_t, std::uint64_t
+#include <memory>     // std::unique_ptr
+#include <mutex>      // std::mutex, std::lock_guard
+#include <stdexcept>  // std::invalid_argument
+#include <vector>     // std::vector
+
+#include "eos/cubic_eos/root_selection.hpp"
+
+namespace eos {
+
+/// @brief Properties of the stable phase cached by property_cache
+struct cached_properties {
+  double z;                  /// Z-factor
+  double ln_fugacity_coeff;  /// Natural logarithm of fugacity coefficient
+  double residual_enthalpy;  /// [J/mol]
+  double residual_entropy;   /// [J/mol-K]
+};
+
+/// @brief Thread-safe bounded cache of properties on quantized (p, T)
+/// @tparam CubicEos Cubic EoS
+///
+/// Pressure is quantized on the logarithmic scale with a relative tolerance,
+/// and temperature on the linear scale with an absolute tolerance.
+/// Properties are evaluated at the center of a quantization cell, so that
+/// results do not depend on the order of queries. The error of a cached
+/// property is that of the evaluation shifted by at most half the tolerance.
+///
+/// A cell crossed by the saturation curve holds both phases, and the center
+/// would give the other phase to queries on the other side. Such a cell is
+/// detected when it is first evaluated: the corners of the highest pressure
+/// at the lowest temperature and of the lowest pressure at the highest
+/// temperature lie on either side of the curve, which is monotonic, if and
+/// only if the curve crosses the cell. A corner with three roots is on the
+/// liquid side if the smallest root is stable. A corner with a single root,
+/// which is common near the critical point, is on the liquid side if the
+/// root is below the inflection point of the cubic equation, where the other
+/// pair of roots lies above it. Queries in the cell then bypass the cache
+/// and are evaluated at the query point.
+///
+/// The table is split into shards guarded by their own mutexes. Each key is
+/// probed in a window of consecutive slots, and a slot in the window is
+/// evicted by the CLOCK algorithm when the window is full.
+template <typename CubicEos>
+class property_cache {
+ public:
+  /// @param[in] eos EoS
+  /// @param[in] capacity Maximum number of cached entries
+  /// @param[in] p_tol Relative tolerance of pressure
+  /// @param[in] t_tol Absolute tolerance of temperature [K]
+  /// @param[in] num_shards Number of shards
+  property_cache(const CubicEos &eos, std::size_t capacity, double p_tol,
+                 double t_tol, std::size_t num_shards = 16)
+      : eos_{eos},
+        p_tol_{p_tol},
+        t_tol_{t_tol},
+        num_shards_{num_shards > 0 ? num_shards : 1},
+        shard_size_{std::max<std::size_t>(
+            (capacity + num_shards_ - 1) / num_shards_, probe_window)},
+        shards_{std::make_unique<shard[]>(num_shards_)},
+        hits_{0},
+        misses_{0},
+        bypasses_{0},
+        evictions_{0} {
+    assert(p_tol > 0 && t_tol > 0);
+    for (std::size_t i = 0; i < num_shards_; ++i) {
+      shards_[i].slots.resize(shard_size_);
+    }
+  }
+
+  property_cache(const property_cache &) = delete;
+  property_cache &operator=(const property_cache &) = delete;
+
+  /// @brief Returns properties at given pressure and temperature
+  /// @param[in] p Pressure
+  /// @param[in] t Temperature
+  /// @throw std::invalid_argument if pressure or temperature is not
+  /// positive and finite, or out of the range of keys
+  cached_properties get(double p, double t) {
+    if (!(p > 0) || !std::isfinite(p)) {
+      throw std::invalid_argument("Pressure must be positive and finite");
+    }
+    if (!(t > 0) || !std::isfinite(t)) {
+      throw std::invalid_argument("Temperature must be positive and finite");
+    }
+    const auto kp = std::log(p) / p_tol_;
+    const auto kt = t / t_tol_;
+    // Keys must be representable by std::llround
+    if (!(std::fabs(kp) < max_key && kt < max_key)) {
+      throw std::invalid_argument("Pressure or temperature is out of range");
+    }
+    const key_type key{std::llround(kp), std::llround(kt)};
+    const auto h = hash(key);
+    auto &s = shards_[h % num_shards_];
+    const auto first = (h / num_shards_) % shard_size_;
+
+    bool found = true;
+    {
+      std::lock_guard<std::mutex> lock(s.mutex);
+      if (const auto x = this->find(s, first, key)) {
+        if (!x->bypass) {
+          ++hits_;
+          return x->value;
+        }
+      } else {
+        found = false;
+      }
+    }
+
+    if (found) {
+      ++bypasses_;
+      return this->evaluate(p, t);
+    }
+
+    // Evaluates outside the lock so that other threads are not blocked
+    ++misses_;
+    const auto p_cell = std::exp(key.p * p_tol_);
+    const auto t_cell = key.t * t_tol_;
+    const auto bypass = this->is_two_phase_cell(p_cell, t_cell);
+    const auto value = this->evaluate(p_cell, t_cell);
+
+    {
+      std::lock_guard<std::mutex> lock(s.mutex);
+      if (!this->find(s, first, key)) {
+        this->insert(s, first, key, value, bypass);
+      }
+    }
+    return bypass ? this->evaluate(p, t) : value;
+  }
+
+  /// @brief Removes all the entries and resets counters
+  void clear() {
+    for (std::size_t i = 0; i < num_shards_; ++i) {
+      std::lock_guard<std::mutex> lock(shards_[i].mutex);
+      for (auto &x : shards_[i].slots) {
+        x.occupied = false;
+      }
+    }
+    hits_ = 0;
+    misses_ = 0;
+    bypasses_ = 0;
+    evictions_ = 0;
+  }
+
+  std::size_t hits() const noexcept { return hits_; }
+  std::size_t misses() const noexcept { return misses_; }
+  std::size_t evictions() const noexcept { return evictions_; }
+
+  /// @brief Returns the number of queries evaluated at the query point in
+  /// cells crossed by the saturation curve, except the first query of a cell
+  /// counted as a miss
+  std::size_t bypasses() const noexcept { return bypasses_; }
+
+  /// @brief Returns the ratio of hits to queries
+  double hit_rate() const noexcept {
+    const auto h = hits_.load();
+    const auto n = h + misses_.load();
+    return n > 0 ? static_cast<double>(h) / n : 0.0;
+  }
+
+  /// @brief Returns the maximum number of cached entries
+  std::size_t capacity() const noexcept { return num_shards_ * shard_size_; }
+
+ private:
+  static constexpr std::size_t probe_window = 8;
+  static constexpr double max_key = 1e18;
+
+  struct key_type {
+    std::int64_t p;
+    std::int64_t t;
+
+    bool operator==(const key_type &other) const noexcept {
+      return p == other.p && t == other.t;
+    }
+  };
+
+  struct slot {
+    key_type key;
+    cached_properties value;
+    bool occupied = false;
+    bool referenced = false;
+    bool bypass = false;  /// True if the cell is crossed by saturation
+  };
+
+  struct shard {
+    std::mutex mutex;
+    std::vector<slot> slots;
+    std::size_t hand = 0;  /// Position of the CLOCK hand in a window
+  };
+
+  static std::uint64_t hash(const key_type &key) noexcept {
+    // splitmix64 finalizer
+    auto x = static_cast<std::uint64_t>(key.p) * 0x9e3779b97f4a7c15ULL ^
+             static_cast<std::uint64_t>(key.t);
+    x ^= x >> 30;
+    x *= 0xbf58476d1ce4e5b9ULL;
+    x ^= x >> 27;
+    x *= 0x94d049bb133111ebULL;
+    x ^= x >> 31;
+    return x;
+  }
+
+  /// @brief Finds a key in the probe window and marks it referenced
+  slot *find(shard &s, std::size_t first, const key_type &key) const noexcept {
+    for (std::size_t k = 0; k < probe_window; ++k) {
+      auto &x = s.slots[(first + k) % shard_size_];
+      if (!x.occupied) {
+        // Slots are never emptied except by clear()
+        return nullptr;
+      }
+      if (x.key == key) {
+        x.referenced = true;
+        return &x;
+      }
+    }
+    return nullptr;
+  }
+
+  /// @brief Inserts an entry into an empty slot or the victim of CLOCK
+  void insert(shard &s, std::size_t first, const key_type &key,
+              const cached_properties &value, bool bypass) noexcept {
+    for (std::size_t k = 0; k < probe_window; ++k) {
+      auto &x = s.slots[(first + k) % shard_size_];
+      if (!x.occupied) {
+        x = {key, value, true, false, bypass};
+        return;
+      }
+    }
+    while (true) {
+      auto &x = s.slots[(first + s.hand) % shard_size_];
+      s.hand = (s.hand + 1) % probe_window;
+      if (x.referenced) {
+        x.referenced = false;
+      } else {
+        x = {key, value, true, false, bypass};
+        ++evictions_;
+        return;
+      }
+    }
+  }
+
+  /// @brief Returns true if the saturation curve crosses a cell
+  /// @param[in] p Pressure at the center of the cell
+  /// @param[in] t Temperature at the center of the cell
+  bool is_two_phase_cell(double p, double t) const noexcept {
+    const auto dp = std::exp(0.5 * p_tol_);
+    const auto dt = 0.5 * t_tol_;
+    return this->is_liquid_side(p * dp, t - dt) &&
+           !this->is_liquid_side(p / dp, t + dt);
+  }
+
+  /// @brief Returns true if the stable phase is on the liquid side of the
+  /// saturation curve
+  bool is_liquid_side(double p, double t) const noexcept {
+    const auto state = eos_.create_isobaric_isothermal_state(p, t);
+    std::array<double, 3> z;
+    const auto n = state.zfactor(z);
+    if (n < 2) {
+      const auto eq = CubicEos::zfactor_cubic_eq(
+          state.reduced_attraction_param(), state.reduced_repulsion_param());
+      return z[0] < -eq.a / 3;
+    }
+    return state.zfactor(root_selection::stable) == z[0];
+  }
+
+  /// @brief Evaluates properties of the stable phase
+  cached_properties evaluate(double p, double t) const noexcept {
+    const auto state = eos_.create_isobaric_isothermal_state(p, t);
+    const auto z = state.zfactor(root_selection::stable);
+    return {z, state.ln_fugacity_coeff(z), state.residual_enthalpy(z),
+            state.residual_entropy(z)};
+  }
+
+  CubicEos eos_;
+  double p_tol_;
+  double t_tol_;
+  std::size_t num_shards_;
+  std::size_t shard_size_;
+  std::unique_ptr<shard[]> shards_;
+  std::atomic<std::size_t> hits_;
+  std::atomic<std::size_t> misses_;
+  std::atomic<std::size_t> bypasses_;
+  std::atomic<std::size_t> evictions_;
+};
+
+/// @brief Makes property cache
+/// @param[in] eos EoS
+/// @param[in] capacity Maximum number of cached entries
+/// @param[in] p_tol Relative tolerance of pressure
+/// @param[in] t_tol Absolute tolerance of temperature [K]
+template <typename CubicEos>
+inline std::unique_ptr<property_cache<CubicEos>> make_property_cache(
+    const CubicEos &eos, std::size_t capacity, double p_tol, double t_tol) {
+  return std::make_unique<property_cache<CubicEos>>(eos, capacity, p_tol,
+                                                    t_tol);
+}
+
+}  // namespace eos
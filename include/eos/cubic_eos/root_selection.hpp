@@ -0,0 +1,43 @@
+#pragma once
+
+#include <array>  // std::array
+
+namespace eos {
+
+/// @brief Selection of a root when a cubic EoS has multiple roots
+enum class root_selection {
+  smallest,  /// Smallest Z-factor (liquid)
+  largest,   /// Largest Z-factor (vapor)
+  stable,    /// Z-factor of the smallest Gibbs energy
+};
+
+/// @brief Solves the cubic equation of Z-factor and selects a root
+/// @tparam Eos Cubic EoS
+/// @param[in] a Reduced attraction parameter
+/// @param[in] b Reduced repulsion parameter
+/// @param[in] selection Selection of a root
+template <typename Eos>
+inline double select_zfactor(double a, double b,
+                             root_selection selection) noexcept {
+  std::array<double, 3> z;
+  const auto n = Eos::zfactor_cubic_eq(a, b).real_roots(z);
+
+  if (n > 1) {
+    switch (selection) {
+      case root_selection::smallest:
+        break;
+      case root_selection::largest:
+        return z[n - 1];
+      case root_selection::stable:
+        // The smallest root may be below the covolume at low pressure
+        if (!(z[0] > b) || Eos::ln_fugacity_coeff(z[n - 1], a, b) <
+                               Eos::ln_fugacity_coeff(z[0], a, b)) {
+          return z[n - 1];
+        }
+        break;
+    }
+  }
+  return z[0];
+}
+
+}  // namespace eos
@@ -4,7 +4,10 @@
 #include <cmath>  // std::sqrt, std::exp, std::log
 
 #include "eos/cubic_eos/cubic_eos_base.hpp"  // eos::cubic_eos_base
-#include "eos/math/cubic_equation.hpp"       // eos::cubic_equation
+#include "eos/cubic_eos/thermodynamic_derivatives.hpp"
+#include "eos/math/cubic_equation.hpp"    // eos::cubic_equation
+#include "eos/math/quartic_equation.hpp"  // eos::quartic_equation
+#include "eos/math/vector_math.hpp"      // eos::standard_math
 
 namespace eos {
 
@@ -21,6 +24,9 @@ class soave_redlich_kwong_eos
     : public cubic_eos_base<soave_redlich_kwong_eos, true> {
  public:
   using base_type = cubic_eos_base<soave_redlich_kwong_eos, true>;
+  using base_type::derivatives;
+  using base_type::ln_fugacity_coeff;
+  using base_type::pressure;
 
   // Static functions
 
@@ -35,6 +41,42 @@ class soave_redlich_kwong_eos
     return R * t / (v - b) - a / (v * (v + b));
   }
 
+  /// @brief Computes the derivative of pressure with respect to volume at
+  /// constant temperature
+  /// @param[in] t Temperature
+  /// @param[in] v Volume
+  /// @param[in] a Attraction parameter
+  /// @param[in] b Repulsion parameter
+  static double pressure_derivative(double t, double v, double a,
+                                    double b) noexcept {
+    constexpr auto R = gas_constant<double>();
+    const auto vb = 1 / (v - b);
+    const auto d = v * (v + b);
+    return a * (2 * v + b) / (d * d) - R * t * vb * vb;
+  }
+
+  /// @brief Computes the integral of pressure with respect to volume at
+  /// constant temperature
+  /// @param[in] t Temperature
+  /// @param[in] v1 Lower bound of volume
+  /// @param[in] v2 Upper bound of volume
+  /// @param[in] a Attraction parameter
+  /// @param[in] b Repulsion parameter
+  static double pressure_integral(double t, double v1, double v2, double a,
+                                  double b) noexcept {
+    constexpr auto R = gas_constant<double>();
+    return R * t * std::log((v2 - b) / (v1 - b)) -
+           a / b * std::log(v2 * (v1 + b) / ((v2 + b) * v1));
+  }
+
+  /// @brief Computes coefficients of the quartic equation of spinodal volume
+  /// @param[in] k Dimensionless attraction parameter, \f$ a / (b R T) \f$
+  /// @returns Coefficients of the quartic equation of \f$ V / b \f$, whose
+  /// roots satisfy \f$ (\partial P / \partial V)_T = 0 \f$
+  static quartic_equation spinodal_quartic_eq(double k) noexcept {
+    return {2 - 2 * k, 1 + 3 * k, 0.0, -k};
+  }
+
   /// @brief Computes the coefficients of the cubic equation of z-factor.
   /// @param[in] a Reduced attraction parameter
   /// @param[in] b Reduced repulsion parameter
@@ -94,6 +136,38 @@ class soave_redlich_kwong_eos
     return R * t * (std::log(z - b) + a / b * std::log((z + b) / z));
   }
 
+  /// @brief Computes the attraction term shared by the fugacity coefficient,
+  /// residual enthalpy, entropy and Helmholtz energy
+  /// @tparam T Floating-point type
+  /// @param[in] z Z-factor
+  /// @param[in] a Reduced attraction parameter
+  /// @param[in] b Reduced repulsion parameter
+  ///
+  /// Together with \f$ \ln (Z - B) \f$, this gives
+  /// \f$ \ln \phi = Z - 1 - \ln (Z - B) - q \f$. Math provides the
+  /// logarithm, e.g., eos::branch_free_math in vectorized loops.
+  template <typename T, typename Math = standard_math>
+  static T attraction_term(T z, T a, T b) noexcept {
+    return a / b * Math::log((z + b) / z);
+  }
+
+  /// @brief Computes dimensionless derivatives of pressure and residual
+  /// isochoric heat capacity
+  /// @param[in] z Z-factor
+  /// @param[in] a Reduced attraction parameter
+  /// @param[in] b Reduced repulsion parameter
+  /// @param[in] beta Temperature correction factor
+  /// @param[in] gamma Second order temperature correction factor
+  static dimensionless_derivatives derivatives(double z, double a, double b,
+                                               double beta,
+                                               double gamma) noexcept {
+    const auto zb = 1 / (z - b);
+    const auto d = z * (z + b);
+    const auto ad = a / d;
+    return {ad * (2 * z + b) / d - zb * zb, zb - beta * ad,
+            gamma * a / b * std::log((z + b) / z)};
+  }
+
   // Constructors
 
   soave_redlich_kwong_eos() = default;
@@ -139,6 +213,15 @@ class soave_redlich_kwong_eos
     return -m_ * sqrt_tr / a;
   }
 
+  /// @brief Computes \f[ \gamma = \frac{T_r^2}{\alpha} \cdot
+  /// \frac{\mathrm{d}^2 \alpha}{\mathrm{d} T_r^2} \f]
+  /// @param[in] tr Reduced temperature
+  double gamma(double tr) const noexcept {
+    const auto sqrt_tr = std::sqrt(tr);
+    const auto a = 1 + m_ * (1 - sqrt_tr);
+    return m_ / (2 * a * a) * (m_ * tr + a * sqrt_tr);
+  }
+
  private:
   /// @brief Computes parameter \f$ m \f$ from acentric factor
   /// @param[in] omega Acentric factor
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <cmath>  // std::sqrt
+
+#include "eos/common/thermodynamic_constants.hpp"  // eos::gas_constant
+
+namespace eos {
+
+/// @brief Dimensionless derivatives computed by a cubic EoS
+///
+/// These are computed from Z-factor and reduced parameters, and shared by the
+/// calculation of heat capacities, speed of sound and Joule-Thomson
+/// coefficient.
+struct dimensionless_derivatives {
+  /// \f$ \frac{RT}{P^2} \left( \frac{\partial P}{\partial V} \right)_T \f$
+  double dpdv;
+  /// \f$ \frac{T}{P} \left( \frac{\partial P}{\partial T} \right)_V \f$
+  double dpdt;
+  /// Residual isochoric heat capacity divided by gas constant
+  double cv;
+};
+
+/// @brief Thermodynamic properties involving second derivatives
+struct thermodynamic_derivatives {
+  double dpdv;  /// Derivative of pressure w.r.t. volume [Pa-mol/m3]
+  double dpdt;  /// Derivative of pressure w.r.t. temperature [Pa/K]
+  double residual_isochoric_heat_capacity;  /// [J/mol-K]
+  double residual_isobaric_heat_capacity;   /// [J/mol-K]
+  double isochoric_heat_capacity;           /// [J/mol-K]
+  double isobaric_heat_capacity;            /// [J/mol-K]
+  double speed_of_sound;                    /// [m/s]
+  double joule_thomson_coeff;               /// [K/Pa]
+};
+
+/// @brief Makes thermodynamic derivatives from dimensionless derivatives
+/// @param[in] d Dimensionless derivatives
+/// @param[in] p Pressure [Pa]
+/// @param[in] t Temperature [K]
+/// @param[in] z Z-factor
+/// @param[in] cp Ideal gas isobaric heat capacity [J/mol-K]
+/// @param[in] mw Molecular weight [kg/kmol]
+inline thermodynamic_derivatives make_thermodynamic_derivatives(
+    const dimensionless_derivatives &d, double p, double t, double z,
+    double cp, double mw) noexcept {
+  constexpr auto R = gas_constant<double>();
+  // Cp - Cv = -T (dP/dT)^2 / (dP/dV), which is equal to R for ideal gas
+  const auto cv_res = R * d.cv;
+  const auto cp_res = cv_res - R * (d.dpdt * d.dpdt / d.dpdv + 1);
+  const auto cv_total = cp - R + cv_res;
+  const auto cp_total = cp + cp_res;
+
+  thermodynamic_derivatives x;
+  x.dpdv = p * p / (R * t) * d.dpdv;
+  x.dpdt = p / t * d.dpdt;
+  x.residual_isochoric_heat_capacity = cv_res;
+  x.residual_isobaric_heat_capacity = cp_res;
+  x.isochoric_heat_capacity = cv_total;
+  x.isobaric_heat_capacity = cp_total;
+  x.speed_of_sound =
+      std::sqrt(-z * z * R * t / (1e-3 * mw) * cp_total / cv_total * d.dpdv);
+  x.joule_thomson_coeff = -R * t / p * (d.dpdt / d.dpdv + z) / cp_total;
+  return x;
+}
+
+}  // namespace eos
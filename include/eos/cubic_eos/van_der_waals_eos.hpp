@@ -4,7 +4,10 @@
 #include <cmath>  // std::exp, std::log
 
 #include "eos/cubic_eos/cubic_eos_base.hpp"  // eos::cubic_eos_base
-#include "eos/math/cubic_equation.hpp"       // eos::cubic_equation
+#include "eos/cubic_eos/thermodynamic_derivatives.hpp"
+#include "eos/math/cubic_equation.hpp"    // eos::cubic_equation
+#include "eos/math/quartic_equation.hpp"  // eos::quartic_equation
+#include "eos/math/vector_math.hpp"      // eos::standard_math
 
 namespace eos {
 
@@ -20,6 +23,9 @@ struct cubic_eos_traits<van_der_waals_eos> {
 class van_der_waals_eos : public cubic_eos_base<van_der_waals_eos, false> {
  public:
   using base_type = cubic_eos_base<van_der_waals_eos, false>;
+  using base_type::derivatives;
+  using base_type::ln_fugacity_coeff;
+  using base_type::pressure;
 
   // Static Functions
 
@@ -33,6 +39,40 @@ class van_der_waals_eos : public cubic_eos_base<van_der_waals_eos, false> {
     return gas_constant<double>() * t / (v - b) - a / (v * v);
   }
 
+  /// @brief Computes the derivative of pressure with respect to volume at
+  /// constant temperature
+  /// @param[in] t Temperature
+  /// @param[in] v Volume
+  /// @param[in] a Attraction parameter
+  /// @param[in] b Repulsion parameter
+  static double pressure_derivative(double t, double v, double a,
+                                    double b) noexcept {
+    constexpr auto R = gas_constant<double>();
+    const auto vb = 1 / (v - b);
+    return 2 * a / (v * v * v) - R * t * vb * vb;
+  }
+
+  /// @brief Computes the integral of pressure with respect to volume at
+  /// constant temperature
+  /// @param[in] t Temperature
+  /// @param[in] v1 Lower bound of volume
+  /// @param[in] v2 Upper bound of volume
+  /// @param[in] a Attraction parameter
+  /// @param[in] b Repulsion parameter
+  static double pressure_integral(double t, double v1, double v2, double a,
+                                  double b) noexcept {
+    constexpr auto R = gas_constant<double>();
+    return R * t * std::log((v2 - b) / (v1 - b)) + a * (1 / v2 - 1 / v1);
+  }
+
+  /// @brief Computes coefficients of the quartic equation of spinodal volume
+  /// @param[in] k Dimensionless attraction parameter, \f$ a / (b R T) \f$
+  /// @returns Coefficients of the quartic equation of \f$ V / b \f$, whose
+  /// roots satisfy \f$ (\partial P / \partial V)_T = 0 \f$
+  static quartic_equation spinodal_quartic_eq(double k) noexcept {
+    return {-2 * k, 4 * k, -2 * k, 0.0};
+  }
+
   /// @brief Computes coefficients of the cubic equation of Z-factor
   /// @param[in] a Reduced attraction parameter
   /// @param[in] b Reduced repulsion parameter
@@ -88,6 +128,35 @@ class van_der_waals_eos : public cubic_eos_base<van_der_waals_eos, false> {
     return R * t * (std::log(z - b) + a / z);
   }
 
+  /// @brief Computes the attraction term shared by the fugacity coefficient,
+  /// residual enthalpy, entropy and Helmholtz energy
+  /// @tparam T Floating-point type
+  /// @param[in] z Z-factor
+  /// @param[in] a Reduced attraction parameter
+  /// @param[in] b Reduced repulsion parameter
+  ///
+  /// Together with \f$ \ln (Z - B) \f$, this gives
+  /// \f$ \ln \phi = Z - 1 - \ln (Z - B) - q \f$. Math provides the
+  /// logarithm, e.g., eos::branch_free_math in vectorized loops.
+  template <typename T, typename Math = standard_math>
+  static T attraction_term(T z, T a, [[maybe_unused]] T b) noexcept {
+    return a / z;
+  }
+
+  /// @brief Computes dimensionless derivatives of pressure and residual
+  /// isochoric heat capacity
+  /// @param[in] z Z-factor
+  /// @param[in] a Reduced attraction parameter
+  /// @param[in] b Reduced repulsion parameter
+  ///
+  /// The attraction parameter does not depend on temperature, and thus the
+  /// residual isochoric heat capacity is zero.
+  static dimensionless_derivatives derivatives(double z, double a,
+                                               double b) noexcept {
+    const auto zb = 1 / (z - b);
+    return {2 * a / (z * z * z) - zb * zb, zb, 0.0};
+  }
+
   van_der_waals_eos() = default;
 
   van_der_waals_eos(double pc, double tc) noexcept : base_type{pc, tc} {}
@@ -1,32 +1,20 @@
 #pragma once
 
 #include <algorithm>
+#include <array>
 #include <cassert>
 #include <cmath>
+#include <gsl/gsl>
+#include <tuple>
 #include <type_traits>
 #include <utility>
 
-namespace eos {
-
-/// @brief Estimates vapor pressure of a pure component by using Wilson
-/// equation.
-inline double estimate_vapor_pressure(double t, double pc, double tc,
-                                      double omega) noexcept {
-  assert(t <= tc);
-  return pc * std::pow(10, 7.0 / 3.0 * (1 + omega) * (1 - tc / t));
-}
-
-enum class flash_iteration_error {
-  success,
-  not_converged,
-  multiple_roots_not_found,
-};
+#include "eos/common/thermodynamic_constants.hpp"  // eos::gas_constant
+#include "eos/cubic_eos/flash_iteration_result.hpp"
+#include "eos/cubic_eos/vapor_pressure_estimator.hpp"
+#include "eos/interfacial_tension/parachor_ift.hpp"
 
-struct flash_iteration_result {
-  double rsd;                   /// Relative residual
-  int iter;                     /// Iteration count
-  flash_iteration_error error;  /// Error code
-};
+namespace eos {
 
 /// @brief vapor_liquid_flash calculation class
 template <typename CubicEos>
@@ -45,14 +33,14 @@ class vapor_liquid_flash {
   /// The default values of tolerance and maxixum iteration are 1e-6 and 100,
   /// respectively.
   vapor_liquid_flash(const CubicEos &eos)
-      : eos_{eos}, tol_{1e-6}, maxiter_{100} {}
+      : eos_{eos}, tol_{1e-6}, maxiter_{100}, guess_{} {}
 
   /// @brief Constructs flash object
   /// @param[in] eos EoS
   /// @param[in] tol Tolerance for vapor_liquid_flash calculation convergence
   /// @param[in] maxiter Maximum iteration
   vapor_liquid_flash(const CubicEos &eos, double tol, int maxiter)
-      : eos_{eos}, tol_{tol}, maxiter_{maxiter} {}
+      : eos_{eos}, tol_{tol}, maxiter_{maxiter}, guess_{} {}
 
   /// @brief Computes vapor pressure
   /// @param[in] p_init Initial pressure
@@ -60,28 +48,119 @@ class vapor_liquid_flash {
   /// @return A pair of vapor pressure and iteration report
   std::pair<double, flash_iteration_result> vapor_pressure(
       double p_init, double t) const noexcept {
-    auto p = p_init;
+    const auto s = this->saturation(p_init, t);
+    return {s.p, s.result};
+  }
+
+  /// @brief Computes vapor pressures at multiple temperatures
+  /// @param[in] p_init Initial pressures
+  /// @param[in] t Temperatures
+  /// @param[out] p Vapor pressures
+  /// @param[out] r Iteration reports
+  void vapor_pressure(gsl::span<const double> p_init,
+                      gsl::span<const double> t, gsl::span<double> p,
+                      gsl::span<flash_iteration_result> r) const noexcept {
+    assert(p_init.size() == t.size() && p_init.size() == p.size() &&
+           p_init.size() == r.size());
+    for (std::size_t i = 0; i < p.size(); ++i) {
+      std::tie(p[i], r[i]) = this->vapor_pressure(p_init[i], t[i]);
+    }
+  }
+
+  /// @brief Computes vapor pressures and interfacial tensions at multiple
+  /// temperatures
+  /// @param[in] p_init Initial pressures
+  /// @param[in] t Temperatures
+  /// @param[in] ift Parachor model of the component
+  /// @param[out] p Vapor pressures
+  /// @param[out] sigma Interfacial tensions [N/m]
+  /// @param[out] r Iteration reports
+  ///
+  /// Interfacial tension is computed from the Z-factors of the last
+  /// iteration in the same pass, without evaluating the EoS again. Points
+  /// not converged have zero vapor pressure and interfacial tension.
+  void vapor_pressure(gsl::span<const double> p_init,
+                      gsl::span<const double> t, const parachor_ift &ift,
+                      gsl::span<double> p, gsl::span<double> sigma,
+                      gsl::span<flash_iteration_result> r) const noexcept {
+    assert(p_init.size() == t.size() && p_init.size() == p.size() &&
+           p_init.size() == sigma.size() && p_init.size() == r.size());
+    for (std::size_t i = 0; i < p.size(); ++i) {
+      const auto s = this->saturation(p_init[i], t[i]);
+      p[i] = s.p;
+      r[i] = s.result;
+      sigma[i] = s.result.error == flash_iteration_error::success
+                     ? ift.interfacial_tension_from_zfactors(s.p_last, t[i],
+                                                             s.zl, s.zv)
+                     : 0.0;
+    }
+  }
+
+  /// @brief Computes vapor pressure from the initial guess of the estimator
+  /// @param[in] t Temperature
+  /// @return A pair of vapor pressure and iteration report
+  ///
+  /// Returns flash_iteration_error::initial_guess_not_set if the estimator
+  /// is not set by set_initial_guess().
+  std::pair<double, flash_iteration_result> vapor_pressure(
+      double t) const noexcept {
+    if (!guess_.valid()) {
+      return {0.0, {1.0, 0, flash_iteration_error::initial_guess_not_set}};
+    }
+    return this->vapor_pressure(guess_(t), t);
+  }
+
+  /// @brief Computes vapor pressures at multiple temperatures from the
+  /// initial guess of the estimator
+  /// @param[in] t Temperatures
+  /// @param[out] p Vapor pressures
+  /// @param[out] r Iteration reports
+  void vapor_pressure(gsl::span<const double> t, gsl::span<double> p,
+                      gsl::span<flash_iteration_result> r) const noexcept {
+    assert(t.size() == p.size() && t.size() == r.size());
+    for (std::size_t i = 0; i < p.size(); ++i) {
+      std::tie(p[i], r[i]) = this->vapor_pressure(t[i]);
+    }
+  }
+
+  /// @brief Computes saturation temperature
+  /// @param[in] t_init Initial temperature
+  /// @param[in] p Pressure
+  /// @return A pair of saturation temperature and iteration report
+  ///
+  /// Temperature is updated by Newton's method using
+  /// \f$ \partial \ln \phi / \partial T = -H^{res} / (R T^2) \f$.
+  std::pair<double, flash_iteration_result> saturation_temperature(
+      double t_init, double p) const noexcept {
+    constexpr auto R = gas_constant<double>();
+    auto t = t_init;
     double eps = 1.0;
     int iter = 0;
 
     while (eps > tol_ && iter < maxiter_) {
       const auto state = eos_.create_isobaric_isothermal_state(p, t);
-      const auto z = state.zfactor();
+      std::array<double, 3> z;
+      const auto n = state.zfactor(z);
 
-      if (z.size() < 2) {
+      if (n < 2) {
         return {0.0,
                 {eps, iter, flash_iteration_error::multiple_roots_not_found}};
       }
 
-      const auto zv = *std::max_element(z.begin(), z.end());
-      const auto zl = *std::min_element(z.begin(), z.end());
-      const auto phiv = state.fugacity_coeff(zv);
-      const auto phil = state.fugacity_coeff(zl);
+      const auto zv = z[n - 1];
+      const auto zl = z[0];
+      const auto f = state.ln_fugacity_coeff(zl) - state.ln_fugacity_coeff(zv);
+      const auto dfdt =
+          (state.residual_enthalpy(zv) - state.residual_enthalpy(zl)) /
+          (R * t * t);
 
-      eps = std::fabs(1.0 - phil / phiv);
+      eps = std::fabs(f);
 
-      // Update vapor pressure by successive substitution
-      p *= phil / phiv;
+      // Update saturation temperature by Newton's method with the step
+      // limited to 5% of temperature to damp overshoot. An iterate leaving
+      // the three-root region ends the iteration by the check above.
+      const auto dt = std::clamp(-f / dfdt, -0.05 * t, 0.05 * t);
+      t += dt;
 
       ++iter;
     }
@@ -89,7 +168,7 @@ class vapor_liquid_flash {
     if (iter >= maxiter_) {
       return {0.0, {eps, iter, flash_iteration_error::not_converged}};
     } else {
-      return {p, {eps, iter, flash_iteration_error::success}};
+      return {t, {eps, iter, flash_iteration_error::success}};
     }
   }
 
@@ -101,10 +180,70 @@ class vapor_liquid_flash {
     maxiter_ = maxiter;
   }
 
+  /// @brief Sets the estimator of the initial guess of vapor pressure
+  void set_initial_guess(const vapor_pressure_estimator &guess) {
+    guess_ = guess;
+  }
+
+  const vapor_pressure_estimator &initial_guess() const noexcept {
+    return guess_;
+  }
+
  private:
+  /// @brief Saturation point with Z-factors of the last iteration
+  struct saturation_point {
+    double p;       /// Vapor pressure
+    double p_last;  /// Pressure at which Z-factors are computed
+    double zl;      /// Z-factor of liquid
+    double zv;      /// Z-factor of vapor
+    flash_iteration_result result;
+  };
+
+  /// @brief Computes vapor pressure by successive substitution
+  /// @param[in] p_init Initial pressure
+  /// @param[in] t Temperature
+  saturation_point saturation(double p_init, double t) const noexcept {
+    auto p = p_init;
+    double eps = 1.0;
+    int iter = 0;
+    double p_last = p, zl = 0.0, zv = 0.0;
+
+    while (eps > tol_ && iter < maxiter_) {
+      const auto state = eos_.create_isobaric_isothermal_state(p, t);
+      std::array<double, 3> z;
+      const auto n = state.zfactor(z);
+
+      if (n < 2) {
+        return {0.0, p, 0.0, 0.0,
+                {eps, iter, flash_iteration_error::multiple_roots_not_found}};
+      }
+
+      zv = z[n - 1];
+      zl = z[0];
+      const auto phiv = state.fugacity_coeff(zv);
+      const auto phil = state.fugacity_coeff(zl);
+
+      eps = std::fabs(1.0 - phil / phiv);
+
+      // Update vapor pressure by successive substitution
+      p_last = p;
+      p *= phil / phiv;
+
+      ++iter;
+    }
+
+    if (iter >= maxiter_) {
+      return {0.0, p_last, zl, zv,
+              {eps, iter, flash_iteration_error::not_converged}};
+    } else {
+      return {p, p_last, zl, zv, {eps, iter, flash_iteration_error::success}};
+    }
+  }
+
   CubicEos eos_;
   double tol_;
   int maxiter_;
+  vapor_pressure_estimator guess_;  /// Estimator of the initial guess
 };
 
 template <typename CubicEos>
@@ -0,0 +1,288 @@
+#pragma once
+
+#include <algorithm>  // std::clamp, std::swap
+#include <array>      // std::array
+#include <cassert>    // assert
+#include <cmath>      // std::exp, std::floor, std::isfinite, std::log
+#include <cstddef>    // std::size_t
+#include <stdexcept>  // std::invalid_argument
+#include <utility>    // std::move
+#include <vector>     // std::vector
+
+#include "eos/cubic_eos/flash_iteration_result.hpp"
+
+namespace eos {
+
+/// @brief Estimates vapor pressure of a pure component by using Wilson
+/// equation.
+inline double estimate_vapor_pressure(double t, double pc, double tc,
+                                      double omega) noexcept {
+  assert(t <= tc);
+  return pc * std::pow(10, 7.0 / 3.0 * (1 + omega) * (1 - tc / t));
+}
+
+/// @brief Estimates saturation temperature of a pure component by using
+/// Wilson equation.
+inline double estimate_saturation_temperature(double p, double pc, double tc,
+                                              double omega) noexcept {
+  assert(p <= pc);
+  return tc / (1 - 3.0 / 7.0 * std::log10(p / pc) / (1 + omega));
+}
+
+/// @brief Estimates vapor pressure of a pure component by using Lee-Kesler
+/// correlation.
+///
+/// \f[ \ln P_r = f^{(0)} + \omega f^{(1)}, \f]
+/// \f[ f^{(0)} = 5.92714 - 6.09648 / T_r - 1.28862 \ln T_r + 0.169347 T_r^6,
+/// \f]
+/// \f[ f^{(1)} = 15.2518 - 15.6875 / T_r - 13.4721 \ln T_r + 0.43577 T_r^6.
+/// \f]
+inline double estimate_vapor_pressure_lee_kesler(double t, double pc,
+                                                 double tc,
+                                                 double omega) noexcept {
+  assert(t <= tc);
+  const auto tr = t / tc;
+  const auto inv_tr = 1 / tr;
+  const auto ln_tr = std::log(tr);
+  const auto tr6 = std::pow(tr, 6);
+  const auto f0 = 5.92714 - 6.09648 * inv_tr - 1.28862 * ln_tr + 0.169347 * tr6;
+  const auto f1 = 15.2518 - 15.6875 * inv_tr - 13.4721 * ln_tr + 0.43577 * tr6;
+  return pc * std::exp(f0 + omega * f1);
+}
+
+/// @brief Method of the initial guess of vapor pressure
+enum class vapor_pressure_guess {
+  wilson,              /// Wilson equation
+  lee_kesler,          /// Lee-Kesler correlation
+  fitted_correlation,  /// Correlation fitted to saturation points of the EoS
+  saturation_curve     /// Interpolation of saturation points of the EoS
+};
+
+/// @brief Initial guess of vapor pressure of a pure component
+///
+/// The fitted correlation is
+/// \f[ \ln P_r = c_0 + c_1 / T_r + c_2 \ln T_r + c_3 T_r^6, \f]
+/// which has the form of Lee-Kesler correlation, and the saturation curve is
+/// interpolated linearly on \f$ (1 / T_r, \ln P_r) \f$. Both are consistent
+/// with the EoS they are made from. The critical pressure is returned at and
+/// above the critical temperature.
+class vapor_pressure_estimator {
+ public:
+  vapor_pressure_estimator() = default;
+  vapor_pressure_estimator(const vapor_pressure_estimator &) = default;
+  vapor_pressure_estimator(vapor_pressure_estimator &&) = default;
+
+  vapor_pressure_estimator &operator=(const vapor_pressure_estimator &) =
+      default;
+  vapor_pressure_estimator &operator=(vapor_pressure_estimator &&) = default;
+
+  /// @brief Constructs estimator by a generalized correlation
+  /// @param[in] method Wilson equation or Lee-Kesler correlation
+  /// @param[in] pc Critical pressure
+  /// @param[in] tc Critical temperature
+  /// @param[in] omega Acentric factor
+  vapor_pressure_estimator(vapor_pressure_guess method, double pc, double tc,
+                           double omega) noexcept
+      : method_{method}, pc_{pc}, tc_{tc}, omega_{omega} {
+    assert(method == vapor_pressure_guess::wilson ||
+           method == vapor_pressure_guess::lee_kesler);
+  }
+
+  /// @brief Constructs estimator by a fitted correlation
+  /// @param[in] pc Critical pressure
+  /// @param[in] tc Critical temperature
+  /// @param[in] c Coefficients of the correlation
+  vapor_pressure_estimator(double pc, double tc,
+                           const std::array<double, 4> &c) noexcept
+      : method_{vapor_pressure_guess::fitted_correlation},
+        pc_{pc},
+        tc_{tc},
+        coeffs_{c} {}
+
+  /// @brief Constructs estimator by a saturation curve
+  /// @param[in] pc Critical pressure
+  /// @param[in] tc Critical temperature
+  /// @param[in] x0 The first node of \f$ 1 / T_r \f$
+  /// @param[in] dx Interval of nodes of \f$ 1 / T_r \f$
+  /// @param[in] ln_pr \f$ \ln P_r \f$ at nodes
+  vapor_pressure_estimator(double pc, double tc, double x0, double dx,
+                           std::vector<double> ln_pr)
+      : method_{vapor_pressure_guess::saturation_curve},
+        pc_{pc},
+        tc_{tc},
+        x0_{x0},
+        dx_{dx},
+        ln_pr_{std::move(ln_pr)} {
+    assert(ln_pr_.size() >= 2 && dx_ > 0);
+  }
+
+  /// @brief Estimates vapor pressure
+  /// @param[in] t Temperature
+  double operator()(double t) const noexcept {
+    assert(this->valid());
+    if (!(t < tc_)) {
+      return pc_;
+    }
+    switch (method_) {
+      case vapor_pressure_guess::wilson:
+        return estimate_vapor_pressure(t, pc_, tc_, omega_);
+      case vapor_pressure_guess::lee_kesler:
+        return estimate_vapor_pressure_lee_kesler(t, pc_, tc_, omega_);
+      case vapor_pressure_guess::fitted_correlation: {
+        const auto tr = t / tc_;
+        const auto &c = coeffs_;
+        return pc_ * std::exp(c[0] + c[1] / tr + c[2] * std::log(tr) +
+                              c[3] * std::pow(tr, 6));
+      }
+      default: {
+        // Linear extrapolation by the end segments outside the curve
+        const auto s = (tc_ / t - x0_) / dx_;
+        const auto n = static_cast<double>(ln_pr_.size() - 2);
+        const auto i =
+            static_cast<std::size_t>(std::clamp(std::floor(s), 0.0, n));
+        const auto w = s - static_cast<double>(i);
+        return pc_ * std::exp(ln_pr_[i] + w * (ln_pr_[i + 1] - ln_pr_[i]));
+      }
+    }
+  }
+
+  /// @brief Returns true if the estimator is constructed with parameters
+  bool valid() const noexcept { return tc_ > 0; }
+
+  vapor_pressure_guess method() const noexcept { return method_; }
+
+  /// @brief Returns coefficients of the fitted correlation
+  const std::array<double, 4> &coefficients() const noexcept {
+    return coeffs_;
+  }
+
+ private:
+  vapor_pressure_guess method_ = vapor_pressure_guess::wilson;
+  double pc_ = 0.0;                     /// Critical pressure
+  double tc_ = 0.0;                     /// Critical temperature
+  double omega_ = 0.0;                  /// Acentric factor
+  std::array<double, 4> coeffs_ = {};   /// Coefficients of the correlation
+  double x0_ = 0.0;                     /// The first node of 1 / Tr
+  double dx_ = 0.0;                     /// Interval of nodes of 1 / Tr
+  std::vector<double> ln_pr_;           /// ln(Pr) at nodes
+};
+
+/// @brief Computes saturation points of EoS by Maxwell's equal-area rule
+/// @param[in] eos EoS
+/// @param[in] tr_min Minimum reduced temperature
+/// @param[in] tr_max Maximum reduced temperature
+/// @param[in] n Number of points equally spaced in \f$ 1 / T_r \f$
+/// @return Pairs of \f$ 1 / T_r \f$ and \f$ \ln P_r \f$ in the descending
+/// order of temperature. Points are truncated at the first failure.
+/// @throw std::invalid_argument if the range of temperature is not in
+/// (0, 1) or n is less than 2
+template <typename CubicEos>
+std::vector<std::array<double, 2>> compute_saturation_points(
+    const CubicEos &eos, double tr_min, double tr_max, std::size_t n) {
+  if (!(0 < tr_min && tr_min < tr_max && tr_max < 1) || n < 2) {
+    throw std::invalid_argument("Invalid range of saturation points");
+  }
+  const auto pc = eos.critical_pressure();
+  const auto tc = eos.critical_temperature();
+  const auto x0 = 1 / tr_max;
+  const auto dx = (1 / tr_min - x0) / static_cast<double>(n - 1);
+  std::vector<std::array<double, 2>> points;
+  points.reserve(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    const auto x = x0 + static_cast<double>(i) * dx;
+    const auto [p, r] =
+        eos.create_isothermal_line(tc / x).saturation_pressure();
+    if (r.error != flash_iteration_error::success || !(p > 0)) {
+      break;
+    }
+    points.push_back({x, std::log(p / pc)});
+  }
+  return points;
+}
+
+/// @brief Fits a correlation of vapor pressure to saturation points of EoS
+/// @param[in] eos EoS
+/// @param[in] tr_min Minimum reduced temperature
+/// @param[in] n Number of saturation points
+///
+/// Coefficients are determined by the linear least squares.
+/// @throw std::invalid_argument if fewer than four saturation points are
+/// found, or the coefficients are not finite
+template <typename CubicEos>
+vapor_pressure_estimator fit_vapor_pressure_correlation(const CubicEos &eos,
+                                                        double tr_min = 0.45,
+                                                        std::size_t n = 24) {
+  const auto points = compute_saturation_points(eos, tr_min, 0.999, n);
+  if (points.size() < 4) {
+    throw std::invalid_argument("Too few saturation points to fit");
+  }
+
+  // Normal equations
+  double m[4][5] = {};
+  for (const auto &[x, y] : points) {
+    const auto tr = 1 / x;
+    const double f[4] = {1.0, x, std::log(tr), std::pow(tr, 6)};
+    for (int j = 0; j < 4; ++j) {
+      for (int k = 0; k < 4; ++k) {
+        m[j][k] += f[j] * f[k];
+      }
+      m[j][4] += f[j] * y;
+    }
+  }
+
+  // Gaussian elimination with partial pivoting
+  for (int j = 0; j < 4; ++j) {
+    int pivot = j;
+    for (int k = j + 1; k < 4; ++k) {
+      if (std::fabs(m[k][j]) > std::fabs(m[pivot][j])) {
+        pivot = k;
+      }
+    }
+    for (int l = 0; l < 5; ++l) {
+      std::swap(m[j][l], m[pivot][l]);
+    }
+    for (int k = j + 1; k < 4; ++k) {
+      const auto r = m[k][j] / m[j][j];
+      for (int l = j; l < 5; ++l) {
+        m[k][l] -= r * m[j][l];
+      }
+    }
+  }
+  std::array<double, 4> c;
+  for (int j = 3; j >= 0; --j) {
+    auto s = m[j][4];
+    for (int k = j + 1; k < 4; ++k) {
+      s -= m[j][k] * c[k];
+    }
+    c[j] = s / m[j][j];
+    if (!std::isfinite(c[j])) {
+      throw std::invalid_argument("Saturation points are degenerate");
+    }
+  }
+  return {eos.critical_pressure(), eos.critical_temperature(), c};
+}
+
+/// @brief Makes a saturation curve of EoS for the initial guess of vapor
+/// pressure
+/// @param[in] eos EoS
+/// @param[in] tr_min Minimum reduced temperature
+/// @param[in] n Number of nodes
+/// @throw std::invalid_argument if fewer than two saturation points are
+/// found
+template <typename CubicEos>
+vapor_pressure_estimator make_saturation_curve(const CubicEos &eos,
+                                               double tr_min = 0.45,
+                                               std::size_t n = 64) {
+  const auto points = compute_saturation_points(eos, tr_min, 0.999, n);
+  if (points.size() < 2) {
+    throw std::invalid_argument("Too few saturation points for a curve");
+  }
+  std::vector<double> ln_pr(points.size());
+  for (std::size_t i = 0; i < points.size(); ++i) {
+    ln_pr[i] = points[i][1];
+  }
+  return {eos.critical_pressure(), eos.critical_temperature(), points[0][0],
+          points[1][0] - points[0][0], std::move(ln_pr)};
+}
+
+}  // namespace eos
@@ -0,0 +1,136 @@
+#pragma once
+
+#include <cstddef>  // std::size_t
+#include <gsl/gsl>  // gsl::span
+#include <vector>   // std::vector
+
+#include "eos/common/thermodynamic_constants.hpp"  // eos::gas_constant
+#include "eos/cubic_eos/root_selection.hpp"
+
+namespace eos {
+
+/// @brief Diffusion coefficients of dense fluids by the correlation of
+/// Sigmund
+///
+/// The product of molar density and a binary diffusion coefficient is
+/// \f[ \frac{\rho D_{ij}}{\rho^0 D^0_{ij}} = 0.99589 + 0.096016 \rho_r -
+/// 0.22035 \rho_r^2 + 0.032874 \rho_r^3, \f]
+/// where \f$ \rho^0 D^0_{ij} \f$ is given by the Chapman-Enskog theory with
+/// the Lennard-Jones parameters estimated from critical properties, and the
+/// reduced density is
+/// \f[ \rho_r = \rho \frac{\sum_i x_i V_{c,i}^{5/3}}{\sum_i x_i V_{c,i}^{2/3}}.
+/// \f]
+/// Above \f$ \rho_r = 3 \f$ the exponential extrapolation of Whitson,
+/// \f$ 0.18839 \exp(3 - \rho_r) \f$, is used. The coefficient of a component
+/// in a mixture is given by the rule of Wilke,
+/// \f[ D_{i,m} = \frac{1 - x_i}{\sum_{j \neq i} x_j / D_{ij}}. \f]
+///
+/// Lennard-Jones parameters and the constant factors of the pairs are
+/// computed by the constructor. The pairs of the upper triangle are stored
+/// row by row in contiguous arrays. The loop over pairs is branch-free with
+/// the exponentials of eos::vector_math and is vectorized, and the rule of
+/// Wilke consumes the pairs a row at a time from a workspace of a row, so
+/// that the products of pairs are not written out for the whole triangle.
+class sigmund_diffusion {
+ public:
+  // Constructors
+
+  sigmund_diffusion() = default;
+
+  /// @brief Constructs object
+  /// @param[in] tc Critical temperatures [K]
+  /// @param[in] vc Critical volumes [m3/mol]
+  /// @param[in] zc Critical Z-factors
+  /// @param[in] mw Molecular weights [kg/kmol]
+  /// @throw std::invalid_argument if sizes of parameters mismatch
+  sigmund_diffusion(gsl::span<const double> tc, gsl::span<const double> vc,
+                    gsl::span<const double> zc, gsl::span<const double> mw);
+
+  sigmund_diffusion(const sigmund_diffusion &) = default;
+  sigmund_diffusion(sigmund_diffusion &&) = default;
+  sigmund_diffusion &operator=(const sigmund_diffusion &) = default;
+  sigmund_diffusion &operator=(sigmund_diffusion &&) = default;
+
+  // Member functions
+
+  /// @brief Computes binary diffusion coefficients
+  /// @param[in] t Temperature [K]
+  /// @param[in] rho Molar density [mol/m3]
+  /// @param[in] x Mole fractions
+  /// @param[out] d Diffusion coefficients of pairs [m2/s], stored as a
+  /// symmetric matrix in row-major order
+  void binary_coefficients(double t, double rho, gsl::span<const double> x,
+                           gsl::span<double> d) const;
+
+  /// @brief Computes diffusion coefficients of components in a mixture
+  /// @param[in] t Temperature [K]
+  /// @param[in] rho Molar density [mol/m3]
+  /// @param[in] x Mole fractions
+  /// @param[out] d Diffusion coefficients [m2/s], which are NaN for a
+  /// component without any other components
+  void effective_coefficients(double t, double rho, gsl::span<const double> x,
+                              gsl::span<double> d) const;
+
+  /// @brief Computes diffusion coefficients of components at the density of
+  /// an EoS
+  /// @tparam State Isobaric-isothermal state of an EoS
+  /// @param[in] state State of the pressure and temperature
+  /// @param[in] selection Selection of a root
+  /// @param[in] x Mole fractions
+  /// @param[out] d Diffusion coefficients [m2/s]
+  template <typename State>
+  void effective_coefficients(const State &state, root_selection selection,
+                              gsl::span<const double> x,
+                              gsl::span<double> d) const {
+    constexpr auto R = gas_constant<double>();
+    const auto t = state.temperature();
+    const auto z = state.zfactor(selection);
+    this->effective_coefficients(t, state.pressure() / (z * R * t), x, d);
+  }
+
+  /// @brief Computes diffusion coefficients of components at multiple points
+  /// @param[in] t Temperatures [K]
+  /// @param[in] rho Molar densities [mol/m3]
+  /// @param[in] x Mole fractions of the points, stored point by point
+  /// @param[out] d Diffusion coefficients, stored point by point
+  void effective_coefficients(gsl::span<const double> t,
+                              gsl::span<const double> rho,
+                              gsl::span<const double> x,
+                              gsl::span<double> d) const;
+
+  /// @brief Computes the ratio of the product of density and a diffusion
+  /// coefficient to that of dilute gas
+  /// @param[in] rho_r Reduced density
+  static double density_correction(double rho_r) noexcept;
+
+  /// @brief Returns the number of components
+  std::size_t num_components() const noexcept { return mw_.size(); }
+
+ private:
+  /// @brief Computes the products of density and diffusion coefficients of
+  /// dilute gas of consecutive pairs
+  /// @param[in] t Temperature [K]
+  /// @param[in] first Index of the first pair in the upper triangle
+  /// @param[out] rd Products of the pairs [mol/m-s]
+  void dilute_gas_products(double t, std::size_t first,
+                           gsl::span<double> rd) const noexcept;
+
+  /// @brief Computes diffusion coefficients of components in a mixture
+  /// @param[in] rd Workspace of at least the number of components
+  void effective_coefficients(double t, double rho, gsl::span<const double> x,
+                              gsl::span<double> rd,
+                              gsl::span<double> d) const noexcept;
+
+  /// @brief Computes reduced density
+  double reduced_density(double rho, gsl::span<const double> x) const
+      noexcept;
+
+  std::vector<double> mw_;    /// Molecular weights
+  std::vector<double> vc23_;  /// Critical volumes to the power of 2/3
+  std::vector<double> vc53_;  /// Critical volumes to the power of 5/3
+  std::vector<double> inv_eps_;  /// Inverse energy parameters of the pairs
+  std::vector<double> ln_eps_;   /// Logarithms of energy parameters
+  std::vector<double> factor_;   /// Constant factors of the pairs
+};
+
+}  // namespace eos
@@ -0,0 +1,274 @@
+#pragma once
+
+#include <cstddef>  // std::size_t
+#include <gsl/gsl>  // gsl::span
+#include <vector>   // std::vector
+
+namespace eos {
+
+/// @brief Term of the residual Helmholtz energy of a pure component,
+/// \f$ n \delta^d \tau^t \exp(-\delta^c) \f$, or a polynomial term if c = 0
+struct gerg_term {
+  double n;  /// Coefficient
+  int d;     /// Exponent of reduced density
+  double t;  /// Exponent of inverse reduced temperature
+  int c;     /// Exponent of reduced density in the exponential
+};
+
+/// @brief Term of a departure function,
+/// \f$ n \delta^d \tau^t \exp(-\eta (\delta - \epsilon)^2 - \beta (\delta -
+/// \gamma)) \f$, which is a polynomial term if eta and beta are zero
+struct gerg_departure_term {
+  double n;        /// Coefficient
+  int d;           /// Exponent of reduced density
+  double t;        /// Exponent of inverse reduced temperature
+  double eta;      /// Coefficient of the Gaussian part
+  double epsilon;  /// Center of the Gaussian part
+  double beta;     /// Coefficient of the exponential part
+  double gamma;    /// Offset of the exponential part
+};
+
+/// @brief Parameters of a component of GERG-2008
+struct gerg_component {
+  double tc;                     /// Critical temperature [K]
+  double rhoc;                   /// Critical density [mol/m3]
+  double pc;                     /// Critical pressure for initial guess [Pa]
+  double omega;                  /// Acentric factor for initial guess
+  std::vector<gerg_term> terms;  /// Terms of the residual Helmholtz energy
+};
+
+/// @brief Parameters of a binary of GERG-2008
+///
+/// Binaries not given use the combining rules with all the parameters of
+/// reducing functions equal to one and no departure function.
+struct gerg_binary {
+  std::size_t i;         /// Index of the first component
+  std::size_t j;         /// Index of the second component
+  double beta_v = 1.0;   /// Asymmetry parameter of reducing density
+  double gamma_v = 1.0;  /// Interaction parameter of reducing density
+  double beta_t = 1.0;   /// Asymmetry parameter of reducing temperature
+  double gamma_t = 1.0;  /// Interaction parameter of reducing temperature
+  double f = 0.0;        /// Weight of the departure function
+  std::vector<gerg_departure_term> departure;  /// Departure function
+};
+
+/// @brief Residual Helmholtz energy and its derivatives with respect to
+/// reduced density
+struct gerg_residual {
+  double a;    /// Residual Helmholtz energy divided by RT
+  double da;   /// delta times the first derivative
+  double d2a;  /// delta squared times the second derivative
+};
+
+class gerg2008_mixture;
+
+/// @brief GERG-2008 EoS at a composition and temperature
+///
+/// The products of coefficients, mole fractions and powers of inverse
+/// reduced temperature are computed by the constructor, so that a term at a
+/// reduced density is a power of integer exponent by repeated multiplication
+/// times an exponential shared by the terms of the same exponent.
+class gerg2008_isothermal_line {
+ public:
+  gerg2008_isothermal_line() = default;
+  gerg2008_isothermal_line(const gerg2008_isothermal_line &) = default;
+  gerg2008_isothermal_line(gerg2008_isothermal_line &&) = default;
+  gerg2008_isothermal_line &operator=(const gerg2008_isothermal_line &) =
+      default;
+  gerg2008_isothermal_line &operator=(gerg2008_isothermal_line &&) = default;
+
+  /// @param[in] mixture Mixture
+  /// @param[in] t Temperature [K]
+  gerg2008_isothermal_line(const gerg2008_mixture &mixture, double t);
+
+  /// @brief Computes residual Helmholtz energy at a reduced density
+  /// @param[in] delta Reduced density
+  gerg_residual evaluate(double delta) const noexcept;
+
+  /// @brief Computes pressure
+  /// @param[in] rho Molar density [mol/m3]
+  double pressure(double rho) const noexcept;
+
+  /// @brief Computes molar density by Newton's method
+  /// @param[in] p Pressure [Pa]
+  /// @param[in] rho_init Initial guess of molar density [mol/m3]
+  /// @return Molar density, or NaN if not converged
+  double density(double p, double rho_init) const noexcept;
+
+  /// @brief Returns temperature
+  double temperature() const noexcept { return t_; }
+
+ private:
+  /// @brief Polynomial or exponential term with the temperature part
+  struct term {
+    double k;  /// Coefficient times tau^t
+    int d;     /// Exponent of reduced density
+    int c;     /// Exponent of reduced density in the exponential
+  };
+
+  /// @brief Departure term with the temperature part
+  struct departure_term {
+    double k;  /// Coefficient times tau^t
+    int d;
+    double eta;
+    double epsilon;
+    double beta;
+    double gamma;
+  };
+
+  double t_;      /// Temperature
+  double rt_;     /// Gas constant times temperature
+  double rho_r_;  /// Reducing density
+  int max_d_;     /// Maximum exponent of reduced density
+  std::vector<int> exponents_;  /// Distinct exponents in the exponentials
+  std::vector<term> terms_;
+  std::vector<departure_term> departure_;
+};
+
+/// @brief GERG-2008 EoS at a composition
+///
+/// Reducing functions, the weights of terms and the pseudo-critical
+/// properties for the initial guess are computed by the constructor.
+class gerg2008_mixture {
+ public:
+  gerg2008_mixture() = default;
+  gerg2008_mixture(const gerg2008_mixture &) = default;
+  gerg2008_mixture(gerg2008_mixture &&) = default;
+  gerg2008_mixture &operator=(const gerg2008_mixture &) = default;
+  gerg2008_mixture &operator=(gerg2008_mixture &&) = default;
+
+  /// @brief Creates isothermal line
+  /// @param[in] t Temperature [K]
+  gerg2008_isothermal_line create_isothermal_line(double t) const {
+    return {*this, t};
+  }
+
+  /// @brief Computes molar density starting from the stable root of
+  /// Peng-Robinson EoS of the pseudo-critical properties
+  /// @param[in] p Pressure [Pa]
+  /// @param[in] t Temperature [K]
+  /// @return Molar density [mol/m3], or NaN if not converged
+  double density(double p, double t) const;
+
+  /// @brief Computes Z-factor
+  /// @param[in] p Pressure [Pa]
+  /// @param[in] t Temperature [K]
+  double zfactor(double p, double t) const;
+
+  /// @brief Computes molar densities at multiple points
+  /// @param[in] p Pressures
+  /// @param[in] t Temperatures
+  /// @param[out] rho Molar densities
+  ///
+  /// The isothermal line is rebuilt only when temperature changes between
+  /// consecutive points.
+  void density(gsl::span<const double> p, gsl::span<const double> t,
+               gsl::span<double> rho) const;
+
+  /// @brief Computes Z-factors at multiple points
+  /// @param[in] p Pressures
+  /// @param[in] t Temperatures
+  /// @param[out] z Z-factors
+  void zfactor(gsl::span<const double> p, gsl::span<const double> t,
+               gsl::span<double> z) const;
+
+  /// @brief Returns reducing temperature [K]
+  double reducing_temperature() const noexcept { return t_r_; }
+
+  /// @brief Returns reducing density [mol/m3]
+  double reducing_density() const noexcept { return rho_r_; }
+
+ private:
+  friend class gerg2008_eos;
+  friend class gerg2008_isothermal_line;
+
+  /// @brief Computes initial guess of density by Peng-Robinson EoS
+  double initial_density(double p, double t) const;
+
+  double t_r_;    /// Reducing temperature
+  double rho_r_;  /// Reducing density
+  double pc_;     /// Pseudo-critical pressure
+  double tc_;     /// Pseudo-critical temperature
+  double omega_;  /// Pseudo acentric factor
+  std::vector<gerg_term> terms_;  /// Terms weighted by mole fractions
+  std::vector<gerg_departure_term> departure_;  /// Weighted departure terms
+};
+
+/// @brief GERG-2008 multiparameter EoS of Kunz and Wagner for natural gases
+///
+/// The reduced residual Helmholtz energy of a mixture is
+/// \f[ \alpha^r = \sum_i x_i \alpha^r_{oi}(\delta, \tau) + \sum_{i < j} x_i
+/// x_j F_{ij} \alpha^r_{ij}(\delta, \tau), \f]
+/// where \f$ \delta = \rho / \rho_r(x) \f$ and \f$ \tau = T_r(x) / T \f$ with
+/// the reducing functions
+/// \f[ T_r = \sum_i x_i^2 T_{c,i} + \sum_{i < j} 2 x_i x_j \beta_{T,ij}
+/// \gamma_{T,ij} \frac{x_i + x_j}{\beta_{T,ij}^2 x_i + x_j} (T_{c,i}
+/// T_{c,j})^{1/2}, \f]
+/// \f[ \frac{1}{\rho_r} = \sum_i \frac{x_i^2}{\rho_{c,i}} + \sum_{i < j} 2
+/// x_i x_j \beta_{v,ij} \gamma_{v,ij} \frac{x_i + x_j}{\beta_{v,ij}^2 x_i +
+/// x_j} \frac{1}{8} \left( \rho_{c,i}^{-1/3} + \rho_{c,j}^{-1/3}
+/// \right)^3. \f]
+/// Parameters of components and binaries are given by the caller, or by
+/// make_gerg2008_eos of eos/gerg/gerg2008_parameters.hpp.
+class gerg2008_eos {
+ public:
+  /// @brief Maximum exponent of reduced density
+  static constexpr int max_exponent = 12;
+
+  gerg2008_eos() = default;
+  gerg2008_eos(const gerg2008_eos &) = default;
+  gerg2008_eos(gerg2008_eos &&) = default;
+  gerg2008_eos &operator=(const gerg2008_eos &) = default;
+  gerg2008_eos &operator=(gerg2008_eos &&) = default;
+
+  /// @brief Constructs EoS
+  /// @param[in] components Parameters of components
+  /// @param[in] binaries Parameters of binaries
+  /// @throw std::invalid_argument if a binary refers to an invalid pair, or
+  /// an exponent of reduced density is out of [0, max_exponent]
+  gerg2008_eos(std::vector<gerg_component> components,
+               std::vector<gerg_binary> binaries);
+
+  /// @brief Creates mixture of a composition
+  /// @param[in] x Mole fractions
+  gerg2008_mixture create_mixture(gsl::span<const double> x) const;
+
+  /// @brief Computes natural logarithms of fugacity coefficients
+  /// @param[in] x Mole fractions
+  /// @param[in] p Pressure [Pa]
+  /// @param[in] t Temperature [K]
+  /// @param[out] ln_phi Logarithms of fugacity coefficients, or NaN if
+  /// density is not converged
+  /// @throw std::invalid_argument if sizes of x and ln_phi mismatch
+  ///
+  /// The coefficients are
+  /// \f[ \ln \phi_i = \alpha^r + \delta \alpha^r_\delta \left( 1 +
+  /// \frac{\hat{\partial}_i v_r}{v_r} \right) + \tau \alpha^r_\tau
+  /// \frac{\hat{\partial}_i T_r}{T_r} + \hat{\partial}_i \alpha^r - \ln Z,
+  /// \f]
+  /// where \f$ v_r = 1 / \rho_r \f$ and \f$ \hat{\partial}_i y =
+  /// \partial y / \partial x_i - \sum_k x_k \partial y / \partial x_k \f$
+  /// is the derivative of Kunz and Wagner at constant reduced density and
+  /// temperature. Components of zero mole fractions give the coefficients at
+  /// infinite dilution.
+  void ln_fugacity_coeffs(gsl::span<const double> x, double p, double t,
+                          gsl::span<double> ln_phi) const;
+
+  /// @brief Returns the number of components
+  std::size_t num_components() const noexcept { return components_.size(); }
+
+ private:
+  /// @brief Parameters of reducing functions of a pair
+  struct pair_params {
+    double beta_v;
+    double gamma_v;
+    double beta_t;
+    double gamma_t;
+  };
+
+  std::vector<gerg_component> components_;
+  std::vector<gerg_binary> binaries_;
+  std::vector<pair_params> pairs_;  /// Parameters of (i, j) at i * n + j
+};
+
+}  // namespace eos
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstddef>  // std::size_t
+#include <vector>   // std::vector
+
+#include "eos/gerg/gerg2008.hpp"
+
+namespace eos {
+
+/// @brief Components of GERG-2008 in the order of AGA Report No. 8 Part 2,
+/// which are indices of mole fractions of make_gerg2008_eos
+enum class gerg_species : std::size_t {
+  methane,
+  nitrogen,
+  carbon_dioxide,
+  ethane,
+  propane,
+  isobutane,
+  n_butane,
+  isopentane,
+  n_pentane,
+  n_hexane,
+  n_heptane,
+  n_octane,
+  n_nonane,
+  n_decane,
+  hydrogen,
+  oxygen,
+  carbon_monoxide,
+  water,
+  hydrogen_sulfide,
+  helium,
+  argon,
+};
+
+/// @brief Number of components of GERG-2008
+constexpr std::size_t num_gerg_species = 21;
+
+/// @brief Returns parameters of the components of GERG-2008
+///
+/// Critical properties and the terms of the residual Helmholtz energy are
+/// those of Kunz and Wagner (2012), with critical densities converted to
+/// mol/m3. Critical pressures and acentric factors are only used for the
+/// initial guess of density.
+std::vector<gerg_component> gerg2008_components();
+
+/// @brief Returns parameters of the binaries of GERG-2008
+///
+/// Parameters of reducing functions of all the 210 binaries are those of
+/// Kunz and Wagner (2012), with unity for the binaries without adjusted
+/// parameters. Departure functions are the specific functions of methane
+/// with nitrogen, carbon dioxide, ethane, propane and hydrogen and of
+/// nitrogen with carbon dioxide and ethane, and the generalized function of
+/// the other binaries of methane, ethane, propane, isobutane and n-butane.
+std::vector<gerg_binary> gerg2008_binaries();
+
+/// @brief Makes GERG-2008 EoS of the components of gerg_species
+inline gerg2008_eos make_gerg2008_eos() {
+  return {gerg2008_components(), gerg2008_binaries()};
+}
+
+}  // namespace eos
@@ -0,0 +1,106 @@
+#pragma once
+
+#include <array>  // std::array
+#include <cmath>  // std::log
+
+#include "eos/common/thermodynamic_constants.hpp"  // eos::gas_constant
+
+namespace eos {
+
+/// @brief Ideal gas isobaric heat capacity given by a polynomial of
+/// temperature
+///
+/// \f[ \frac{C_p^{ig}}{R} = a_0 + a_1 T + a_2 T^2 + a_3 T^3 + a_4 T^4 \f]
+///
+/// This is the form used in Appendix A of Poling et al. 2001. "The Properties
+/// of Gases and Liquids", fifth edition. Enthalpy and entropy are measured from
+/// the ideal gas at the reference temperature and pressure.
+class ideal_gas_heat_capacity {
+ public:
+  /// Reference temperature [K]
+  static constexpr double reference_temperature = 298.15;
+  /// Reference pressure [Pa]
+  static constexpr double reference_pressure = 101325.0;
+
+  // Constructors
+
+  ideal_gas_heat_capacity() = default;
+
+  /// @brief Constructs ideal gas heat capacity
+  /// @param[in] a0 Constant coefficient
+  /// @param[in] a1 Coefficient of \f$ T \f$ [1/K]
+  /// @param[in] a2 Coefficient of \f$ T^2 \f$ [1/K^2]
+  /// @param[in] a3 Coefficient of \f$ T^3 \f$ [1/K^3]
+  /// @param[in] a4 Coefficient of \f$ T^4 \f$ [1/K^4]
+  ideal_gas_heat_capacity(double a0, double a1, double a2, double a3,
+                          double a4) noexcept
+      : a_{a0, a1, a2, a3, a4} {}
+
+  ideal_gas_heat_capacity(const ideal_gas_heat_capacity &) = default;
+  ideal_gas_heat_capacity(ideal_gas_heat_capacity &&) = default;
+
+  ideal_gas_heat_capacity &operator=(const ideal_gas_heat_capacity &) =
+      default;
+  ideal_gas_heat_capacity &operator=(ideal_gas_heat_capacity &&) = default;
+
+  // Member functions
+
+  /// @brief Computes isobaric heat capacity [J/mol-K]
+  /// @param[in] t Temperature [K]
+  double isobaric_heat_capacity(double t) const noexcept {
+    constexpr auto R = gas_constant<double>();
+    return R * (a_[0] + t * (a_[1] + t * (a_[2] + t * (a_[3] + t * a_[4]))));
+  }
+
+  /// @brief Computes enthalpy [J/mol]
+  /// @param[in] t Temperature [K]
+  double enthalpy(double t) const noexcept {
+    constexpr auto R = gas_constant<double>();
+    return R * (this->enthalpy_integral(t) -
+                this->enthalpy_integral(reference_temperature));
+  }
+
+  /// @brief Computes entropy [J/mol-K]
+  /// @param[in] p Pressure [Pa]
+  /// @param[in] t Temperature [K]
+  double entropy(double p, double t) const noexcept {
+    constexpr auto R = gas_constant<double>();
+    return R * (this->entropy_integral(t) -
+                this->entropy_integral(reference_temperature) -
+                std::log(p / reference_pressure));
+  }
+
+ private:
+  /// @brief Computes the indefinite integral of \f$ C_p^{ig} / R \f$
+  /// @param[in] t Temperature [K]
+  double enthalpy_integral(double t) const noexcept {
+    return t * (a_[0] +
+                t * (a_[1] / 2 +
+                     t * (a_[2] / 3 + t * (a_[3] / 4 + t * a_[4] / 5))));
+  }
+
+  /// @brief Computes the indefinite integral of \f$ C_p^{ig} / (R T) \f$
+  /// @param[in] t Temperature [K]
+  double entropy_integral(double t) const noexcept {
+    return a_[0] * std::log(t) +
+           t * (a_[1] + t * (a_[2] / 2 + t * (a_[3] / 3 + t * a_[4] / 4)));
+  }
+
+  std::array<double, 5> a_;  /// Coefficients of the polynomial
+};
+
+/// @brief Makes ideal gas heat capacity
+/// @param[in] a0 Constant coefficient
+/// @param[in] a1 Coefficient of \f$ T \f$ [1/K]
+/// @param[in] a2 Coefficient of \f$ T^2 \f$ [1/K^2]
+/// @param[in] a3 Coefficient of \f$ T^3 \f$ [1/K^3]
+/// @param[in] a4 Coefficient of \f$ T^4 \f$ [1/K^4]
+inline ideal_gas_heat_capacity make_ideal_gas_heat_capacity(double a0,
+                                                            double a1,
+                                                            double a2,
+                                                            double a3,
+                                                            double a4) {
+  return {a0, a1, a2, a3, a4};
+}
+
+}  // namespace eos
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <cassert>  // assert
+#include <gsl/gsl>  // gsl::span
+#include <vector>   // std::vector
+
+#include "eos/common/thermodynamic_constants.hpp"  // eos::gas_constant
+
+namespace eos {
+
+/// @brief Interfacial tension between vapor and liquid by parachors
+///
+/// The interfacial tension of a pure component is given by the equation of
+/// Macleod and Sugden,
+/// \f[ \sigma^{1/4} = P (\rho_L - \rho_V), \f]
+/// and that of a mixture by the extension of Weinaug and Katz,
+/// \f[ \sigma^{1/4} = \sum_i P_i (x_i \rho_L - y_i \rho_V), \f]
+/// where parachors are in the customary units of
+/// \f$ (\mathrm{cm^3/mol}) (\mathrm{mN/m})^{1/4} \f$.
+class parachor_ift {
+ public:
+  parachor_ift() = default;
+
+  /// @brief Constructs object of a pure component
+  /// @param[in] parachor Parachor
+  explicit parachor_ift(double parachor) : parachors_{parachor} {}
+
+  /// @brief Constructs object of a mixture
+  /// @param[in] parachors Parachors of components
+  explicit parachor_ift(gsl::span<const double> parachors)
+      : parachors_(parachors.begin(), parachors.end()) {}
+
+  parachor_ift(const parachor_ift &) = default;
+  parachor_ift(parachor_ift &&) = default;
+  parachor_ift &operator=(const parachor_ift &) = default;
+  parachor_ift &operator=(parachor_ift &&) = default;
+
+  /// @brief Computes interfacial tension of a pure component
+  /// @param[in] rho_l Molar density of liquid [mol/m3]
+  /// @param[in] rho_v Molar density of vapor [mol/m3]
+  /// @return Interfacial tension [N/m]
+  double interfacial_tension(double rho_l, double rho_v) const noexcept {
+    assert(parachors_.size() == 1);
+    return to_tension(parachors_[0] * (rho_l - rho_v));
+  }
+
+  /// @brief Computes interfacial tension of a mixture
+  /// @param[in] rho_l Molar density of liquid [mol/m3]
+  /// @param[in] rho_v Molar density of vapor [mol/m3]
+  /// @param[in] x Mole fractions of liquid
+  /// @param[in] y Mole fractions of vapor
+  /// @return Interfacial tension [N/m]
+  double interfacial_tension(double rho_l, double rho_v,
+                             gsl::span<const double> x,
+                             gsl::span<const double> y) const noexcept {
+    assert(x.size() == parachors_.size() && y.size() == parachors_.size());
+    double sum = 0.0;
+    for (std::size_t i = 0; i < parachors_.size(); ++i) {
+      sum += parachors_[i] * (x[i] * rho_l - y[i] * rho_v);
+    }
+    return to_tension(sum);
+  }
+
+  /// @brief Computes interfacial tension of a pure component from Z-factors
+  /// @param[in] p Pressure [Pa]
+  /// @param[in] t Temperature [K]
+  /// @param[in] zl Z-factor of liquid
+  /// @param[in] zv Z-factor of vapor
+  /// @return Interfacial tension [N/m]
+  double interfacial_tension_from_zfactors(double p, double t, double zl,
+                                           double zv) const noexcept {
+    constexpr auto R = gas_constant<double>();
+    const auto c = p / (R * t);
+    return this->interfacial_tension(c / zl, c / zv);
+  }
+
+  /// @brief Returns the number of components
+  std::size_t num_components() const noexcept { return parachors_.size(); }
+
+ private:
+  /// @brief Converts the sum of parachors times densities [mol/m3] to
+  /// interfacial tension [N/m]
+  static double to_tension(double s) noexcept {
+    // Densities in mol/cm3 give interfacial tension in mN/m
+    const auto x = s * 1e-6;
+    const auto x2 = x * x;
+    return 1e-3 * x2 * x2;
+  }
+
+  std::vector<double> parachors_;  /// Parachors of components
+};
+
+}  // namespace eos
@@ -31,8 +31,19 @@ class cubic_equation {
   /// @brief Computes real roots in the ascending order
   std::vector<double> real_roots() const;
 
+  /// @brief Computes real roots in the ascending order without allocation
+  /// @param[out] x Real roots. Only the first n elements are valid.
+  /// @returns The number of real roots, n
+  std::size_t real_roots(std::array<double, 3>& x) const noexcept;
+
   /// @brief Computes complex roots
   std::array<std::complex<double>, 3> complex_roots() const;
+
+  /// @brief Computes the discriminant
+  ///
+  /// The equation has three distinct real roots if the discriminant is
+  /// positive, a multiple root if zero, and one real root if negative.
+  double discriminant() const noexcept;
 };
 
 }  // namespace eos
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <array>
+
+namespace eos {
+
+/// @brief Quartic equation
+///
+/// \f[ x^4 + a x^3 + b x^2 + c x + d = 0 \f]
+class quartic_equation {
+ public:
+  /// @{
+  /// @name Coefficients
+
+  double a;
+  double b;
+  double c;
+  double d;
+  /// @}
+
+  quartic_equation() = default;
+  quartic_equation(const quartic_equation&) = default;
+  quartic_equation(quartic_equation&&) = default;
+
+  quartic_equation(double a_, double b_, double c_, double d_)
+      : a{a_}, b{b_}, c{c_}, d{d_} {}
+
+  quartic_equation& operator=(const quartic_equation&) = default;
+  quartic_equation& operator=(quartic_equation&&) = default;
+
+  /// @brief Computes real roots in the ascending order by Ferrari's method
+  /// @param[out] x Real roots. Only the first n elements are valid.
+  /// @returns The number of real roots, n
+  std::size_t real_roots(std::array<double, 4>& x) const noexcept;
+};
+
+}  // namespace eos
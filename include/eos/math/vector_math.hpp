@@ -0,0 +1,345 @@
+#pragma once
+
+#include <cmath>        // std::log, std::sqrt
+#include <cstdint>      // std::uint32_t, std::uint64_t
+#include <cstring>      // std::memcpy
+#include <limits>       // std::numeric_limits
+#include <type_traits>  // std::enable_if_t, std::is_floating_point_v
+
+/// Functions called in vectorized loops are always inlined, because a loop
+/// with a call is not vectorized.
+#if defined(__GNUC__)
+#define EOS_VECTOR_INLINE inline __attribute__((always_inline))
+#elif defined(_MSC_VER)
+#define EOS_VECTOR_INLINE __forceinline
+#else
+#define EOS_VECTOR_INLINE inline
+#endif
+
+namespace eos {
+
+/// @brief Branch-free elementary functions
+///
+/// The functions are written with arithmetic, bit operations and selections
+/// only, and without calls to the standard library except for square root,
+/// so that loops calling them can be vectorized by the compiler. GCC
+/// vectorizes square root only without errno and converts conditional
+/// expressions to selections only without trapping math. The library builds
+/// its sources with -fno-math-errno -fno-trapping-math, but keeps the flags
+/// private, so translation units that include the header-only loops, such
+/// as eos/cubic_eos/mixed_precision.hpp, need the flags to be vectorized.
+/// Conditions are combined by & instead of && and selections are not
+/// nested, because GCC does not convert a join of more than two branches. The accuracy is within a few
+/// units in the last place for finite arguments.
+namespace vector_math {
+
+namespace detail {
+
+template <typename T>
+struct float_traits;
+
+template <>
+struct float_traits<double> {
+  using uint_type = std::uint64_t;
+  static constexpr int mantissa_bits = 52;
+  static constexpr uint_type mantissa_mask = 0x000fffffffffffffULL;
+  static constexpr uint_type exponent_bias = 1023;
+  /// 1.5 * 2^52, adding which rounds to an integer
+  static constexpr double shifter = 6755399441055744.0;
+  /// Range of the argument of exp beyond which exp overflows or underflows
+  static constexpr double exp_min = -746.0;
+  static constexpr double exp_max = 710.0;
+  /// ln 2 split so that the product of the high part and an integer is exact
+  static constexpr double ln2_hi = 6.93145751953125e-1;
+  static constexpr double ln2_lo = 1.42860682030941723212e-6;
+};
+
+template <>
+struct float_traits<float> {
+  using uint_type = std::uint32_t;
+  static constexpr int mantissa_bits = 23;
+  static constexpr uint_type mantissa_mask = 0x007fffffU;
+  static constexpr uint_type exponent_bias = 127;
+  static constexpr float shifter = 12582912.0f;
+  static constexpr float exp_min = -104.0f;
+  static constexpr float exp_max = 89.0f;
+  static constexpr float ln2_hi = 6.93359375e-1f;
+  static constexpr float ln2_lo = -2.12194440e-4f;
+};
+
+template <typename T>
+EOS_VECTOR_INLINE typename float_traits<T>::uint_type to_bits(T x) noexcept {
+  typename float_traits<T>::uint_type i;
+  std::memcpy(&i, &x, sizeof(T));
+  return i;
+}
+
+template <typename T>
+EOS_VECTOR_INLINE T from_bits(typename float_traits<T>::uint_type i) noexcept {
+  T x;
+  std::memcpy(&x, &i, sizeof(T));
+  return x;
+}
+
+/// @brief Computes 2^k for an integer k in the range of normal numbers
+template <typename T>
+EOS_VECTOR_INLINE T exp2_int(T k) noexcept {
+  using traits = float_traits<T>;
+  // The low bits of the shifted number hold k in two's complement
+  const auto i = to_bits<T>(k + traits::shifter);
+  return from_bits<T>((i << traits::mantissa_bits) +
+                      (traits::exponent_bias << traits::mantissa_bits));
+}
+
+/// @brief Computes sine and cosine of \f$ |x| \le \pi / 4 \f$
+template <typename T>
+EOS_VECTOR_INLINE void sin_cos_kernel(T x, T &s, T &c) noexcept {
+  const auto z = x * x;
+  const auto ps =
+      T(-1.66666666666666324348e-01) +
+      z * (T(8.33333333332248946124e-03) +
+           z * (T(-1.98412698298579493134e-04) +
+                z * (T(2.75573137070700676789e-06) +
+                     z * (T(-2.50507602534068634195e-08) +
+                          z * T(1.58969099521155010221e-10)))));
+  const auto pc =
+      T(4.16666666666666019037e-02) +
+      z * (T(-1.38888888888741095749e-03) +
+           z * (T(2.48015872894767294178e-05) +
+                z * (T(-2.75573143513906633035e-07) +
+                     z * (T(2.08757232129817482790e-09) +
+                          z * T(-1.13596475577881948265e-11)))));
+  s = x + x * z * ps;
+  c = 1 - T(0.5) * z + z * z * pc;
+}
+
+/// @brief Computes the rational function of the arc cosine of fdlibm
+template <typename T>
+EOS_VECTOR_INLINE T acos_ratio(T z) noexcept {
+  const auto p =
+      z * (T(1.66666666666666657415e-01) +
+           z * (T(-3.25565818622400915405e-01) +
+                z * (T(2.01212532134862925881e-01) +
+                     z * (T(-4.00555345006794114027e-02) +
+                          z * (T(7.91534994289814532176e-04) +
+                               z * T(3.47933107596021167570e-05))))));
+  const auto q = 1 + z * (T(-2.40339491173441421878e+00) +
+                          z * (T(2.02094576023350569471e+00) +
+                               z * (T(-6.88283971605453293030e-01) +
+                                    z * T(7.70381505559019352791e-02))));
+  return p / q;
+}
+
+/// @brief Computes the natural logarithm of \f$ 2^{-n} x \f$ for a positive
+/// normal number, x, without checking special values
+template <typename T>
+EOS_VECTOR_INLINE T log_normal(T x, T n = T(0)) noexcept {
+  using traits = float_traits<T>;
+  using uint_type = typename traits::uint_type;
+  constexpr auto two_mantissa = T(uint_type{1} << traits::mantissa_bits);
+  const auto i = to_bits(x);
+
+  // The biased exponent as a floating-point number
+  const auto e = from_bits<T>((i >> traits::mantissa_bits) |
+                              to_bits(two_mantissa)) -
+                 two_mantissa;
+  auto k = e - T(traits::exponent_bias) - n;
+  auto m = from_bits<T>((i & traits::mantissa_mask) |
+                        (traits::exponent_bias << traits::mantissa_bits));
+  const auto large = m > T(1.41421356237309504880);
+  m = large ? T(0.5) * m : m;
+  k = large ? k + 1 : k;
+
+  const auto f = m - 1;
+  const auto s = f / (2 + f);
+  const auto z = s * s;
+  const auto w = z * z;
+  const auto t1 = w * (T(3.999999999940941908e-01) +
+                       w * (T(2.222219843214978396e-01) +
+                            w * T(1.531383769920937332e-01)));
+  const auto t2 = z * (T(6.666666666666735130e-01) +
+                       w * (T(2.857142874366239149e-01) +
+                            w * (T(1.818357216161805012e-01) +
+                                 w * T(1.479819860511658591e-01))));
+  const auto hfsq = T(0.5) * f * f;
+  constexpr auto ln2_hi = T(6.93147180369123816490e-01);
+  constexpr auto ln2_lo = T(1.90821492927058770002e-10);
+  return k * ln2_hi - ((hfsq - (s * (hfsq + t1 + t2) + k * ln2_lo)) - f);
+}
+
+}  // namespace detail
+
+/// @brief Computes the exponential function
+///
+/// The argument is reduced by \f$ x = k \ln 2 + r \f$, and
+/// \f$ e^r = 1 + 2 r P(r^2) / (Q(r^2) - r P(r^2)) \f$ with the Pade
+/// approximation of Cephes. \f$ 2^k \f$ is applied in two halves so that
+/// the result overflows and underflows gracefully.
+template <typename T>
+EOS_VECTOR_INLINE auto exp(T x) noexcept
+    -> std::enable_if_t<std::is_floating_point_v<T>, T> {
+  using traits = detail::float_traits<T>;
+  x = x < traits::exp_min ? traits::exp_min : x;
+  x = x > traits::exp_max ? traits::exp_max : x;
+  constexpr auto log2e = T(1.44269504088896340736);
+  const auto k = (x * log2e + traits::shifter) - traits::shifter;
+  const auto r = (x - k * traits::ln2_hi) - k * traits::ln2_lo;
+  const auto rr = r * r;
+  const auto p =
+      r * (T(9.99999999999999999910e-1) +
+           rr * (T(3.02994407707441961300e-2) +
+                 rr * T(1.26177193074810590878e-4)));
+  const auto q = T(2.0) + rr * (T(2.27265548208155028766e-1) +
+                                rr * (T(2.52448340349684104192e-3) +
+                                      rr * T(3.00198505138664455042e-6)));
+  const auto er = 1 + 2 * p / (q - p);
+  const auto k1 = (T(0.5) * k + traits::shifter) - traits::shifter;
+  return er * detail::exp2_int(k1) * detail::exp2_int(k - k1);
+}
+
+/// @brief Computes the natural logarithm
+///
+/// The argument is reduced by \f$ x = 2^k (1 + f) \f$ with
+/// \f$ \sqrt{2} / 2 < 1 + f < \sqrt{2} \f$, and \f$ \ln (1 + f) \f$ is
+/// computed by the polynomial of fdlibm in \f$ s = f / (2 + f) \f$.
+template <typename T>
+EOS_VECTOR_INLINE auto log(T x) noexcept
+    -> std::enable_if_t<std::is_floating_point_v<T>, T> {
+  using traits = detail::float_traits<T>;
+  using uint_type = typename traits::uint_type;
+  constexpr auto min = std::numeric_limits<T>::min();
+  constexpr auto max = std::numeric_limits<T>::max();
+  constexpr auto inf = std::numeric_limits<T>::infinity();
+  constexpr auto two_mantissa = T(uint_type{1} << traits::mantissa_bits);
+
+  // Subnormal numbers are scaled to normal numbers
+  const auto subnormal = x < min;
+  const auto result =
+      detail::log_normal(subnormal ? x * two_mantissa : x,
+                         subnormal ? T(traits::mantissa_bits) : T(0));
+
+  // Zero, negative numbers, infinity and NaN
+  constexpr auto nan = std::numeric_limits<T>::quiet_NaN();
+  const auto special = x > max ? inf : nan;
+  const auto nonfinite = x == 0 ? -inf : special;
+  return (x > 0) & (x <= max) ? result : nonfinite;
+}
+
+/// @brief Computes \f$ e^x - 1 \f$
+///
+/// Kahan's method, \f$ (u - 1) x / \ln u \f$ with \f$ u = e^x \f$, where
+/// the rounding error of \f$ u \f$ cancels between the numerator and the
+/// denominator, gives the result accurately near zero.
+template <typename T>
+EOS_VECTOR_INLINE auto expm1(T x) noexcept
+    -> std::enable_if_t<std::is_floating_point_v<T>, T> {
+  constexpr auto max = std::numeric_limits<T>::max();
+  const auto u = vector_math::exp(x);
+  const auto um1 = u - 1;
+  // u out of normal numbers is replaced by the selections below
+  auto result = um1 * (x / detail::log_normal(u));
+  result = u == 1 ? x : result;
+  result = um1 == -1 ? T(-1) : result;
+  return u > max ? u : result;
+}
+
+/// @brief Computes the cube root
+///
+/// The cube root is \f$ \exp (\ln |x| / 3) \f$ with the sign of the
+/// argument, polished by a step of Newton's method.
+template <typename T>
+EOS_VECTOR_INLINE auto cbrt(T x) noexcept
+    -> std::enable_if_t<std::is_floating_point_v<T>, T> {
+  constexpr auto max = std::numeric_limits<T>::max();
+  const auto ax = x < 0 ? -x : x;
+  auto y = vector_math::exp(vector_math::log(ax) / 3);
+  y -= (y - ax / (y * y)) / 3;
+  const auto result = (ax > 0) & (ax <= max) ? y : ax;
+  return x < 0 ? -result : result;
+}
+
+/// @brief Computes the arc cosine
+///
+/// The algorithm is that of fdlibm, where the rational function is
+/// evaluated once and the result is selected by the range of the argument.
+template <typename T>
+EOS_VECTOR_INLINE auto acos(T x) noexcept
+    -> std::enable_if_t<std::is_floating_point_v<T>, T> {
+  constexpr auto pio2_hi = T(1.57079632679489655800e+00);
+  constexpr auto pio2_lo = T(6.12323399573676603587e-17);
+  const auto ax = x < 0 ? -x : x;
+  const auto small = ax < T(0.5);
+  const auto z = small ? x * x : (1 - ax) * T(0.5);
+  const auto s = std::sqrt(z);
+  const auto r = detail::acos_ratio(z);
+  const auto y = small ? x : s;
+  const auto w = y + y * r;
+  const auto large = x > 0 ? 2 * w : 2 * pio2_hi - 2 * (w - pio2_lo);
+  return small ? pio2_hi - (x - (pio2_lo - x * r)) : large;
+}
+
+/// @brief Solves a cubic equation, \f$ x^3 + a x^2 + b x + c = 0 \f$, in the
+/// closed form without branches
+/// @param[out] x0 Smallest real root
+/// @param[out] x1 Middle real root
+/// @param[out] x2 Largest real root
+/// @return True if the equation has three real roots. Otherwise, all the
+/// roots are the only real root.
+///
+/// Both the trigonometric solution of three roots and the solution of one
+/// root are computed, and the results are selected. With
+/// \f$ \theta = \arccos (r / q^{3/2}) \in [0, \pi] \f$, the roots
+/// \f$ -2 \sqrt{q} \cos ((\theta + 2 \pi j) / 3) - a / 3 \f$ are in the
+/// known order, and the cosines are evaluated by the half angle
+/// \f$ \theta / 6 \le \pi / 6 \f$ without sorting.
+template <typename T>
+EOS_VECTOR_INLINE bool solve_cubic(T a, T b, T c, T &x0, T &x1,
+                                   T &x2) noexcept {
+  constexpr auto half_sqrt3 = T(0.86602540378443864676);
+  const auto q = (a * a - 3 * b) / 9;
+  const auto r = (2 * a * a * a - 9 * a * b + 27 * c) / 54;
+  const auto q3 = q * q * q;
+  const auto d = r * r - q3;
+  const auto three = d < 0;
+
+  // Three roots
+  const auto ratio = r / std::sqrt(three ? q3 : T(1));
+  const auto clamped = ratio < -1 ? T(-1) : ratio;
+  const auto theta = vector_math::acos(clamped > 1 ? T(1) : clamped);
+  T sh, ch;
+  detail::sin_cos_kernel(theta / 6, sh, ch);
+  const auto cs = 1 - 2 * sh * sh;
+  const auto sn = 2 * sh * ch;
+  const auto s = -2 * std::sqrt(three ? q : T(0));
+
+  // One root
+  const auto sd = std::sqrt(three ? T(0) : d);
+  const auto u = -vector_math::cbrt(r < 0 ? r - sd : r + sd);
+  const auto v = u != 0 ? q / u : T(0);
+  const auto x = u + v;
+
+  x0 = (three ? s * cs : x) - a / 3;
+  x1 = three ? s * (half_sqrt3 * sn - T(0.5) * cs) - a / 3 : x0;
+  x2 = three ? s * (-half_sqrt3 * sn - T(0.5) * cs) - a / 3 : x0;
+  return three;
+}
+
+}  // namespace vector_math
+
+/// @brief Elementary functions of the standard library
+struct standard_math {
+  template <typename T>
+  static T log(T x) noexcept {
+    return std::log(x);
+  }
+};
+
+/// @brief Branch-free elementary functions of eos::vector_math
+struct branch_free_math {
+  template <typename T>
+  EOS_VECTOR_INLINE static T log(T x) noexcept {
+    return vector_math::log(x);
+  }
+};
+
+}  // namespace eos
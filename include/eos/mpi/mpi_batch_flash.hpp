@@ -0,0 +1,168 @@
+#pragma once
+
+#include <mpi.h>
+
+#include <algorithm>  // std::max, std::min
+#include <cassert>    // assert
+#include <cstddef>    // std::size_t
+#include <gsl/gsl>    // gsl::span
+#include <vector>     // std::vector
+
+#include "eos/cubic_eos/flash_iteration_result.hpp"
+#include "eos/cubic_eos/vapor_liquid_flash.hpp"
+
+namespace eos {
+
+/// @brief Batch flash distributed over MPI ranks with dynamic load balancing
+/// @tparam CubicEos Cubic EoS
+///
+/// Each rank owns a batch of local cells. Before a batch is computed, cells
+/// are repartitioned into contiguous ranges of the global order so that the
+/// estimated cost of every rank is equal, and results are returned to the
+/// owners. The cost of a cell is estimated by the number of iterations
+/// reported by flash_iteration_result in the previous call, so that ranks
+/// holding expensive cells, e.g. near the critical point, do not become
+/// stragglers. The cost of every cell is one in the first call.
+///
+/// All the ranks of the communicator must call the batch functions
+/// collectively.
+template <typename CubicEos>
+class mpi_batch_flash {
+ public:
+  /// @param[in] comm MPI communicator
+  /// @param[in] flash Vapor-liquid flash
+  mpi_batch_flash(MPI_Comm comm, const vapor_liquid_flash<CubicEos> &flash)
+      : comm_{comm}, flash_{flash}, cost_{}, migrated_{0}, imbalance_{1.0} {
+    MPI_Comm_rank(comm_, &rank_);
+    MPI_Comm_size(comm_, &size_);
+  }
+
+  /// @brief Computes vapor pressures of local cells
+  /// @param[in] p_init Initial pressures
+  /// @param[in] t Temperatures
+  /// @param[out] p Vapor pressures
+  /// @param[out] r Iteration reports
+  void vapor_pressure(gsl::span<const double> p_init,
+                      gsl::span<const double> t, gsl::span<double> p,
+                      gsl::span<flash_iteration_result> r) {
+    assert(p_init.size() == t.size() && p_init.size() == p.size() &&
+           p_init.size() == r.size());
+    const auto n = p_init.size();
+    if (cost_.size() != n) {
+      cost_.assign(n, 1.0);
+    }
+
+    // Destination of each cell by the global prefix sum of costs
+    double local_cost = 0.0;
+    for (const auto c : cost_) {
+      local_cost += c;
+    }
+    double offset = 0.0, total = 0.0;
+    MPI_Exscan(&local_cost, &offset, 1, MPI_DOUBLE, MPI_SUM, comm_);
+    MPI_Allreduce(&local_cost, &total, 1, MPI_DOUBLE, MPI_SUM, comm_);
+    if (rank_ == 0) {
+      offset = 0.0;
+    }
+
+    std::vector<int> send_cells(size_, 0);
+    const auto share = total / size_;
+    for (std::size_t i = 0; i < n; ++i) {
+      const auto mid = offset + 0.5 * cost_[i];
+      const auto dest =
+          std::min(size_ - 1, static_cast<int>(share > 0 ? mid / share : 0));
+      ++send_cells[dest];
+      offset += cost_[i];
+    }
+    std::vector<int> recv_cells(size_, 0);
+    MPI_Alltoall(send_cells.data(), 1, MPI_INT, recv_cells.data(), 1, MPI_INT,
+                 comm_);
+
+    // Sends (p_init, t) of each cell to its destination
+    std::vector<double> send_buf(2 * n);
+    for (std::size_t i = 0; i < n; ++i) {
+      send_buf[2 * i] = p_init[i];
+      send_buf[2 * i + 1] = t[i];
+    }
+    std::size_t m = 0;
+    for (const auto c : recv_cells) {
+      m += static_cast<std::size_t>(c);
+    }
+    std::vector<double> recv_buf(2 * m);
+    this->exchange(send_buf, send_cells, 2, recv_buf, recv_cells);
+
+    // Computes received cells and sends (p, rsd, iter, error) back
+    std::vector<double> result_buf(4 * m);
+    double work = 0.0;
+    for (std::size_t i = 0; i < m; ++i) {
+      const auto [pi, ri] =
+          flash_.vapor_pressure(recv_buf[2 * i], recv_buf[2 * i + 1]);
+      result_buf[4 * i] = pi;
+      result_buf[4 * i + 1] = ri.rsd;
+      result_buf[4 * i + 2] = ri.iter;
+      result_buf[4 * i + 3] = static_cast<double>(ri.error);
+      work += std::max(ri.iter, 1);
+    }
+    std::vector<double> return_buf(4 * n);
+    this->exchange(result_buf, recv_cells, 4, return_buf, send_cells);
+
+    for (std::size_t i = 0; i < n; ++i) {
+      p[i] = return_buf[4 * i];
+      r[i].rsd = return_buf[4 * i + 1];
+      r[i].iter = static_cast<int>(return_buf[4 * i + 2]);
+      r[i].error = static_cast<flash_iteration_error>(
+          static_cast<int>(return_buf[4 * i + 3]));
+      cost_[i] = std::max(r[i].iter, 1);
+    }
+
+    // Statistics of this call
+    long local_migrated = static_cast<long>(n - send_cells[rank_]);
+    MPI_Allreduce(&local_migrated, &migrated_, 1, MPI_LONG, MPI_SUM, comm_);
+    double max_work = 0.0, total_work = 0.0;
+    MPI_Allreduce(&work, &max_work, 1, MPI_DOUBLE, MPI_MAX, comm_);
+    MPI_Allreduce(&work, &total_work, 1, MPI_DOUBLE, MPI_SUM, comm_);
+    imbalance_ = total_work > 0 ? max_work * size_ / total_work : 1.0;
+  }
+
+  /// @brief Returns the number of cells computed by other ranks than their
+  /// owners in the last call
+  long migrated_cells() const noexcept { return migrated_; }
+
+  /// @brief Returns the ratio of the maximum to the mean of iterations
+  /// computed by ranks in the last call
+  double imbalance() const noexcept { return imbalance_; }
+
+  /// @brief Resets the estimated costs of local cells
+  void reset_costs() noexcept { cost_.clear(); }
+
+ private:
+  /// @brief Exchanges cells of a given number of doubles among ranks
+  void exchange(const std::vector<double> &send_buf,
+                const std::vector<int> &send_cells, int width,
+                std::vector<double> &recv_buf,
+                const std::vector<int> &recv_cells) const {
+    std::vector<int> send_counts(size_), send_displs(size_);
+    std::vector<int> recv_counts(size_), recv_displs(size_);
+    int s = 0, r = 0;
+    for (int k = 0; k < size_; ++k) {
+      send_counts[k] = width * send_cells[k];
+      send_displs[k] = s;
+      s += send_counts[k];
+      recv_counts[k] = width * recv_cells[k];
+      recv_displs[k] = r;
+      r += recv_counts[k];
+    }
+    MPI_Alltoallv(send_buf.data(), send_counts.data(), send_displs.data(),
+                  MPI_DOUBLE, recv_buf.data(), recv_counts.data(),
+                  recv_displs.data(), MPI_DOUBLE, comm_);
+  }
+
+  MPI_Comm comm_;
+  int rank_;
+  int size_;
+  vapor_liquid_flash<CubicEos> flash_;
+  std::vector<double> cost_;  /// Estimated cost of each local cell
+  long migrated_;
+  double imbalance_;
+};
+
+}  // namespace eos
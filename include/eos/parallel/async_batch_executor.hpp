@@ -0,0 +1,198 @@
+#pragma once
+
+#include <condition_variable>  // std::condition_variable
+#include <cstddef>             // std::size_t
+#include <exception>           // std::current_exception
+#include <future>              // std::future, std::promise
+#include <gsl/gsl>             // gsl::span
+#include <memory>              // std::make_shared
+#include <mutex>               // std::mutex
+#include <stdexcept>           // std::logic_error
+#include <utility>             // std::forward, std::move
+
+#include "eos/cubic_eos/flash_iteration_result.hpp"
+#include "eos/cubic_eos/root_selection.hpp"
+#include "eos/cubic_eos/vapor_liquid_flash.hpp"
+#include "eos/parallel/thread_pool.hpp"
+
+namespace eos {
+
+/// @brief Asynchronous submission of batch calculations to a thread pool
+/// @tparam CubicEos Cubic EoS
+///
+/// Each batch is executed by a worker thread of the pool. Results are written
+/// to output arrays given by the caller, so that the same buffers can be
+/// reused for consecutive batches without allocation. Output arrays must not
+/// be accessed until the completion of the batch.
+///
+/// The number of batches in flight is bounded: submission blocks until one of
+/// the running batches is completed, which applies back-pressure to the
+/// caller. The destructor waits for all the submitted batches. Completion
+/// callbacks must not throw exceptions.
+///
+/// A worker thread of the pool, e.g. a completion callback, can submit a batch
+/// only while a slot is free, since waiting for a slot there can deadlock.
+/// Submission throws std::logic_error otherwise, and wait() must not be
+/// called by a worker thread.
+template <typename CubicEos>
+class async_batch_executor {
+ public:
+  /// @param[in] pool Thread pool
+  /// @param[in] eos EoS
+  /// @param[in] max_in_flight Maximum number of batches in flight
+  async_batch_executor(thread_pool &pool, const CubicEos &eos,
+                       std::size_t max_in_flight)
+      : pool_{pool},
+        eos_{eos},
+        flash_{eos},
+        max_in_flight_{max_in_flight > 0 ? max_in_flight : 1},
+        in_flight_{0} {}
+
+  async_batch_executor(const async_batch_executor &) = delete;
+  async_batch_executor(async_batch_executor &&) = delete;
+
+  ~async_batch_executor() { this->wait(); }
+
+  async_batch_executor &operator=(const async_batch_executor &) = delete;
+  async_batch_executor &operator=(async_batch_executor &&) = delete;
+
+  /// @brief Submits a batch of Z-factors
+  /// @param[in] p Pressures
+  /// @param[in] t Temperatures
+  /// @param[out] z Z-factors
+  /// @param[in] selection Selection of a root
+  /// @return Future which becomes ready when the batch is completed
+  std::future<void> zfactor(gsl::span<const double> p,
+                            gsl::span<const double> t, gsl::span<double> z,
+                            root_selection selection) {
+    return this->submit([this, p, t, z, selection] {
+      eos_.zfactor(p, t, z, selection);
+    });
+  }
+
+  /// @brief Submits a batch of vapor pressures
+  /// @param[in] p_init Initial pressures
+  /// @param[in] t Temperatures
+  /// @param[out] p Vapor pressures
+  /// @param[out] r Iteration reports
+  /// @return Future which becomes ready when the batch is completed
+  std::future<void> vapor_pressure(gsl::span<const double> p_init,
+                                   gsl::span<const double> t,
+                                   gsl::span<double> p,
+                                   gsl::span<flash_iteration_result> r) {
+    return this->submit([this, p_init, t, p, r] {
+      flash_.vapor_pressure(p_init, t, p, r);
+    });
+  }
+
+  /// @brief Submits a batch of vapor pressures with a completion callback
+  /// @param[in] p_init Initial pressures
+  /// @param[in] t Temperatures
+  /// @param[out] p Vapor pressures
+  /// @param[out] r Iteration reports
+  /// @param[in] done Callback invoked by a worker thread after the batch
+  template <typename Callback>
+  void vapor_pressure(gsl::span<const double> p_init,
+                      gsl::span<const double> t, gsl::span<double> p,
+                      gsl::span<flash_iteration_result> r, Callback &&done) {
+    this->post([this, p_init, t, p, r, done = std::forward<Callback>(done)] {
+      flash_.vapor_pressure(p_init, t, p, r);
+      done();
+    });
+  }
+
+  /// @brief Submits a batch of Z-factors with a completion callback
+  /// @param[in] p Pressures
+  /// @param[in] t Temperatures
+  /// @param[out] z Z-factors
+  /// @param[in] selection Selection of a root
+  /// @param[in] done Callback invoked by a worker thread after the batch
+  template <typename Callback>
+  void zfactor(gsl::span<const double> p, gsl::span<const double> t,
+               gsl::span<double> z, root_selection selection,
+               Callback &&done) {
+    this->post(
+        [this, p, t, z, selection, done = std::forward<Callback>(done)] {
+          eos_.zfactor(p, t, z, selection);
+          done();
+        });
+  }
+
+  /// @brief Submits an arbitrary batch
+  /// @param[in] f Function executed by a worker thread
+  /// @return Future which becomes ready when f returns or throws
+  template <typename Function>
+  std::future<void> submit(Function &&f) {
+    auto promise = std::make_shared<std::promise<void>>();
+    auto future = promise->get_future();
+    this->post([promise, f = std::forward<Function>(f)]() mutable {
+      try {
+        f();
+        promise->set_value();
+      } catch (...) {
+        promise->set_exception(std::current_exception());
+      }
+    });
+    return future;
+  }
+
+  /// @brief Waits for all the submitted batches
+  void wait() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    cv_.wait(lock, [this] { return in_flight_ == 0; });
+  }
+
+  /// @brief Returns the number of batches in flight
+  std::size_t in_flight() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return in_flight_;
+  }
+
+  std::size_t max_in_flight() const noexcept { return max_in_flight_; }
+
+ private:
+  /// @brief Posts a task after waiting for a free slot
+  /// @throw std::logic_error if a worker thread of the pool would wait
+  template <typename Function>
+  void post(Function &&f) {
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      if (in_flight_ >= max_in_flight_ && pool_.in_worker()) {
+        throw std::logic_error(
+            "Error: no free slot for a batch submitted by a worker thread!");
+      }
+      cv_.wait(lock, [this] { return in_flight_ < max_in_flight_; });
+      ++in_flight_;
+    }
+    auto task = std::make_shared<std::decay_t<Function>>(
+        std::forward<Function>(f));
+    pool_.submit([this, task] {
+      (*task)();
+      // Notifies under the lock because the executor may be destroyed as
+      // soon as the lock is released
+      std::lock_guard<std::mutex> lock(mutex_);
+      --in_flight_;
+      cv_.notify_all();
+    });
+  }
+
+  thread_pool &pool_;
+  CubicEos eos_;
+  vapor_liquid_flash<CubicEos> flash_;
+  std::size_t max_in_flight_;
+  std::size_t in_flight_;
+  mutable std::mutex mutex_;
+  std::condition_variable cv_;
+};
+
+/// @brief Makes asynchronous batch executor
+/// @param[in] pool Thread pool
+/// @param[in] eos EoS
+/// @param[in] max_in_flight Maximum number of batches in flight
+template <typename CubicEos>
+inline async_batch_executor<CubicEos> make_async_batch_executor(
+    thread_pool &pool, const CubicEos &eos, std::size_t max_in_flight) {
+  return {pool, eos, max_in_flight};
+}
+
+}  // namespace eos
@@ -0,0 +1,263 @@
+#pragma once
+
+#include <algorithm>  // std::min
+#include <array>      // std::array
+#include <cassert>    // assert
+#include <cmath>      // std::fabs
+#include <cstddef>    // std::size_t
+#include <future>     // std::future, std::promise
+#include <gsl/gsl>    // gsl::span
+#include <limits>     // std::numeric_limits
+#include <memory>     // std::make_shared
+#include <vector>     // std::vector
+
+#include "eos/cubic_eos/flash_iteration_result.hpp"
+#include "eos/cubic_eos/vapor_pressure_estimator.hpp"
+#include "eos/math/cubic_equation.hpp"  // eos::cubic_equation
+#include "eos/math/vector_math.hpp"  // eos::vector_math, eos::branch_free_math
+#include "eos/parallel/thread_pool.hpp"
+
+namespace eos {
+
+/// @brief Output arrays of batch saturation
+///
+/// Each array has an element for every pair of a temperature and a
+/// component, where the element of the j-th temperature and the i-th
+/// component is at j * (number of components) + i.
+struct saturation_arrays {
+  gsl::span<double> p;                  /// Vapor pressures
+  gsl::span<double> zl;                 /// Z-factors of liquid
+  gsl::span<double> zv;                 /// Z-factors of vapor
+  gsl::span<flash_iteration_result> r;  /// Iteration reports
+};
+
+namespace detail {
+
+/// @brief Improves a root of a cubic equation by a step of Newton's method
+EOS_VECTOR_INLINE double newton_step(const cubic_equation &eq,
+                                     double x) noexcept {
+  const auto f = ((x + eq.a) * x + eq.b) * x + eq.c;
+  const auto df = (3 * x + 2 * eq.a) * x + eq.b;
+  return x - (df != 0 ? f / df : 0.0);
+}
+
+/// @brief Solves the cubic equation of Z-factor in the closed form and
+/// polishes the smallest and largest roots by Newton's method
+/// @param[out] zl Smallest root
+/// @param[out] zv Largest root
+/// @return True if the equation has three real roots
+template <typename CubicEos>
+EOS_VECTOR_INLINE bool solve_saturation_zfactor(double a, double b, double &zl,
+                                     double &zv) noexcept {
+  const auto eq = CubicEos::zfactor_cubic_eq(a, b);
+  double x1;
+  const auto three = vector_math::solve_cubic(eq.a, eq.b, eq.c, zl, x1, zv);
+  // The smallest root loses relative precision at low pressure
+  zl = newton_step(eq, newton_step(eq, zl));
+  zv = newton_step(eq, newton_step(eq, zv));
+  return three;
+}
+
+/// @brief Computes the logarithm of fugacity coefficient without branches
+template <typename CubicEos>
+EOS_VECTOR_INLINE double saturation_ln_fugacity_coeff(double z, double a,
+                                           double b) noexcept {
+  return z - 1 - branch_free_math::log(z - b) -
+         CubicEos::template attraction_term<double, branch_free_math>(z, a,
+                                                                      b);
+}
+
+/// @brief Computes saturation of a block of components at a temperature
+/// @tparam CubicEos Cubic EoS constructible from (pc, tc, omega)
+/// @tparam Width Number of lanes
+///
+/// Components are streamed through lanes iterated in lockstep by successive
+/// substitution. The loop over lanes has a fixed trip count and no
+/// branches: every lane evaluates the cubic equation and fugacity
+/// coefficients by the functions of eos::vector_math, and a lane which has
+/// converged or failed keeps its values by selections. Between iterations,
+/// a scalar pass writes the results of such lanes and loads the next
+/// components into them, so that the number of lane updates is close to
+/// the total number of iterations even if a few components converge slowly
+/// near the critical point.
+template <typename CubicEos, std::size_t Width>
+void compute_saturation_block(const double *pc, const double *tc,
+                              const double *omega, std::size_t n, double t,
+                              double tol, int maxiter, double *p, double *zl,
+                              double *zv,
+                              flash_iteration_result *r) noexcept {
+  // Error codes of lanes as integers, which are vectorized with doubles
+  constexpr auto not_converged =
+      static_cast<int>(flash_iteration_error::not_converged);
+  constexpr auto success = static_cast<int>(flash_iteration_error::success);
+  constexpr auto no_roots =
+      static_cast<int>(flash_iteration_error::multiple_roots_not_found);
+  constexpr auto max_double = std::numeric_limits<double>::max();
+  std::array<double, Width> ka, kb, ps, eps;
+  std::array<int, Width> iter, status, active;
+  // Components of lanes, n if a lane is idle
+  std::array<std::size_t, Width> index;
+  std::size_t next = 0;
+
+  // Writes the result of a lane and loads the next subcritical component
+  const auto refill = [&](std::size_t k) {
+    if (index[k] < n) {
+      const auto l = index[k];
+      double x0 = 0.0, x2 = 0.0;
+      if (status[k] != success ||
+          !solve_saturation_zfactor<CubicEos>(ka[k] * ps[k], kb[k] * ps[k],
+                                              x0, x2)) {
+        x0 = x2 = 0.0;
+      }
+      p[l] = status[k] == success ? ps[k] : 0.0;
+      zl[l] = x0;
+      zv[l] = x2;
+      r[l] = {eps[k], iter[k], static_cast<flash_iteration_error>(status[k])};
+    }
+    for (; next < n && !(t < tc[next]); ++next) {
+      p[next] = zl[next] = zv[next] = 0.0;
+      r[next] = {1.0, 0, flash_iteration_error::multiple_roots_not_found};
+    }
+    index[k] = next;
+    active[k] = next < n && maxiter > 0;
+    if (next < n) {
+      // Reduced parameters are proportional to pressure at a temperature
+      const auto tr = t / tc[next];
+      const auto alpha =
+          CubicEos(pc[next], tc[next], omega[next]).alpha(tr);
+      ka[k] = alpha * CubicEos::omega_a / (pc[next] * tr * tr);
+      kb[k] = CubicEos::omega_b / (pc[next] * tr);
+      ps[k] = estimate_vapor_pressure_lee_kesler(t, pc[next], tc[next],
+                                                 omega[next]);
+      eps[k] = 1.0;
+      iter[k] = 0;
+      status[k] = not_converged;
+      ++next;
+    }
+  };
+
+  for (std::size_t k = 0; k < Width; ++k) {
+    index[k] = n;
+    ka[k] = kb[k] = ps[k] = eps[k] = 0.0;
+    iter[k] = status[k] = 0;
+    refill(k);
+  }
+
+  for (;;) {
+    for (std::size_t k = 0; k < Width; ++k) {
+      const auto a = ka[k] * ps[k];
+      const auto b = kb[k] * ps[k];
+      double x0, x2;
+      const auto three = solve_saturation_zfactor<CubicEos>(a, b, x0, x2);
+      const auto ratio = vector_math::exp(
+          saturation_ln_fugacity_coeff<CubicEos>(x0, a, b) -
+          saturation_ln_fugacity_coeff<CubicEos>(x2, a, b));
+      const auto p_new = ps[k] * ratio;
+      const auto eps_new = std::fabs(1.0 - ratio);
+
+      const auto valid = active[k] & three & (x0 > b);
+      const auto finite = std::fabs(p_new) <= max_double;
+      const auto converged = valid & finite & !(eps_new > tol);
+      ps[k] = valid ? p_new : ps[k];
+      eps[k] = valid ? eps_new : eps[k];
+      iter[k] += valid;
+      const auto failed = active[k] & !valid;
+      const auto next_status = converged ? success : status[k];
+      status[k] = failed ? no_roots : next_status;
+      active[k] = valid & finite & !converged & (iter[k] < maxiter);
+    }
+
+    bool busy = false;
+    for (std::size_t k = 0; k < Width; ++k) {
+      if (!active[k]) {
+        refill(k);
+      }
+      busy = busy || index[k] < n;
+    }
+    if (!busy) {
+      break;
+    }
+  }
+}
+
+}  // namespace detail
+
+/// @brief Computes saturation of pure components over a temperature grid
+/// @tparam CubicEos Cubic EoS constructible from (pc, tc, omega)
+/// @param[in] pool Thread pool
+/// @param[in] pc Critical pressures of components
+/// @param[in] tc Critical temperatures of components
+/// @param[in] omega Acentric factors of components
+/// @param[in] t Temperatures
+/// @param[out] out Vapor pressures, Z-factors of liquid and vapor, and
+/// iteration reports
+/// @param[in] tol Tolerance of the relative difference of fugacity
+/// @param[in] maxiter Maximum iteration
+///
+/// Component parameters are given as a structure of arrays, and no EoS or
+/// flash object is created per component. Blocks of up to 256 components of
+/// a temperature are solved in eight lanes by the threads of the pool, and
+/// the initial guess is estimated by Lee-Kesler correlation. Vapor pressure
+/// is zero if a component is supercritical or the iteration fails. The loop
+/// over lanes is branch-free so that it is vectorized.
+///
+/// If called by a worker thread of the pool, the blocks are solved by the
+/// calling thread, since waiting for the other workers can deadlock.
+template <typename CubicEos>
+void compute_saturation(thread_pool &pool, gsl::span<const double> pc,
+                        gsl::span<const double> tc,
+                        gsl::span<const double> omega,
+                        gsl::span<const double> t,
+                        const saturation_arrays &out, double tol = 1e-6,
+                        int maxiter = 100) {
+  constexpr std::size_t width = 8;
+  constexpr std::size_t block_size = 256;
+  const auto nc = pc.size();
+  const auto nt = t.size();
+  assert(tc.size() == nc && omega.size() == nc);
+  assert(out.p.size() == nc * nt && out.zl.size() == nc * nt &&
+         out.zv.size() == nc * nt && out.r.size() == nc * nt);
+
+  const auto blocks_per_row = (nc + block_size - 1) / block_size;
+  const auto num_blocks = blocks_per_row * nt;
+  if (num_blocks == 0) {
+    return;
+  }
+
+  const auto compute_blocks = [=, &out](std::size_t first,
+                                         std::size_t last) {
+    for (auto block = first; block < last; ++block) {
+      const auto j = block / blocks_per_row;
+      const auto i = (block % blocks_per_row) * block_size;
+      const auto n = std::min(block_size, nc - i);
+      const auto k = j * nc + i;
+      detail::compute_saturation_block<CubicEos, width>(
+          &pc[i], &tc[i], &omega[i], n, t[j], tol, maxiter, &out.p[k],
+          &out.zl[k], &out.zv[k], &out.r[k]);
+    }
+  };
+  if (pool.in_worker()) {
+    compute_blocks(0, num_blocks);
+    return;
+  }
+
+  // A few tasks per thread to balance the load of near-critical blocks
+  const auto num_tasks = std::min(num_blocks, 4 * pool.size());
+  std::vector<std::future<void>> futures;
+  futures.reserve(num_tasks);
+  for (std::size_t task = 0; task < num_tasks; ++task) {
+    const auto first = num_blocks * task / num_tasks;
+    const auto last = num_blocks * (task + 1) / num_tasks;
+    auto done = std::make_shared<std::promise<void>>();
+    futures.push_back(done->get_future());
+    pool.submit([=] {
+      compute_blocks(first, last);
+      done->set_value();
+    });
+  }
+  for (auto &f : futures) {
+    f.get();
+  }
+}
+
+}  // namespace eos
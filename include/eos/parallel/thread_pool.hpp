@@ -0,0 +1,52 @@
+#pragma once
+
+#include <condition_variable>  // std::condition_variable
+#include <cstddef>             // std::size_t
+#include <functional>          // std::function
+#include <mutex>               // std::mutex
+#include <queue>               // std::queue
+#include <thread>              // std::thread
+#include <vector>              // std::vector
+
+namespace eos {
+
+/// @brief Fixed-size pool of worker threads
+///
+/// Tasks are executed in the order of submission. Tasks must not throw
+/// exceptions. The destructor waits for all the submitted tasks.
+class thread_pool {
+ public:
+  /// @param[in] num_threads Number of worker threads. The number of hardware
+  /// threads is used if zero.
+  explicit thread_pool(std::size_t num_threads = 0);
+  thread_pool(const thread_pool&) = delete;
+  thread_pool(thread_pool&&) = delete;
+
+  ~thread_pool();
+
+  thread_pool& operator=(const thread_pool&) = delete;
+  thread_pool& operator=(thread_pool&&) = delete;
+
+  /// @brief Submits a task
+  void submit(std::function<void()> task);
+
+  /// @brief Returns the number of worker threads
+  std::size_t size() const noexcept { return workers_.size(); }
+
+  /// @brief Returns true if called by a worker thread of the pool
+  ///
+  /// A task which waits for other tasks of the same pool can deadlock when
+  /// all the workers are waiting, which callers detect by this.
+  bool in_worker() const noexcept;
+
+ private:
+  void work();
+
+  std::vector<std::thread> workers_;
+  std::queue<std::function<void()>> tasks_;
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  bool stopped_;
+};
+
+}  // namespace eos
@@ -0,0 +1,137 @@
+#pragma once
+
+#include <array>    // std::array
+#include <cassert>  // assert
+#include <cstddef>  // std::size_t
+#include <gsl/gsl>  // gsl::span
+
+#include "eos/cubic_eos/root_selection.hpp"
+#include "eos/saft/pc_saft_isobaric_isothermal_state.hpp"
+#include "eos/saft/pc_saft_isothermal_line.hpp"
+
+namespace eos {
+
+/// @brief PC-SAFT EoS of Gross and Sadowski for a non-associating pure
+/// component
+///
+/// The residual Helmholtz energy is the sum of hard-chain and dispersion
+/// terms,
+/// \f[ \frac{A^{res}}{RT} = m \frac{A^{hs}}{RT} - (m - 1) \ln g^{hs}(d) -
+/// 2 \pi \rho I_1 m^2 \frac{\epsilon}{kT} \sigma^3 - \pi \rho m C_1 I_2 m^2
+/// \left( \frac{\epsilon}{kT} \right)^2 \sigma^3, \f]
+/// where the dispersion integrals, \f$ I_1 \f$ and \f$ I_2 \f$, are
+/// polynomials in packing fraction whose coefficients depend only on the
+/// segment number and are computed by the constructor. Temperature-only
+/// terms are cached by pc_saft_isothermal_line.
+class pc_saft_eos {
+ public:
+  pc_saft_eos() = default;
+  pc_saft_eos(const pc_saft_eos &) = default;
+  pc_saft_eos(pc_saft_eos &&) = default;
+
+  pc_saft_eos &operator=(const pc_saft_eos &) = default;
+  pc_saft_eos &operator=(pc_saft_eos &&) = default;
+
+  /// @brief Constructs PC-SAFT EoS
+  /// @param[in] m Segment number
+  /// @param[in] sigma Segment diameter [Angstrom]
+  /// @param[in] epsilon_k Dispersion energy divided by Boltzmann constant [K]
+  pc_saft_eos(double m, double sigma, double epsilon_k) noexcept
+      : m_{m}, sigma_{sigma}, epsilon_k_{epsilon_k} {
+    // Universal constants of Gross and Sadowski (2001)
+    constexpr std::array<std::array<double, 7>, 3> a = {{
+        {0.9105631445, 0.6361281449, 2.6861347891, -26.547362491,
+         97.759208784, -159.59154087, 91.297774084},
+        {-0.3084016918, 0.1860531159, -2.5030047259, 21.419793629,
+         -65.255885330, 83.318680481, -33.746922930},
+        {-0.0906148351, 0.4527842806, 0.5962700728, -1.7241829131,
+         -4.1302112531, 13.776631870, -8.6728470368},
+    }};
+    constexpr std::array<std::array<double, 7>, 3> b = {{
+        {0.7240946941, 2.2382791861, -4.0025849485, -21.003576815,
+         26.855641363, 206.55133841, -355.60235612},
+        {-0.5755498075, 0.6995095521, 3.8925673390, -17.215471648,
+         192.67226447, -161.82646165, -165.20769346},
+        {0.0976883116, -0.2557574982, -9.1558561530, 20.642075974,
+         -38.804430052, 93.626774077, -29.666905585},
+    }};
+    const auto f1 = (m - 1) / m;
+    const auto f2 = f1 * (m - 2) / m;
+    for (std::size_t i = 0; i < 7; ++i) {
+      c_.a[i] = a[0][i] + f1 * a[1][i] + f2 * a[2][i];
+      c_.b[i] = b[0][i] + f1 * b[1][i] + f2 * b[2][i];
+    }
+  }
+
+  /// @brief Creates isothermal line caching temperature-only terms
+  /// @param[in] t Temperature
+  pc_saft_isothermal_line create_isothermal_line(double t) const noexcept {
+    return {t, m_, sigma_, epsilon_k_, c_};
+  }
+
+  /// @brief Creates isobaric-isothermal state
+  /// @param[in] p Pressure
+  /// @param[in] t Temperature
+  pc_saft_isobaric_isothermal_state create_isobaric_isothermal_state(
+      double p, double t) const noexcept {
+    return {p, this->create_isothermal_line(t)};
+  }
+
+  /// @brief Computes pressure
+  /// @param[in] t Temperature
+  /// @param[in] v Molar volume
+  double pressure(double t, double v) const noexcept {
+    return this->create_isothermal_line(t).pressure(v);
+  }
+
+  /// @brief Computes Z-factors at multiple points
+  /// @param[in] p Pressures
+  /// @param[in] t Temperatures
+  /// @param[out] z Z-factors
+  /// @param[in] selection Selection of a root
+  ///
+  /// Temperature-only terms are recomputed only when temperature changes
+  /// between consecutive points, so points should be ordered by temperature.
+  void zfactor(gsl::span<const double> p, gsl::span<const double> t,
+               gsl::span<double> z, root_selection selection) const noexcept {
+    assert(p.size() == t.size() && p.size() == z.size());
+    pc_saft_isothermal_line line;
+    for (std::size_t i = 0; i < p.size(); ++i) {
+      if (i == 0 || t[i] != t[i - 1]) {
+        line = this->create_isothermal_line(t[i]);
+      }
+      z[i] = line.zfactor(p[i], selection);
+    }
+  }
+
+  /// @brief Computes the natural logarithms of fugacity coefficients at
+  /// multiple points
+  /// @param[in] p Pressures
+  /// @param[in] t Temperatures
+  /// @param[out] ln_phi Natural logarithms of fugacity coefficients
+  /// @param[in] selection Selection of a root
+  void ln_fugacity_coeff(gsl::span<const double> p, gsl::span<const double> t,
+                         gsl::span<double> ln_phi,
+                         root_selection selection) const noexcept {
+    assert(p.size() == t.size() && p.size() == ln_phi.size());
+    pc_saft_isothermal_line line;
+    for (std::size_t i = 0; i < p.size(); ++i) {
+      if (i == 0 || t[i] != t[i - 1]) {
+        line = this->create_isothermal_line(t[i]);
+      }
+      ln_phi[i] = line.ln_fugacity_coeff(p[i], line.zfactor(p[i], selection));
+    }
+  }
+
+  double segment_number() const noexcept { return m_; }
+  double segment_diameter() const noexcept { return sigma_; }
+  double dispersion_energy() const noexcept { return epsilon_k_; }
+
+ private:
+  double m_;          /// Segment number
+  double sigma_;      /// Segment diameter
+  double epsilon_k_;  /// Dispersion energy divided by Boltzmann constant
+  pc_saft_coefficients c_;  /// Coefficients of dispersion integrals
+};
+
+}  // namespace eos
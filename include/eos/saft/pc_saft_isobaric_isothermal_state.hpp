@@ -0,0 +1,69 @@
+#pragma once
+
+#include <cmath>  // std::exp
+
+#include "eos/cubic_eos/root_selection.hpp"
+#include "eos/saft/pc_saft_isothermal_line.hpp"
+
+namespace eos {
+
+/// @brief PC-SAFT EoS of a pure component at a pressure and temperature
+class pc_saft_isobaric_isothermal_state {
+ public:
+  /// @param[in] p Pressure
+  /// @param[in] line Isothermal line of the temperature
+  pc_saft_isobaric_isothermal_state(
+      double p, const pc_saft_isothermal_line &line) noexcept
+      : p_{p}, line_{line} {}
+
+  pc_saft_isobaric_isothermal_state() = default;
+  pc_saft_isobaric_isothermal_state(
+      const pc_saft_isobaric_isothermal_state &) = default;
+  pc_saft_isobaric_isothermal_state(pc_saft_isobaric_isothermal_state &&) =
+      default;
+
+  pc_saft_isobaric_isothermal_state &operator=(
+      const pc_saft_isobaric_isothermal_state &) = default;
+  pc_saft_isobaric_isothermal_state &operator=(
+      pc_saft_isobaric_isothermal_state &&) = default;
+
+  /// @brief Computes a Z-factor
+  /// @param[in] selection Selection of a root
+  double zfactor(root_selection selection) const noexcept {
+    return line_.zfactor(p_, selection);
+  }
+
+  /// @brief Computes the natural logarithm of a fugacity coefficient
+  /// @param[in] z Z-factor
+  double ln_fugacity_coeff(double z) const noexcept {
+    return line_.ln_fugacity_coeff(p_, z);
+  }
+
+  /// @brief Computes fugacity coefficient
+  /// @param[in] z Z-factor
+  double fugacity_coeff(double z) const noexcept {
+    return std::exp(this->ln_fugacity_coeff(z));
+  }
+
+  /// @brief Computes residual Helmholtz energy [J/mol]
+  /// @param[in] z Z-factor
+  double residual_helmholtz_energy(double z) const noexcept {
+    constexpr auto R = gas_constant<double>();
+    const auto rt = R * line_.temperature();
+    const auto v = z * rt / p_;
+    return rt * line_.reduced_residual_helmholtz_energy(
+                    line_.packing_fraction_at(v));
+  }
+
+  /// @brief Returns pressure
+  double pressure() const noexcept { return p_; }
+
+  /// @brief Returns temperature
+  double temperature() const noexcept { return line_.temperature(); }
+
+ private:
+  double p_;                      /// Pressure
+  pc_saft_isothermal_line line_;  /// Isothermal line
+};
+
+}  // namespace eos
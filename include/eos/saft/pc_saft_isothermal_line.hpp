@@ -0,0 +1,363 @@
+#pragma once
+
+#include <algorithm>  // std::clamp, std::min
+#include <array>      // std::array
+#include <cassert>    // assert
+#include <cmath>      // std::exp, std::fabs, std::log
+#include <cstddef>    // std::size_t
+#include <gsl/gsl>    // gsl::span
+#include <utility>    // std::pair
+
+#include "eos/common/mathematical_constants.hpp"   // eos::pi
+#include "eos/common/thermodynamic_constants.hpp"  // eos::gas_constant
+#include "eos/cubic_eos/flash_iteration_result.hpp"
+#include "eos/cubic_eos/root_selection.hpp"
+
+namespace eos {
+
+/// @brief Coefficients of the dispersion integrals of PC-SAFT EoS for a
+/// segment number
+struct pc_saft_coefficients {
+  std::array<double, 7> a;  /// Coefficients of the first integral
+  std::array<double, 7> b;  /// Coefficients of the second integral
+};
+
+/// @brief Terms of PC-SAFT EoS at a packing fraction
+struct pc_saft_terms {
+  double z;     /// Z-factor
+  double dzde;  /// Derivative of Z-factor with respect to packing fraction
+};
+
+/// @brief PC-SAFT EoS of a pure component at a temperature
+///
+/// Temperature-only terms, the segment diameter and the factors of the
+/// dispersion term, are computed once by the constructor, so that Z-factor
+/// at a packing fraction is a few polynomials in the packing fraction.
+/// Density at given pressure is solved by Newton's method safeguarded to
+/// stay in the mechanically stable branch, starting from a dense liquid for
+/// the liquid root and from the ideal gas for the vapor root.
+class pc_saft_isothermal_line {
+ public:
+  /// @param[in] t Temperature [K]
+  /// @param[in] m Segment number
+  /// @param[in] sigma Segment diameter [Angstrom]
+  /// @param[in] epsilon_k Dispersion energy divided by Boltzmann constant [K]
+  /// @param[in] c Coefficients of dispersion integrals for the segment number
+  pc_saft_isothermal_line(double t, double m, double sigma, double epsilon_k,
+                          const pc_saft_coefficients &c) noexcept
+      : t_{t}, m_{m}, c_{c} {
+    constexpr auto R = gas_constant<double>();
+    constexpr auto NA = avogadro_constant<double>();
+    const auto e = epsilon_k / t;
+    const auto sigma3 = sigma * sigma * sigma;
+    d_ = sigma * (1 - 0.12 * std::exp(-3 * e));
+    const auto kappa = pi<double>() / 6 * m * d_ * d_ * d_;
+    v0_ = kappa * NA * 1e-30;
+    a1_ = 2 * pi<double>() * m * m * e * sigma3 / kappa;
+    a2_ = pi<double>() * m * m * m * e * e * sigma3 / kappa;
+    rt_ = R * t;
+  }
+
+  pc_saft_isothermal_line() = default;
+  pc_saft_isothermal_line(const pc_saft_isothermal_line &) = default;
+  pc_saft_isothermal_line(pc_saft_isothermal_line &&) = default;
+
+  pc_saft_isothermal_line &operator=(const pc_saft_isothermal_line &) =
+      default;
+  pc_saft_isothermal_line &operator=(pc_saft_isothermal_line &&) = default;
+
+  /// @brief Computes Z-factor and its derivative at a packing fraction
+  /// @param[in] eta Packing fraction
+  pc_saft_terms evaluate(double eta) const noexcept {
+    const auto m = m_;
+    const auto om = 1 - eta;
+    const auto om2 = om * om;
+    const auto om3 = om2 * om;
+    const auto om4 = om3 * om;
+    const auto om5 = om4 * om;
+
+    // Hard-chain term with the contact value of the hard-sphere radial
+    // distribution function, g, and its derivatives
+    const auto z_hs = (4 * eta - 2 * eta * eta) / om3;
+    const auto dz_hs = (4 + 4 * eta - 2 * eta * eta) / om4;
+    const auto g = 1 / om + 1.5 * eta / om2 + 0.5 * eta * eta / om3;
+    const auto dg = 1 / om2 + 1.5 * (1 / om2 + 2 * eta / om3) +
+                    0.5 * (2 * eta / om3 + 3 * eta * eta / om4);
+    const auto d2g = 2 / om3 + 1.5 * (4 / om3 + 6 * eta / om4) +
+                     0.5 * (2 / om3 + 12 * eta / om4 + 12 * eta * eta / om5);
+    const auto z_hc = m * z_hs - (m - 1) * eta * dg / g;
+    const auto dz_hc = m * dz_hs - (m - 1) * (dg / g + eta * d2g / g -
+                                              eta * dg * dg / (g * g));
+
+    // Dispersion integrals, I2, and the derivatives of eta I1 and eta I2
+    double i2 = 0.0, di2 = 0.0, j1 = 0.0, dj1 = 0.0, j2 = 0.0, dj2 = 0.0;
+    for (std::size_t k = 7; k-- > 0;) {
+      const auto n = static_cast<double>(k);
+      i2 = i2 * eta + c_.b[k];
+      j1 = j1 * eta + c_.a[k] * (n + 1);
+      j2 = j2 * eta + c_.b[k] * (n + 1);
+      if (k > 0) {
+        di2 = di2 * eta + c_.b[k] * n;
+        dj1 = dj1 * eta + c_.a[k] * (n + 1) * n;
+        dj2 = dj2 * eta + c_.b[k] * (n + 1) * n;
+      }
+    }
+
+    // Compressibility term, C1, and its derivatives
+    const auto q = om * (2 - eta);
+    const auto dq = 2 * eta - 3;
+    const auto q2 = q * q;
+    const auto q3 = q2 * q;
+    const auto c1 =
+        1 / (1 + m * (8 * eta - 2 * eta * eta) / om4 +
+             (1 - m) * (20 * eta - 27 * eta * eta + 12 * eta * eta * eta -
+                        2 * eta * eta * eta * eta) /
+                 q2);
+    const auto n1 = -4 * eta * eta + 20 * eta + 8;
+    const auto n2 = 2 * eta * eta * eta + 12 * eta * eta - 48 * eta + 40;
+    const auto dd = m * n1 / om5 + (1 - m) * n2 / q3;
+    const auto ddd = m * ((20 - 8 * eta) / om5 + 5 * n1 / (om5 * om)) +
+                     (1 - m) * ((6 * eta * eta + 24 * eta - 48) / q3 -
+                                3 * n2 * dq / (q3 * q));
+    const auto c2 = -c1 * c1 * dd;
+    const auto dc2 = -2 * c1 * c2 * dd - c1 * c1 * ddd;
+
+    const auto s = c1 * j2 + c2 * eta * i2;
+    const auto ds = c2 * j2 + c1 * dj2 + dc2 * eta * i2 + c2 * i2 +
+                    c2 * eta * di2;
+    const auto z_disp = -a1_ * eta * j1 - a2_ * eta * s;
+    const auto dz_disp = -a1_ * (j1 + eta * dj1) - a2_ * (s + eta * ds);
+    return {1 + z_hc + z_disp, dz_hc + dz_disp};
+  }
+
+  /// @brief Computes residual Helmholtz energy divided by RT
+  /// @param[in] eta Packing fraction
+  double reduced_residual_helmholtz_energy(double eta) const noexcept {
+    const auto m = m_;
+    const auto om = 1 - eta;
+    const auto g = 1 / om + 1.5 * eta / (om * om) +
+                   0.5 * eta * eta / (om * om * om);
+    const auto a_hs = (4 * eta - 3 * eta * eta) / (om * om);
+
+    double i1 = 0.0, i2 = 0.0;
+    for (std::size_t k = 7; k-- > 0;) {
+      i1 = i1 * eta + c_.a[k];
+      i2 = i2 * eta + c_.b[k];
+    }
+    const auto c1 =
+        1 / (1 + m * (8 * eta - 2 * eta * eta) / (om * om * om * om) +
+             (1 - m) * (20 * eta - 27 * eta * eta + 12 * eta * eta * eta -
+                        2 * eta * eta * eta * eta) /
+                 (om * om * (2 - eta) * (2 - eta)));
+    return m * a_hs - (m - 1) * std::log(g) - a1_ * eta * i1 -
+           a2_ * eta * c1 * i2;
+  }
+
+  /// @brief Computes pressure
+  /// @param[in] v Molar volume [m3/mol]
+  double pressure(double v) const noexcept {
+    const auto eta = v0_ / v;
+    return this->evaluate(eta).z * rt_ / v;
+  }
+
+  /// @brief Computes pressures at given volumes
+  /// @param[in] v Molar volumes
+  /// @param[out] p Pressures
+  void pressure(gsl::span<const double> v,
+                gsl::span<double> p) const noexcept {
+    assert(v.size() == p.size());
+    for (std::size_t i = 0; i < v.size(); ++i) {
+      p[i] = this->pressure(v[i]);
+    }
+  }
+
+  /// @brief Computes molar volume at given pressure
+  /// @param[in] p Pressure
+  /// @param[in] selection Selection of a root
+  double volume(double p, root_selection selection) const noexcept {
+    return v0_ / this->packing_fraction(p, selection);
+  }
+
+  /// @brief Computes Z-factor at given pressure
+  /// @param[in] p Pressure
+  /// @param[in] selection Selection of a root
+  double zfactor(double p, root_selection selection) const noexcept {
+    return p * this->volume(p, selection) / rt_;
+  }
+
+  /// @brief Computes Z-factors at given pressures
+  /// @param[in] p Pressures
+  /// @param[out] z Z-factors
+  /// @param[in] selection Selection of a root
+  void zfactor(gsl::span<const double> p, gsl::span<double> z,
+               root_selection selection) const noexcept {
+    assert(p.size() == z.size());
+    for (std::size_t i = 0; i < p.size(); ++i) {
+      z[i] = this->zfactor(p[i], selection);
+    }
+  }
+
+  /// @brief Computes the natural logarithm of fugacity coefficient
+  /// @param[in] p Pressure
+  /// @param[in] z Z-factor
+  double ln_fugacity_coeff(double p, double z) const noexcept {
+    const auto eta = v0_ * p / (z * rt_);
+    return this->reduced_residual_helmholtz_energy(eta) + z - 1 -
+           std::log(z);
+  }
+
+  /// @brief Computes the natural logarithms of fugacity coefficients
+  /// @param[in] p Pressures
+  /// @param[out] ln_phi Natural logarithms of fugacity coefficients
+  /// @param[in] selection Selection of a root
+  void ln_fugacity_coeff(gsl::span<const double> p, gsl::span<double> ln_phi,
+                         root_selection selection) const noexcept {
+    assert(p.size() == ln_phi.size());
+    for (std::size_t i = 0; i < p.size(); ++i) {
+      ln_phi[i] = this->ln_fugacity_coeff(p[i], this->zfactor(p[i], selection));
+    }
+  }
+
+  /// @brief Computes saturation pressure by successive substitution
+  /// @param[in] p_init Initial pressure
+  /// @param[in] tol Tolerance of the relative difference of fugacity
+  /// @param[in] maxiter Maximum iteration
+  /// @return A pair of saturation pressure and iteration report
+  std::pair<double, flash_iteration_result> saturation_pressure(
+      double p_init, double tol = 1e-10, int maxiter = 100) const noexcept {
+    auto p = p_init;
+    double eps = 1.0;
+    int iter = 0;
+    while (eps > tol && iter < maxiter) {
+      double etal, etav;
+      if (!this->solve_packing_fraction(p, true, etal) ||
+          !this->solve_packing_fraction(p, false, etav) ||
+          !(etal > (1 + 1e-6) * etav)) {
+        return {0.0,
+                {eps, iter, flash_iteration_error::multiple_roots_not_found}};
+      }
+      const auto zl = v0_ * p / (etal * rt_);
+      const auto zv = v0_ * p / (etav * rt_);
+      const auto ratio = std::exp(this->ln_fugacity_coeff(p, zl) -
+                                  this->ln_fugacity_coeff(p, zv));
+      eps = std::fabs(1 - ratio);
+      p *= ratio;
+      ++iter;
+    }
+    if (eps > tol) {
+      return {0.0, {eps, iter, flash_iteration_error::not_converged}};
+    }
+    return {p, {eps, iter, flash_iteration_error::success}};
+  }
+
+  /// @brief Computes packing fraction at a molar volume
+  /// @param[in] v Molar volume [m3/mol]
+  double packing_fraction_at(double v) const noexcept { return v0_ / v; }
+
+  /// @brief Returns temperature
+  double temperature() const noexcept { return t_; }
+
+  /// @brief Returns temperature-dependent segment diameter [Angstrom]
+  double segment_diameter() const noexcept { return d_; }
+
+ private:
+  /// @brief Packing fraction of the closest packing of spheres
+  static constexpr double eta_max = 0.7405;
+
+  /// @brief Solves packing fraction at given pressure and selects a root
+  double packing_fraction(double p, root_selection selection) const noexcept {
+    double etav = 0.0, etal = 0.0;
+    if (selection != root_selection::smallest &&
+        !this->solve_packing_fraction(p, false, etav)) {
+      this->solve_packing_fraction(p, true, etal);
+      return etal;
+    }
+    if (selection == root_selection::largest) {
+      return etav;
+    }
+    if (!this->solve_packing_fraction(p, true, etal)) {
+      if (selection == root_selection::smallest) {
+        this->solve_packing_fraction(p, false, etav);
+      }
+      return etav;
+    }
+    if (selection == root_selection::smallest) {
+      return etal;
+    }
+    const auto zl = v0_ * p / (etal * rt_);
+    const auto zv = v0_ * p / (etav * rt_);
+    return this->ln_fugacity_coeff(p, zv) < this->ln_fugacity_coeff(p, zl)
+               ? etav
+               : etal;
+  }
+
+  /// @brief Solves packing fraction at given pressure by safeguarded
+  /// Newton's method
+  /// @param[in] p Pressure
+  /// @param[in] liquid True to start from a dense liquid
+  /// @param[out] eta Packing fraction
+  /// @return True if converged to a mechanically stable root
+  ///
+  /// The root is kept in a bracket, and a step leaving the bracket is
+  /// replaced by bisection. A point in the mechanically unstable region
+  /// bounds the bracket from the side opposite to the initial guess. The
+  /// product of packing fraction and Z-factor is concave on the vapor branch
+  /// and convex on the liquid branch, so the root does not exist if the
+  /// tangent at the stable end of the bracket does not reach the pressure at
+  /// the unstable end.
+  bool solve_packing_fraction(double p, bool liquid,
+                              double &eta) const noexcept {
+    const auto target = p * v0_ / rt_;  // eta Z at the root
+    double lo = 0.0, hi = eta_max;
+    double f_near = 0.0, df_near = 0.0;  // At the stable end of the bracket
+    bool unstable_end = false;
+    eta = liquid ? 0.5 : std::min(target, 0.1);
+    for (int iter = 0; iter < 100; ++iter) {
+      const auto x = this->evaluate(eta);
+      const auto f = eta * x.z - target;
+      const auto df = x.z + eta * x.dzde;
+      const auto stable = df > 0;
+      if (stable && std::fabs(f) < 1e-10 * eta * df) {
+        eta -= f / df;
+        return true;
+      }
+      if (f < 0 ? (stable || liquid) : (!stable && liquid)) {
+        lo = eta;
+      } else {
+        hi = eta;
+      }
+      if (stable && (f < 0) != liquid) {
+        f_near = f;
+        df_near = df;
+      }
+      unstable_end = unstable_end || !stable;
+      if (unstable_end && f_near != 0.0) {
+        const auto near = liquid ? hi : lo;
+        const auto far = liquid ? lo : hi;
+        if ((f_near + df_near * (far - near)) * f_near > 0) {
+          return false;
+        }
+      }
+      if (hi - lo < 1e-8 * hi) {
+        return false;
+      }
+      auto eta_new = stable ? eta - f / df : lo;
+      if (!(eta_new > lo && eta_new < std::min(hi, 2 * eta))) {
+        eta_new = 0.5 * (lo + std::min(hi, 2 * eta));
+      }
+      eta = eta_new;
+    }
+    return false;
+  }
+
+  double t_;   /// Temperature
+  double m_;   /// Segment number
+  double d_;   /// Segment diameter at the temperature
+  double v0_;  /// Molar volume of segments, eta / molar density
+  double a1_;  /// Factor of the first-order dispersion term
+  double a2_;  /// Factor of the second-order dispersion term
+  double rt_;  /// Gas constant times temperature
+  pc_saft_coefficients c_;
+};
+
+}  // namespace eos
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <cstdint>  // std::uint32_t
+#include <gsl/gsl>  // gsl::span
+#include <memory>   // std::unique_ptr
+#include <string>   // std::string
+
+#include "eos/cubic_eos/flash_iteration_result.hpp"
+#include "eos/cubic_eos/root_selection.hpp"
+#include "eos/server/property_protocol.hpp"
+
+namespace eos {
+
+/// @brief Client of property_server
+///
+/// Each client creates its own shared memory, which consists of a staging
+/// area and a user buffer. Arrays placed in the user buffer, which is
+/// obtained by buffer(), are read and written by the server in place. Other
+/// arrays are copied through the staging area, and large batches are split
+/// into chunks fitting in the staging area.
+class property_client {
+ public:
+  /// @param[in] socket_path Path of Unix domain socket of the server
+  /// @param[in] buffer_size Number of doubles in the user buffer
+  /// @param[in] staging_size Number of doubles in the staging area
+  ///
+  /// std::system_error is thrown if the client cannot connect to the server.
+  property_client(const std::string& socket_path, std::size_t buffer_size = 0,
+                  std::size_t staging_size = 1 << 16);
+  property_client(const property_client&) = delete;
+  property_client(property_client&&);
+
+  ~property_client();
+
+  property_client& operator=(const property_client&) = delete;
+  property_client& operator=(property_client&&);
+
+  /// @brief Registers a component and returns its fluid ID
+  /// @param[in] params Parameters of the component
+  std::uint32_t register_fluid(const fluid_params& params);
+
+  /// @brief Computes Z-factors
+  /// @param[in] fluid Fluid ID
+  /// @param[in] p Pressures [Pa]
+  /// @param[in] t Temperatures [K]
+  /// @param[out] z Z-factors
+  /// @param[in] selection Selection of a root
+  void zfactor(std::uint32_t fluid, gsl::span<const double> p,
+               gsl::span<const double> t, gsl::span<double> z,
+               root_selection selection);
+
+  /// @brief Computes vapor pressures
+  /// @param[in] fluid Fluid ID
+  /// @param[in] p_init Initial pressures [Pa]
+  /// @param[in] t Temperatures [K]
+  /// @param[out] p Vapor pressures [Pa]
+  /// @param[out] r Iteration reports
+  void vapor_pressure(std::uint32_t fluid, gsl::span<const double> p_init,
+                      gsl::span<const double> t, gsl::span<double> p,
+                      gsl::span<flash_iteration_result> r);
+
+  /// @brief Computes gas viscosities by Lucas' method
+  /// @param[in] fluid Fluid ID
+  /// @param[in] p Pressures [Pa]
+  /// @param[in] t Temperatures [K]
+  /// @param[out] mu Viscosities [Pa-s]
+  void viscosity(std::uint32_t fluid, gsl::span<const double> p,
+                 gsl::span<const double> t, gsl::span<double> mu);
+
+  /// @brief Returns the user buffer in the shared memory
+  ///
+  /// Arrays in this buffer are exchanged with the server without copy.
+  gsl::span<double> buffer() noexcept;
+
+ private:
+  class impl;
+  std::unique_ptr<impl> pimpl_;
+};
+
+}  // namespace eos
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <cstddef>  // std::size_t
+#include <cstdint>  // std::uint32_t, std::uint64_t
+
+namespace eos {
+
+/// @brief Cubic EoS served by property_server
+enum class served_eos : std::uint32_t {
+  soave_redlich_kwong,
+  peng_robinson,
+};
+
+/// @brief Parameters of a pure component registered to property_server
+///
+/// Components with identical parameters share the same model on the server.
+struct fluid_params {
+  served_eos eos;  /// Cubic EoS
+  double pc;       /// Critical pressure [Pa]
+  double tc;       /// Critical temperature [K]
+  double omega;    /// Acentric factor
+  double zc;       /// Critical Z-factor
+  double mw;       /// Molecular weight [kg/kmol]
+  double dm;       /// Dipole moment [debyes]
+  double q;        /// Quantum parameter, used only for H2, He, and D2
+};
+
+/// @brief Type of a request sent to property_server
+enum class property_request_type : std::uint32_t {
+  attach,          /// Maps the shared memory of a client
+  register_fluid,  /// Registers a component
+  zfactor,         /// Computes Z-factors from pressure and temperature
+  vapor_pressure,  /// Computes vapor pressures from temperature
+  viscosity,       /// Computes viscosities from pressure and temperature
+};
+
+/// @brief Status of a request processed by property_server
+enum class property_status : std::uint32_t {
+  success,
+  invalid_request,
+  invalid_fluid,
+  out_of_range,
+};
+
+/// @brief Request sent from a client over a Unix domain socket
+///
+/// Inputs and outputs are not sent over the socket. They are placed in the
+/// shared memory of the client and referred to by byte offsets from the
+/// beginning of the shared memory. The usage of the offsets depends on the
+/// type of a request:
+///
+/// | type           | offset[0] | offset[1] | offset[2] | offset[3] |
+/// |----------------|-----------|-----------|-----------|-----------|
+/// | zfactor        | p         | t         | z         |           |
+/// | vapor_pressure | p_init    | t         | p         | report    |
+/// | viscosity      | p         | t         | mu        |           |
+///
+/// where report is an array of flash_iteration_result.
+struct property_request {
+  static constexpr std::size_t max_name_length = 64;
+
+  property_request_type type;  /// Type of the request
+  std::uint32_t fluid;         /// Fluid ID returned by register_fluid
+  std::uint32_t option;        /// eos::root_selection for zfactor
+  std::uint32_t reserved;      /// Unused
+  std::uint64_t count;         /// Number of points
+  std::uint64_t offset[4];     /// Byte offsets of arrays
+  fluid_params params;         /// Parameters for register_fluid
+  char name[max_name_length];  /// Name of shared memory for attach
+};
+
+/// @brief Response sent from property_server over a Unix domain socket
+struct property_response {
+  property_status status;
+  std::uint32_t fluid;  /// Fluid ID for register_fluid
+};
+
+}  // namespace eos
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <atomic>  // std::atomic
+#include <memory>  // std::unique_ptr
+#include <string>  // std::string
+
+#include "eos/server/property_protocol.hpp"
+
+namespace eos {
+
+/// @brief Local property server shared by multiple processes
+///
+/// The server owns thermodynamic models of registered components and serves
+/// batch requests from clients on the same machine. Requests are sent over a
+/// Unix domain socket, while inputs and outputs are exchanged through shared
+/// memory created by each client, so that batches are never copied through
+/// the socket.
+///
+/// Each connection is served by its own worker thread, which receives a
+/// request in pieces as they arrive. Batches of different clients run
+/// concurrently, and a client stalled in the middle of a request blocks only
+/// its own connection. Registered fluids are shared by the workers.
+class property_server {
+ public:
+  /// @param[in] socket_path Path of Unix domain socket
+  ///
+  /// std::system_error is thrown if the socket cannot be created.
+  property_server(const std::string& socket_path);
+  property_server(const property_server&) = delete;
+  property_server(property_server&&) = delete;
+
+  ~property_server();
+
+  property_server& operator=(const property_server&) = delete;
+  property_server& operator=(property_server&&) = delete;
+
+  /// @brief Serves requests until stop() is called
+  void run();
+
+  /// @brief Requests run() to return
+  ///
+  /// This function can be called from another thread or a signal handler.
+  void stop() noexcept { running_ = false; }
+
+  /// @brief Returns the number of registered fluids
+  std::size_t num_fluids() const noexcept;
+
+ private:
+  class impl;
+  std::unique_ptr<impl> pimpl_;
+  std::atomic<bool> running_;
+};
+
+}  // namespace eos
@@ -0,0 +1,107 @@
+#pragma once
+
+#include <array>    // std::array
+#include <gsl/gsl>  // gsl::span
+
+#include "eos/cubic_eos/flash_iteration_result.hpp"
+
+namespace eos {
+
+/// @brief Mutual solubilities of CO2 and NaCl brine
+struct co2_brine_equilibrium {
+  double x_co2;                   /// Mole fraction of CO2 in the aqueous phase
+  double y_h2o;                   /// Mole fraction of H2O in the CO2 phase
+  flash_iteration_result result;  /// Report of the validity of the result
+};
+
+/// @brief Mutual solubility model of CO2 and NaCl brine of Spycher et al.
+///
+/// Equilibrium constants of the CO2-rich phase and the aqueous phase give
+/// \f[ A = \frac{K_{H_2O}}{\phi_{H_2O} P} \exp \frac{(P - P^0)
+/// \bar{V}_{H_2O}}{RT}, \quad B = \frac{\phi_{CO_2} P}{55.508 \gamma K_{CO_2}}
+/// \exp \left( -\frac{(P - P^0) \bar{V}_{CO_2}}{RT} \right), \f]
+/// \f[ y_{H_2O} = \frac{(1 - B) 55.508}{(1/A - B)(2m + 55.508) + 2mB},
+/// \quad x_{CO_2} = B (1 - y_{H_2O}), \f]
+/// where \f$ m \f$ is the molality of NaCl, and the activity coefficient of
+/// CO2 in brine, \f$ \gamma \f$, is that of Duan and Sun. Fugacity
+/// coefficients of the CO2-rich phase are computed by Redlich-Kwong EoS with
+/// the parameters of Spycher et al. (2003), \f$ a_{CO_2} = 7.54 \times 10^7
+/// - 4.13 \times 10^4 T \f$, \f$ a_{H_2O-CO_2} = 7.89 \times 10^7 \f$,
+/// \f$ b_{CO_2} = 27.80 \f$ and \f$ b_{H_2O} = 18.18 \f$, at infinite
+/// dilution of water as in the paper. Redlich-Kwong EoS shares the cubic
+/// equation and soave_redlich_kwong_eos::ln_fugacity_coeff in the reduced
+/// parameters, which are used as the kernel. Since the fugacity coefficients
+/// do not depend on composition, the equations are solved directly.
+///
+/// The equilibrium constants of gaseous CO2, and of liquid CO2 below the
+/// critical temperature and critical volume of CO2, are valid from 12 to 100
+/// Celsius degrees and up to 600 bar. In this range, mole fractions of CO2
+/// in pure water agree with measured values within 10%.
+///
+/// See Spycher, N., Pruess, K., Ennis-King, J. 2003. "CO2-H2O mixtures in
+/// the geological sequestration of CO2. I. Assessment and calculation of
+/// mutual solubilities from 12 to 100 C and up to 600 bar", Geochimica et
+/// Cosmochimica Acta 67(16), 3015-3031.
+class co2_brine_solubility {
+ public:
+  // Member functions
+
+  /// @brief Computes mutual solubilities
+  /// @param[in] p Pressure [Pa]
+  /// @param[in] t Temperature [K]
+  /// @param[in] m Molality of NaCl [mol/kg]
+  ///
+  /// The result reports flash_iteration_error::not_converged if mole
+  /// fractions are out of (0, 1), which is out of the range of the model.
+  co2_brine_equilibrium solve(double p, double t, double m) const noexcept;
+
+  /// @brief Computes mutual solubilities at multiple points
+  /// @param[in] p Pressures [Pa]
+  /// @param[in] t Temperatures [K]
+  /// @param[in] m Molalities of NaCl [mol/kg]
+  /// @param[out] x_co2 Mole fractions of CO2 in the aqueous phase
+  /// @param[out] y_h2o Mole fractions of H2O in the CO2 phase
+  /// @param[out] r Reports of the validity of results
+  void solve(gsl::span<const double> p, gsl::span<const double> t,
+             gsl::span<const double> m, gsl::span<double> x_co2,
+             gsl::span<double> y_h2o,
+             gsl::span<flash_iteration_result> r) const noexcept;
+
+  /// @brief Computes natural logarithms of fugacity coefficients of the
+  /// CO2-rich phase
+  /// @param[in] p Pressure [Pa]
+  /// @param[in] t Temperature [K]
+  /// @return Logarithms of fugacity coefficients of CO2 and H2O
+  std::array<double, 2> ln_fugacity_coeffs(double p, double t) const
+      noexcept;
+
+  /// @brief Computes the natural logarithm of the activity coefficient of
+  /// CO2 in NaCl brine by the model of Duan and Sun
+  /// @param[in] p Pressure [Pa]
+  /// @param[in] t Temperature [K]
+  /// @param[in] m Molality of NaCl [mol/kg]
+  static double ln_activity_coeff(double p, double t, double m) noexcept;
+
+ private:
+  /// @brief Terms of the equations independent of composition
+  struct isobaric_isothermal_terms {
+    double a;           /// \f$ A \phi_{H_2O} \f$
+    double b;           /// \f$ B / \phi_{CO_2} \f$
+    double nu_m;        /// Molality of ions
+    double ar_co2;      /// Reduced attraction parameter of CO2
+    double ar_h2o_co2;  /// Reduced attraction parameter of H2O-CO2
+    double br_co2;      /// Reduced repulsion parameter of CO2
+    double br_h2o;      /// Reduced repulsion parameter of H2O
+    double z;           /// Z-factor of CO2
+  };
+
+  /// @brief Computes the terms at a pressure and temperature
+  static isobaric_isothermal_terms create_terms(double p, double t,
+                                                double m) noexcept;
+
+  /// @brief Computes logarithms of fugacity coefficients from the terms
+  static std::array<double, 2> ln_fugacity_coeffs(
+      const isobaric_isothermal_terms &c) noexcept;
+};
+
+}  // namespace eos
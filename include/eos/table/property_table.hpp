@@ -0,0 +1,143 @@
+#pragma once
+
+#include <cstddef>  // std::size_t
+#include <cstdint>  // std::int16_t, std::uint8_t
+#include <gsl/gsl>  // gsl::span
+#include <iosfwd>   // std::istream, std::ostream
+#include <vector>   // std::vector
+
+namespace eos {
+
+/// @brief Encoding of values of a property table
+enum class table_encoding : std::uint32_t {
+  float64,   /// Double precision
+  float32,   /// Single precision
+  bfloat16,  /// bfloat16 scaled into [0, 1] by block
+  float16,   /// IEEE half precision scaled into [0, 1] by block
+  delta8     /// 8-bit quantized differences from the first value of a block
+};
+
+/// @brief Uniform axis of a property table
+struct table_axis {
+  double first;      /// The first node
+  double step;       /// Interval of nodes
+  std::size_t size;  /// Number of nodes
+
+  /// @brief Returns the i-th node
+  double operator[](std::size_t i) const noexcept {
+    return first + static_cast<double>(i) * step;
+  }
+};
+
+/// @brief Header of a property table
+struct property_table_header {
+  table_encoding encoding;
+  table_axis x;            /// Axis of the fastest index
+  table_axis y;            /// Axis of the slowest index
+  std::size_t block_size;  /// Number of values of a block along x
+  double max_abs_error;    /// Maximum absolute error of encoded values
+  double max_rel_error;    /// Maximum relative error of nonzero values
+};
+
+/// @brief Property tabulated on a uniform 2D grid in compact storage
+///
+/// Values at nodes are stored in row-major order with x as the fastest
+/// index, and rows are split into blocks of the given size. The encodings of
+/// 16 bits store values normalized by the minimum and range of each block,
+/// and delta8 stores the first value of each block and quantized differences
+/// with the error fed back, so that errors do not accumulate along a block.
+/// The maximum errors of encoded values against the source values are
+/// measured when a table is built and recorded in its header.
+///
+/// Values are bilinearly interpolated, decoding the four nodes of a cell
+/// directly from the storage. Points outside the grid are extrapolated from
+/// the nearest cell, and values at non-finite coordinates are NaN. Batches
+/// are interpolated by tiles of points, whose cells and weights are computed
+/// by vectorized loops. delta8 tables keep the running sums of differences at
+/// every 8th value of a block in memory, so that a value is decoded from an
+/// anchor and at most 7 differences. The anchors are rebuilt on reading and
+/// are not written.
+class property_table {
+ public:
+  property_table() = default;
+  property_table(const property_table &) = default;
+  property_table(property_table &&) = default;
+
+  property_table &operator=(const property_table &) = default;
+  property_table &operator=(property_table &&) = default;
+
+  /// @brief Builds table from values at nodes
+  /// @param[in] encoding Encoding of values
+  /// @param[in] x Axis of the fastest index
+  /// @param[in] y Axis of the slowest index
+  /// @param[in] values Values at nodes in row-major order
+  /// @param[in] block_size Number of values of a block along x
+  /// @throw std::invalid_argument if the block size of delta8 exceeds 256
+  property_table(table_encoding encoding, const table_axis &x,
+                 const table_axis &y, gsl::span<const double> values,
+                 std::size_t block_size = 16);
+
+  /// @brief Interpolates the property at a point
+  double interpolate(double x, double y) const noexcept;
+
+  /// @brief Interpolates the property at points
+  /// @param[in] x x-coordinates
+  /// @param[in] y y-coordinates
+  /// @param[out] value Interpolated values
+  void interpolate(gsl::span<const double> x, gsl::span<const double> y,
+                   gsl::span<double> value) const noexcept;
+
+  /// @brief Decodes the value at a node
+  double value(std::size_t i, std::size_t j) const noexcept;
+
+  const property_table_header &header() const noexcept { return header_; }
+
+  /// @brief Returns the size of encoded values, block parameters and anchors
+  /// in bytes
+  std::size_t storage_bytes() const noexcept;
+
+  /// @brief Writes table in a binary format
+  void write(std::ostream &os) const;
+
+  /// @brief Reads table written by write()
+  /// @throw std::runtime_error if the format is invalid
+  static property_table read(std::istream &is);
+
+  /// @brief Parameters of a block
+  struct block_params {
+    double offset;  /// Minimum value, or the first value for delta8
+    double scale;   /// Range of values, or the step of quantization
+  };
+
+  /// Interval of the anchors of delta8
+  static constexpr std::size_t anchor_interval = 8;
+
+ private:
+  property_table_header header_;
+  std::vector<block_params> blocks_;
+  std::vector<std::uint8_t> data_;     /// Encoded values
+  std::vector<std::int16_t> anchors_;  /// Running sums of delta8
+
+  /// @brief Builds the anchors of delta8 from encoded values
+  void build_anchors();
+};
+
+/// @brief Tabulates a function on a uniform 2D grid
+/// @param[in] x Axis of the fastest index
+/// @param[in] y Axis of the slowest index
+/// @param[in] f Function of (x, y)
+/// @return Values at nodes in row-major order
+template <typename Function>
+std::vector<double> tabulate(const table_axis &x, const table_axis &y,
+                             Function &&f) {
+  std::vector<double> values;
+  values.reserve(x.size * y.size);
+  for (std::size_t j = 0; j < y.size; ++j) {
+    for (std::size_t i = 0; i < x.size; ++i) {
+      values.push_back(f(x[i], y[j]));
+    }
+  }
+  return values;
+}
+
+}  // namespace eos
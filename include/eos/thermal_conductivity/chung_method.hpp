@@ -0,0 +1,149 @@
+#pragma once
+
+#include <array>    // std::array
+#include <gsl/gsl>  // gsl::span
+
+#include "eos/common/thermodynamic_constants.hpp"  // eos::gas_constant
+#include "eos/cubic_eos/root_selection.hpp"
+#include "eos/ideal_gas/ideal_gas_heat_capacity.hpp"
+
+namespace eos {
+
+/// @brief Chung's method at a temperature
+///
+/// The dilute-gas conductivity and the factor of the dense-fluid correction
+/// depend only on temperature and are computed by the constructor, so that a
+/// point on an isotherm needs only two exponentials of the reduced density.
+class chung_isothermal_line {
+ public:
+  chung_isothermal_line() = default;
+  chung_isothermal_line(const chung_isothermal_line &) = default;
+  chung_isothermal_line(chung_isothermal_line &&) = default;
+  chung_isothermal_line &operator=(const chung_isothermal_line &) = default;
+  chung_isothermal_line &operator=(chung_isothermal_line &&) = default;
+
+  /// @param[in] lambda0 Thermal conductivity at low pressure [W/m-K]
+  /// @param[in] k Factor of the dense-fluid term [W/m-K]
+  /// @param[in] vc Critical volume divided by six [m3/mol]
+  /// @param[in] b Coefficients B1 to B7
+  chung_isothermal_line(double lambda0, double k, double vc,
+                        const std::array<double, 7> &b) noexcept
+      : lambda0_{lambda0}, k_{k}, vc_{vc}, b_{b} {}
+
+  /// @brief Computes thermal conductivity [W/m-K]
+  /// @param[in] rho Molar density [mol/m3]
+  double thermal_conductivity(double rho) const noexcept;
+
+  /// @brief Computes thermal conductivities
+  /// @param[in] rho Molar densities [mol/m3]
+  /// @param[out] lambda Thermal conductivities [W/m-K]
+  ///
+  /// The loop is branch-free with the exponentials of eos::vector_math and
+  /// is vectorized by GCC and Clang.
+  void thermal_conductivity(gsl::span<const double> rho,
+                            gsl::span<double> lambda) const noexcept;
+
+  /// @brief Returns thermal conductivity at low pressure [W/m-K]
+  double thermal_conductivity_at_low_pressure() const noexcept {
+    return lambda0_;
+  }
+
+ private:
+  double lambda0_;  /// Thermal conductivity at low pressure
+  double k_;        /// q * B7 * Tr^(1/2)
+  double vc_;       /// Critical volume divided by six
+  std::array<double, 7> b_;  /// Coefficients B1 to B7
+};
+
+/// @brief Thermal conductivity of a pure fluid by the method of Chung et al.
+///
+/// The thermal conductivity of dense fluids is
+/// \f[ \lambda = \frac{31.2 \eta_0 \Psi}{M'} (G_2^{-1} + B_6 y) + q B_7 y^2
+/// T_r^{1/2} G_2, \f]
+/// where \f$ y = \rho V_c / 6 \f$, \f$ \eta_0 \f$ is the viscosity of the
+/// dilute gas by Chung's method, and \f$ \Psi \f$ depends on the ideal gas
+/// heat capacity. See Section 10-5 of Poling et al. 2001. "The Properties of
+/// Gases and Liquids", fifth edition.
+class chung_method {
+ public:
+  // Constructors
+
+  chung_method() = default;
+
+  /// @brief Constructs object
+  /// @param[in] tc Critical temperature [K]
+  /// @param[in] vc Critical volume [m3/mol]
+  /// @param[in] omega Acentric factor
+  /// @param[in] mw Molecular weight [kg/kmol]
+  /// @param[in] dm Dipole moment [Debyes]
+  /// @param[in] kappa Association factor
+  /// @param[in] cp Ideal gas heat capacity
+  chung_method(double tc, double vc, double omega, double mw, double dm,
+               double kappa, const ideal_gas_heat_capacity &cp) noexcept;
+
+  chung_method(const chung_method &) = default;
+  chung_method(chung_method &&) = default;
+  chung_method &operator=(const chung_method &) = default;
+  chung_method &operator=(chung_method &&) = default;
+
+  // Member functions
+
+  /// @brief Creates isothermal line caching temperature-only terms
+  /// @param[in] t Temperature [K]
+  chung_isothermal_line create_isothermal_line(double t) const noexcept;
+
+  /// @brief Computes thermal conductivity at low pressure
+  /// @param[in] t Temperature [K]
+  /// @return Thermal conductivity [W/m-K]
+  double thermal_conductivity_at_low_pressure(double t) const noexcept {
+    return this->create_isothermal_line(t)
+        .thermal_conductivity_at_low_pressure();
+  }
+
+  /// @brief Computes thermal conductivity
+  /// @param[in] t Temperature [K]
+  /// @param[in] rho Molar density [mol/m3]
+  /// @return Thermal conductivity [W/m-K]
+  double thermal_conductivity(double t, double rho) const noexcept {
+    return this->create_isothermal_line(t).thermal_conductivity(rho);
+  }
+
+  /// @brief Computes thermal conductivity at the density of an EoS
+  /// @tparam State Isobaric-isothermal state of an EoS
+  /// @param[in] state State of the pressure and temperature
+  /// @param[in] selection Selection of a root
+  /// @return Thermal conductivity [W/m-K]
+  template <typename State>
+  double thermal_conductivity(const State &state,
+                              root_selection selection) const noexcept {
+    constexpr auto R = gas_constant<double>();
+    const auto t = state.temperature();
+    const auto z = state.zfactor(selection);
+    return this->thermal_conductivity(t, state.pressure() / (z * R * t));
+  }
+
+  /// @brief Computes thermal conductivities
+  /// @param[in] t Temperatures [K]
+  /// @param[in] rho Molar densities [mol/m3]
+  /// @param[out] lambda Thermal conductivities [W/m-K]
+  ///
+  /// Temperature-only terms are recomputed only when temperature changes
+  /// between consecutive points, so points should be ordered by temperature.
+  /// Each run of the same temperature is computed by the vectorized loop of
+  /// chung_isothermal_line.
+  void thermal_conductivity(gsl::span<const double> t,
+                            gsl::span<const double> rho,
+                            gsl::span<double> lambda) const noexcept;
+
+ private:
+  double tc_;                   /// Critical temperature [K]
+  double vc_;                   /// Critical volume [m3/mol]
+  double mw_;                   /// Molecular weight [kg/kmol]
+  double fc_;                   /// Factor of the dilute-gas viscosity
+  double beta_;                 /// Factor of Psi depending on acentric factor
+  double q_;                    /// Factor of the dense-fluid term [W/m-K]
+  std::array<double, 7> b_;     /// Coefficients B1 to B7
+  ideal_gas_heat_capacity cp_;  /// Ideal gas heat capacity
+};
+
+}  // namespace eos
@@ -1,6 +1,7 @@
 #pragma once
 
-#include <cmath>  // std::log, std::exp, std::fabs, std::pow
+#include <cmath>    // std::log, std::exp, std::fabs, std::pow
+#include <gsl/gsl>  // gsl::span
 
 namespace eos {
 
@@ -48,6 +49,20 @@ class lucas_method {
   /// @return Viscosity [Pa-s]
   double viscosity_at_high_pressure(double p, double t) const noexcept;
 
+  /// @brief Computes gas viscosities at low pressure
+  /// @param[in] t Temperatures [K]
+  /// @param[out] mu Viscosities [Pa-s]
+  void viscosity_at_low_pressure(gsl::span<const double> t,
+                                 gsl::span<double> mu) const noexcept;
+
+  /// @brief Computes gas viscosities at high pressure
+  /// @param[in] p Pressures [Pa]
+  /// @param[in] t Temperatures [K]
+  /// @param[out] mu Viscosities [Pa-s]
+  void viscosity_at_high_pressure(gsl::span<const double> p,
+                                  gsl::span<const double> t,
+                                  gsl::span<double> mu) const noexcept;
+
  private:
   // Static functions
 
@@ -0,0 +1,143 @@
+#pragma once
+
+#include <gsl/gsl>  // gsl::span
+
+namespace eos {
+
+/// @brief Region of IAPWS-IF97
+enum class if97_region {
+  liquid,            /// Region 1, compressed liquid
+  vapor,             /// Region 2, superheated vapor
+  near_critical,     /// Region 3, near the critical point
+  two_phase,         /// Region 4, saturation
+  high_temperature,  /// Region 5, not supported
+  out_of_range       /// Outside the range of IAPWS-IF97
+};
+
+/// @brief Properties of water at a pressure and temperature
+struct if97_properties {
+  double v;   /// Specific volume [m3/kg]
+  double h;   /// Specific enthalpy [J/kg]
+  double s;   /// Specific entropy [J/kg-K]
+  double cp;  /// Specific isobaric heat capacity [J/kg-K]
+  double w;   /// Speed of sound [m/s]
+};
+
+/// @brief IAPWS-IF97 formulation of water and steam
+///
+/// Regions 1 and 2 are computed from the fundamental equations of Gibbs
+/// energy, region 3 from that of Helmholtz energy, and the saturation line
+/// of region 4 from the saturation-pressure equation. Temperature from
+/// pressure and enthalpy or entropy is given by the backward equations
+/// without iteration, those of the supplementary release of 2003 in
+/// subregions 3a and 3b. Coefficients are stored as tables of exponents and
+/// coefficients, and the powers of reduced variables are tabulated once per
+/// point by repeated multiplication.
+///
+/// Since region 3 is explicit in density, density is solved from pressure
+/// by Newton's method. Whether a state of given enthalpy or entropy in
+/// region 3 is in the two-phase region is also decided by the fundamental
+/// equation at the saturation temperature.
+///
+/// Region 5 is not supported: properties() returns NaN there, and
+/// temperature_ph() and temperature_ps() extrapolate the backward equations
+/// of region 2. Callers can check the region by region(). All the
+/// values are in SI units, e.g. pressure in Pa.
+class iapws_if97 {
+ public:
+  /// @brief Detects region
+  /// @param[in] p Pressure [Pa]
+  /// @param[in] t Temperature [K]
+  static if97_region region(double p, double t) noexcept;
+
+  /// @brief Computes saturation pressure [Pa]
+  /// @param[in] t Temperature [K]
+  static double saturation_pressure(double t) noexcept;
+
+  /// @brief Computes saturation temperature [K]
+  /// @param[in] p Pressure [Pa]
+  static double saturation_temperature(double p) noexcept;
+
+  /// @brief Computes pressure of the boundary between regions 2 and 3 [Pa]
+  /// @param[in] t Temperature [K]
+  static double boundary23_pressure(double t) noexcept;
+
+  /// @brief Computes temperature of the boundary between regions 2 and 3 [K]
+  /// @param[in] p Pressure [Pa]
+  static double boundary23_temperature(double p) noexcept;
+
+  /// @brief Computes properties in the region at a pressure and temperature
+  /// @param[in] p Pressure [Pa]
+  /// @param[in] t Temperature [K]
+  /// @return Properties, or NaN in region 5 and out of range
+  static if97_properties properties(double p, double t) noexcept;
+
+  /// @brief Computes properties by the equation of region 1
+  /// @param[in] p Pressure [Pa]
+  /// @param[in] t Temperature [K]
+  static if97_properties liquid_properties(double p, double t) noexcept;
+
+  /// @brief Computes properties by the equation of region 2
+  /// @param[in] p Pressure [Pa]
+  /// @param[in] t Temperature [K]
+  static if97_properties vapor_properties(double p, double t) noexcept;
+
+  /// @brief Computes properties by the equation of region 3
+  /// @param[in] p Pressure [Pa]
+  /// @param[in] t Temperature [K]
+  ///
+  /// Density is on the vapor branch if pressure is below the saturation
+  /// pressure, and on the liquid branch otherwise.
+  static if97_properties near_critical_properties(double p,
+                                                  double t) noexcept;
+
+  /// @brief Computes temperature from pressure and enthalpy
+  /// @param[in] p Pressure [Pa]
+  /// @param[in] h Specific enthalpy [J/kg]
+  /// @return Temperature [K], or saturation temperature in region 4
+  static double temperature_ph(double p, double h) noexcept;
+
+  /// @brief Computes temperature from pressure and entropy
+  /// @param[in] p Pressure [Pa]
+  /// @param[in] s Specific entropy [J/kg-K]
+  /// @return Temperature [K], or saturation temperature in region 4
+  static double temperature_ps(double p, double s) noexcept;
+
+  /// @brief Computes saturation pressures
+  /// @param[in] t Temperatures
+  /// @param[out] p Saturation pressures
+  static void saturation_pressure(gsl::span<const double> t,
+                                  gsl::span<double> p) noexcept;
+
+  /// @brief Computes densities
+  /// @param[in] p Pressures
+  /// @param[in] t Temperatures
+  /// @param[out] rho Densities [kg/m3]
+  static void density(gsl::span<const double> p, gsl::span<const double> t,
+                      gsl::span<double> rho) noexcept;
+
+  /// @brief Computes specific enthalpies
+  /// @param[in] p Pressures
+  /// @param[in] t Temperatures
+  /// @param[out] h Specific enthalpies
+  static void enthalpy(gsl::span<const double> p, gsl::span<const double> t,
+                       gsl::span<double> h) noexcept;
+
+  /// @brief Computes temperatures from pressures and enthalpies
+  /// @param[in] p Pressures
+  /// @param[in] h Specific enthalpies
+  /// @param[out] t Temperatures
+  static void temperature_ph(gsl::span<const double> p,
+                             gsl::span<const double> h,
+                             gsl::span<double> t) noexcept;
+
+  /// @brief Computes temperatures from pressures and entropies
+  /// @param[in] p Pressures
+  /// @param[in] s Specific entropies
+  /// @param[out] t Temperatures
+  static void temperature_ps(gsl::span<const double> p,
+                             gsl::span<const double> s,
+                             gsl::span<double> t) noexcept;
+};
+
+}  // namespace eos
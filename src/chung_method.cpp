@@ -0,0 +1,115 @@
+#include "eos/thermal_conductivity/chung_method.hpp"
+
+#include <cassert>  // assert
+#include <cmath>    // std::cbrt, std::exp, std::pow, std::sqrt
+
+#include "eos/math/vector_math.hpp"  // eos::vector_math::exp, expm1
+
+namespace eos {
+
+namespace {
+
+/// @brief Computes thermal conductivity at a reduced density, y
+///
+/// The function is branch-free so that loops over densities are vectorized.
+EOS_VECTOR_INLINE double chung_conductivity(double lambda0, double k,
+                                            const std::array<double, 7> &b,
+                                            double y) noexcept {
+  const auto x = 1 / (1 - y);
+  const auto g1 = (1 - 0.5 * y) * x * x * x;
+  // B1 (1 - exp(-B4 y)) / y tends to B1 B4 in the limit of zero density
+  const auto h0 = -b[0] * vector_math::expm1(-b[3] * y) / y;
+  const auto h = y > 0 ? h0 : b[0] * b[3];
+  const auto g2 = (h + b[1] * g1 * vector_math::exp(b[4] * y) + b[2] * g1) /
+                  (b[0] * b[3] + b[1] + b[2]);
+  return lambda0 * (1 / g2 + b[5] * y) + k * y * y * g2;
+}
+
+}  // namespace
+
+double chung_isothermal_line::thermal_conductivity(double rho) const
+    noexcept {
+  return chung_conductivity(lambda0_, k_, b_, rho * vc_);
+}
+
+void chung_isothermal_line::thermal_conductivity(
+    gsl::span<const double> rho, gsl::span<double> lambda) const noexcept {
+  assert(rho.size() == lambda.size());
+  // Copies members to locals so that the loop does not reload them
+  const auto lambda0 = lambda0_, k = k_, vc = vc_;
+  const auto b = b_;
+  const auto r = rho.data();
+  const auto l = lambda.data();
+  for (std::size_t i = 0; i < rho.size(); ++i) {
+    l[i] = chung_conductivity(lambda0, k, b, r[i] * vc);
+  }
+}
+
+chung_method::chung_method(double tc, double vc, double omega, double mw,
+                           double dm, double kappa,
+                           const ideal_gas_heat_capacity &cp) noexcept
+    : tc_{tc}, vc_{vc}, mw_{mw}, cp_{cp} {
+  // Coefficients a, b, c and d of B_i = a + b omega + c mu_r^4 + d kappa
+  constexpr std::array<std::array<double, 4>, 7> coeffs = {{
+      {2.4166, 7.4824e-1, -9.1858e-1, 1.2172e2},
+      {-5.0924e-1, -1.5094, -4.9991e1, 6.9983e1},
+      {6.6107, 5.6207, 6.4760e1, 2.7039e1},
+      {1.4543e1, -8.9139, -5.6379, 7.4344e1},
+      {7.9274e-1, 8.2019e-1, -6.9369e-1, 6.3173},
+      {-5.8634, 1.2801e1, 9.5893, 6.5529e1},
+      {9.1089e1, 1.2811e2, -5.4217e1, 5.2381e2},
+  }};
+  const auto vc_cm3 = vc * 1e6;
+  const auto mur = 131.3 * dm / std::sqrt(vc_cm3 * tc);
+  const auto mur2 = mur * mur;
+  const auto mur4 = mur2 * mur2;
+  for (std::size_t i = 0; i < 7; ++i) {
+    const auto &c = coeffs[i];
+    b_[i] = c[0] + c[1] * omega + c[2] * mur4 + c[3] * kappa;
+  }
+  const auto vc23 = std::cbrt(vc_cm3 * vc_cm3);
+  fc_ = 1 - 0.2756 * omega + 0.059035 * mur4 + kappa;
+  beta_ = 0.7862 - 0.7109 * omega + 1.3168 * omega * omega;
+  q_ = 3.586e-3 * std::sqrt(tc / (mw * 1e-3)) / vc23;
+}
+
+chung_isothermal_line chung_method::create_isothermal_line(double t) const
+    noexcept {
+  constexpr auto R = gas_constant<double>();
+  const auto tr = t / tc_;
+
+  // Viscosity of dilute gas [Pa-s]
+  const auto ts = 1.2593 * tr;
+  const auto omega_v = 1.16145 * std::pow(ts, -0.14874) +
+                       0.52487 * std::exp(-0.77320 * ts) +
+                       2.16178 * std::exp(-2.43787 * ts);
+  const auto vc_cm3 = vc_ * 1e6;
+  const auto eta0 = 40.785e-7 * fc_ * std::sqrt(mw_ * t) /
+                    (std::cbrt(vc_cm3 * vc_cm3) * omega_v);
+
+  const auto alpha = cp_.isobaric_heat_capacity(t) / R - 2.5;
+  const auto z = 2 + 10.5 * tr * tr;
+  const auto psi =
+      1 + alpha * (0.215 + 0.28288 * alpha - 1.061 * beta_ + 0.26665 * z) /
+              (0.6366 + beta_ * z + 1.061 * alpha * beta_);
+  const auto lambda0 = 31.2 * eta0 * psi / (mw_ * 1e-3);
+  return {lambda0, q_ * b_[6] * std::sqrt(tr), vc_ / 6, b_};
+}
+
+void chung_method::thermal_conductivity(gsl::span<const double> t,
+                                        gsl::span<const double> rho,
+                                        gsl::span<double> lambda) const
+    noexcept {
+  assert(t.size() == rho.size() && t.size() == lambda.size());
+  // Points of the same temperature are computed by the loop of a line
+  for (std::size_t first = 0, last = 0; first < t.size(); first = last) {
+    while (last < t.size() && t[last] == t[first]) {
+      ++last;
+    }
+    this->create_isothermal_line(t[first])
+        .thermal_conductivity(rho.subspan(first, last - first),
+                              lambda.subspan(first, last - first));
+  }
+}
+
+}  // namespace eos
@@ -0,0 +1,150 @@
+#include "eos/solubility/co2_brine_solubility.hpp"
+
+#include <cassert>  // assert
+#include <cmath>    // std::exp, std::log, std::pow, std::sqrt
+
+#include "eos/cubic_eos/root_selection.hpp"  // eos::select_zfactor
+#include "eos/cubic_eos/soave_redlich_kwong_eos.hpp"
+
+namespace eos {
+
+namespace {
+
+/// Molality of pure water [mol/kg]
+constexpr double water_molality = 55.508;
+
+/// Gas constant [cm3-bar/mol-K]
+constexpr double gas_constant_cm3_bar = 83.1447;
+
+/// Critical temperature [K] and volume [cm3/mol] of CO2
+constexpr double critical_temperature_co2 = 304.13;
+constexpr double critical_volume_co2 = 94.12;
+
+/// Average partial molar volumes of H2O and CO2 [cm3/mol]
+constexpr double partial_volume_h2o = 18.1;
+constexpr double partial_volume_co2 = 32.6;
+
+/// @brief Computes a parameter of Duan and Sun,
+/// \f$ c_1 + c_2 T + c_3 / T + c_8 P / T + c_9 P / (630 - T) + c_{11} T \ln P
+/// \f$, where pressure is in bar
+double duan_sun_param(const std::array<double, 6> &c, double p,
+                      double t) noexcept {
+  return c[0] + c[1] * t + c[2] / t + c[3] * p / t + c[4] * p / (630 - t) +
+         c[5] * t * std::log(p);
+}
+
+}  // namespace
+
+double co2_brine_solubility::ln_activity_coeff(double p, double t,
+                                               double m) noexcept {
+  // Interaction parameters of CO2 with Na+ and with Na+ and Cl-
+  static constexpr std::array<double, 6> lambda = {
+      -0.411370585, 6.07632013e-4, 97.5347708,
+      -0.0237622469, 0.0170656236, 1.41335834e-5};
+  static constexpr std::array<double, 6> zeta = {
+      3.36389723e-4, -1.98298980e-5, 0.0, 2.12220830e-3, -5.24873303e-3, 0.0};
+  const auto p_bar = p * 1e-5;
+  return 2 * m * duan_sun_param(lambda, p_bar, t) +
+         m * m * duan_sun_param(zeta, p_bar, t);
+}
+
+co2_brine_solubility::isobaric_isothermal_terms
+co2_brine_solubility::create_terms(double p, double t, double m) noexcept {
+  constexpr auto R = gas_constant_cm3_bar;
+  const auto p_bar = p * 1e-5;
+  const auto tc = t - 273.15;
+  const auto log_k_h2o =
+      -2.209 + tc * (3.097e-2 + tc * (-1.098e-4 + tc * 2.048e-7));
+  const auto dp = (p_bar - 1) / (R * t);
+  const auto gamma = std::exp(ln_activity_coeff(p, t, m));
+
+  // Redlich-Kwong parameters, a in bar-cm6-K^0.5/mol2 and b in cm3/mol,
+  // reduced by A = a P / (R^2 T^2.5) and B = b P / (R T)
+  const auto a_co2 = 7.54e7 - 4.13e4 * t;
+  constexpr auto a_h2o_co2 = 7.89e7;
+  constexpr auto b_co2 = 27.80;
+  constexpr auto b_h2o = 18.18;
+  const auto fa = p_bar / (R * R * t * t * std::sqrt(t));
+  const auto fb = p_bar / (R * t);
+  const auto ar_co2 = a_co2 * fa;
+  const auto br_co2 = b_co2 * fb;
+  const auto z = select_zfactor<soave_redlich_kwong_eos>(
+      ar_co2, br_co2, root_selection::stable);
+
+  // The equilibrium constant of liquid CO2 below the critical temperature,
+  // where the molar volume is below the critical volume
+  const auto liquid = t < critical_temperature_co2 &&
+                      z * R * t / p_bar < critical_volume_co2;
+  const auto log_k_co2 = liquid
+                             ? 1.169 + tc * (1.368e-2 - tc * 5.380e-5)
+                             : 1.189 + tc * (1.304e-2 - tc * 5.446e-5);
+  return {std::pow(10.0, log_k_h2o) / p_bar *
+              std::exp(dp * partial_volume_h2o),
+          p_bar / (water_molality * gamma * std::pow(10.0, log_k_co2)) *
+              std::exp(-dp * partial_volume_co2),
+          2 * m,
+          ar_co2,
+          a_h2o_co2 * fa,
+          br_co2,
+          b_h2o * fb,
+          z};
+}
+
+std::array<double, 2> co2_brine_solubility::ln_fugacity_coeffs(
+    const isobaric_isothermal_terms &c) noexcept {
+  // Redlich-Kwong EoS has the cubic equation and the fugacity coefficient of
+  // Soave-Redlich-Kwong EoS in the reduced parameters
+  using eos_type = soave_redlich_kwong_eos;
+  const auto a = c.ar_co2;
+  const auto b = c.br_co2;
+  const auto z = c.z;
+
+  // The fugacity coefficient of pure CO2, and that of H2O at infinite
+  // dilution corrected by the composition derivatives of a and b
+  const auto ln_phi = eos_type::ln_fugacity_coeff(z, a, b);
+  const auto q = a / b * std::log((z + b) / z);
+  const auto r = c.br_h2o / b;
+  return {ln_phi,
+          ln_phi + (r - 1) * (z - 1) - q * (2 * c.ar_h2o_co2 / a - r - 1)};
+}
+
+std::array<double, 2> co2_brine_solubility::ln_fugacity_coeffs(
+    double p, double t) const noexcept {
+  return ln_fugacity_coeffs(create_terms(p, t, 0.0));
+}
+
+co2_brine_equilibrium co2_brine_solubility::solve(double p, double t,
+                                                  double m) const noexcept {
+  const auto c = create_terms(p, t, m);
+  const auto ln_phi = ln_fugacity_coeffs(c);
+  const auto a = c.a * std::exp(-ln_phi[1]);
+  const auto b = c.b * std::exp(ln_phi[0]);
+  const auto y = (1 - b) * water_molality /
+                 ((1 / a - b) * (c.nu_m + water_molality) + c.nu_m * b);
+  const auto x = b * (1 - y);
+  // Out of the range of the model if mole fractions are not in (0, 1)
+  if (!(y > 0 && y < 1 && x > 0 && x < 1)) {
+    return {0.0, 0.0, {1.0, 0, flash_iteration_error::not_converged}};
+  }
+  return {x, y, {0.0, 0, flash_iteration_error::success}};
+}
+
+void co2_brine_solubility::solve(gsl::span<const double> p,
+                                 gsl::span<const double> t,
+                                 gsl::span<const double> m,
+                                 gsl::span<double> x_co2,
+                                 gsl::span<double> y_h2o,
+                                 gsl::span<flash_iteration_result> r) const
+    noexcept {
+  assert(p.size() == t.size() && p.size() == m.size() &&
+         p.size() == x_co2.size() && p.size() == y_h2o.size() &&
+         p.size() == r.size());
+  for (std::size_t i = 0; i < p.size(); ++i) {
+    const auto e = this->solve(p[i], t[i], m[i]);
+    x_co2[i] = e.x_co2;
+    y_h2o[i] = e.y_h2o;
+    r[i] = e.result;
+  }
+}
+
+}  // namespace eos
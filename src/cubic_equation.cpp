@@ -8,11 +8,15 @@
 namespace eos {
 
 std::vector<double> cubic_equation::real_roots() const {
-  std::vector<double> x(3);
-  const auto num_roots =
-      gsl_poly_solve_cubic(this->a, this->b, this->c, &x[0], &x[1], &x[2]);
-  x.resize(num_roots);
-  return x;
+  std::array<double, 3> x;
+  const auto num_roots = this->real_roots(x);
+  return {x.begin(), x.begin() + num_roots};
+}
+
+std::size_t cubic_equation::real_roots(std::array<double, 3>& x) const
+    noexcept {
+  return static_cast<std::size_t>(
+      gsl_poly_solve_cubic(this->a, this->b, this->c, &x[0], &x[1], &x[2]));
 }
 
 std::array<std::complex<double>, 3> cubic_equation::complex_roots() const {
@@ -27,4 +31,12 @@ std::array<std::complex<double>, 3> cubic_equation::complex_roots() const {
   return z2;
 }
 
+double cubic_equation::discriminant() const noexcept {
+  const auto p = this->a;
+  const auto q = this->b;
+  const auto r = this->c;
+  return 18 * p * q * r - 4 * p * p * p * r + p * p * q * q - 4 * q * q * q -
+         27 * r * r;
+}
+
 }  // namespace eos
@@ -0,0 +1,354 @@
+#include "eos/gerg/gerg2008.hpp"
+
+#include <algorithm>  // std::clamp, std::max, std::sort, std::unique
+#include <array>      // std::array
+#include <cassert>    // assert
+#include <cmath>      // std::cbrt, std::exp, std::fabs, std::log, std::pow
+#include <limits>     // std::numeric_limits
+#include <stdexcept>  // std::invalid_argument
+#include <utility>    // std::move
+
+#include "eos/common/thermodynamic_constants.hpp"  // eos::gas_constant
+#include "eos/cubic_eos/peng_robinson_eos.hpp"
+
+namespace eos {
+
+namespace {
+
+bool valid_exponent(int k) noexcept {
+  return k >= 0 && k <= gerg2008_eos::max_exponent;
+}
+
+/// @brief Residual Helmholtz energy and its derivatives scaled by reduced
+/// density and inverse reduced temperature
+struct helmholtz_derivatives {
+  double a;   /// Residual Helmholtz energy divided by RT
+  double da;  /// delta times the derivative with respect to delta
+  double ta;  /// tau times the derivative with respect to tau
+};
+
+helmholtz_derivatives evaluate_terms(const std::vector<gerg_term> &terms,
+                                     double delta, double tau) noexcept {
+  helmholtz_derivatives r = {0.0, 0.0, 0.0};
+  for (const auto &term : terms) {
+    const auto dc = term.c > 0 ? std::pow(delta, term.c) : 0.0;
+    const auto v = term.n * std::pow(delta, term.d) * std::pow(tau, term.t) *
+                   (term.c > 0 ? std::exp(-dc) : 1.0);
+    r.a += v;
+    r.da += v * (term.d - term.c * dc);
+    r.ta += v * term.t;
+  }
+  return r;
+}
+
+helmholtz_derivatives evaluate_terms(
+    const std::vector<gerg_departure_term> &terms, double delta,
+    double tau) noexcept {
+  helmholtz_derivatives r = {0.0, 0.0, 0.0};
+  for (const auto &term : terms) {
+    const auto x = delta - term.epsilon;
+    const auto v =
+        term.n * std::pow(delta, term.d) * std::pow(tau, term.t) *
+        std::exp(-term.eta * x * x - term.beta * (delta - term.gamma));
+    r.a += v;
+    r.da += v * (term.d - 2 * term.eta * delta * x - term.beta * delta);
+    r.ta += v * term.t;
+  }
+  return r;
+}
+
+/// @brief Computes the derivative of \f$ x_i x_j (x_i + x_j) / (\beta^2 x_i
+/// + x_j) \f$ of the reducing functions with respect to \f$ x_i \f$
+double combining_derivative(double xi, double xj, double beta) noexcept {
+  const auto b2 = beta * beta;
+  const auto q = b2 * xi + xj;
+  return xj * (b2 * xi * xi + 2 * xi * xj + xj * xj) / (q * q);
+}
+
+}  // namespace
+
+gerg2008_eos::gerg2008_eos(std::vector<gerg_component> components,
+                           std::vector<gerg_binary> binaries)
+    : components_{std::move(components)}, binaries_{std::move(binaries)} {
+  const auto n = components_.size();
+  for (const auto &c : components_) {
+    for (const auto &term : c.terms) {
+      if (!valid_exponent(term.d) || !valid_exponent(term.c)) {
+        throw std::invalid_argument("Invalid exponent of reduced density");
+      }
+    }
+  }
+
+  pairs_.assign(n * n, {1.0, 1.0, 1.0, 1.0});
+  for (const auto &b : binaries_) {
+    if (b.i >= n || b.j >= n || b.i == b.j) {
+      throw std::invalid_argument("Invalid pair of components of a binary");
+    }
+    for (const auto &term : b.departure) {
+      if (!valid_exponent(term.d)) {
+        throw std::invalid_argument("Invalid exponent of reduced density");
+      }
+    }
+    // Reducing functions are invariant under the exchange of i and j with
+    // the asymmetry parameters inverted
+    pairs_[b.i * n + b.j] = {b.beta_v, b.gamma_v, b.beta_t, b.gamma_t};
+    pairs_[b.j * n + b.i] = {1 / b.beta_v, b.gamma_v, 1 / b.beta_t,
+                             b.gamma_t};
+  }
+}
+
+gerg2008_mixture gerg2008_eos::create_mixture(
+    gsl::span<const double> x) const {
+  const auto n = components_.size();
+  if (x.size() != n) {
+    throw std::invalid_argument("Size of mole fractions mismatch");
+  }
+
+  gerg2008_mixture m;
+  double vr = 0.0, tr = 0.0;
+  m.pc_ = 0.0;
+  m.tc_ = 0.0;
+  m.omega_ = 0.0;
+  for (std::size_t i = 0; i < n; ++i) {
+    const auto &ci = components_[i];
+    vr += x[i] * x[i] / ci.rhoc;
+    tr += x[i] * x[i] * ci.tc;
+    m.pc_ += x[i] * ci.pc;
+    m.tc_ += x[i] * ci.tc;
+    m.omega_ += x[i] * ci.omega;
+    for (std::size_t j = i + 1; j < n; ++j) {
+      if (x[i] * x[j] == 0.0) {
+        continue;
+      }
+      const auto &cj = components_[j];
+      const auto &pij = pairs_[i * n + j];
+      const auto xx = 2 * x[i] * x[j] * (x[i] + x[j]);
+      const auto s = std::cbrt(1 / ci.rhoc) + std::cbrt(1 / cj.rhoc);
+      vr += xx * pij.beta_v * pij.gamma_v /
+            (pij.beta_v * pij.beta_v * x[i] + x[j]) * s * s * s / 8;
+      tr += xx * pij.beta_t * pij.gamma_t /
+            (pij.beta_t * pij.beta_t * x[i] + x[j]) * std::sqrt(ci.tc * cj.tc);
+    }
+  }
+  m.rho_r_ = 1 / vr;
+  m.t_r_ = tr;
+
+  for (std::size_t i = 0; i < n; ++i) {
+    if (x[i] == 0.0) {
+      continue;
+    }
+    for (const auto &term : components_[i].terms) {
+      m.terms_.push_back({x[i] * term.n, term.d, term.t, term.c});
+    }
+  }
+  for (const auto &b : binaries_) {
+    const auto w = x[b.i] * x[b.j] * b.f;
+    if (w == 0.0) {
+      continue;
+    }
+    for (auto term : b.departure) {
+      term.n *= w;
+      m.departure_.push_back(term);
+    }
+  }
+  return m;
+}
+
+void gerg2008_eos::ln_fugacity_coeffs(gsl::span<const double> x, double p,
+                                      double t,
+                                      gsl::span<double> ln_phi) const {
+  const auto n = components_.size();
+  if (ln_phi.size() != n) {
+    throw std::invalid_argument("Size of fugacity coefficients mismatch");
+  }
+  const auto mixture = this->create_mixture(x);
+  const auto rho = mixture.density(p, t);
+  const auto delta = rho / mixture.rho_r_;
+  const auto tau = mixture.t_r_ / t;
+
+  // Derivatives of the reducing functions and the residual Helmholtz energy
+  // with respect to mole fractions
+  std::vector<double> dv(n), dt(n), dx(n);
+  helmholtz_derivatives r = {0.0, 0.0, 0.0};
+  for (std::size_t i = 0; i < n; ++i) {
+    const auto &ci = components_[i];
+    dv[i] = 2 * x[i] / ci.rhoc;
+    dt[i] = 2 * x[i] * ci.tc;
+    for (std::size_t j = 0; j < n; ++j) {
+      if (j == i || x[i] + x[j] == 0.0) {
+        continue;
+      }
+      const auto &cj = components_[j];
+      const auto &pij = pairs_[i * n + j];
+      const auto s = std::cbrt(1 / ci.rhoc) + std::cbrt(1 / cj.rhoc);
+      dv[i] += pij.beta_v * pij.gamma_v * s * s * s / 4 *
+               combining_derivative(x[i], x[j], pij.beta_v);
+      dt[i] += 2 * pij.beta_t * pij.gamma_t * std::sqrt(ci.tc * cj.tc) *
+               combining_derivative(x[i], x[j], pij.beta_t);
+    }
+    const auto ri = evaluate_terms(ci.terms, delta, tau);
+    dx[i] = ri.a;
+    r.a += x[i] * ri.a;
+    r.da += x[i] * ri.da;
+    r.ta += x[i] * ri.ta;
+  }
+  for (const auto &b : binaries_) {
+    if (b.f == 0.0) {
+      continue;
+    }
+    const auto rij = evaluate_terms(b.departure, delta, tau);
+    dx[b.i] += x[b.j] * b.f * rij.a;
+    dx[b.j] += x[b.i] * b.f * rij.a;
+    const auto w = x[b.i] * x[b.j] * b.f;
+    r.a += w * rij.a;
+    r.da += w * rij.da;
+    r.ta += w * rij.ta;
+  }
+
+  double sv = 0.0, st = 0.0, sx = 0.0;
+  for (std::size_t i = 0; i < n; ++i) {
+    sv += x[i] * dv[i];
+    st += x[i] * dt[i];
+    sx += x[i] * dx[i];
+  }
+  const auto ln_z = std::log(1 + r.da);
+  for (std::size_t i = 0; i < n; ++i) {
+    ln_phi[i] = r.a + r.da * (1 + mixture.rho_r_ * (dv[i] - sv)) +
+                r.ta * (dt[i] - st) / mixture.t_r_ + dx[i] - sx - ln_z;
+  }
+}
+
+double gerg2008_mixture::initial_density(double p, double t) const {
+  constexpr auto R = gas_constant<double>();
+  const auto z = make_peng_robinson_eos(pc_, tc_, omega_)
+                     .create_isobaric_isothermal_state(p, t)
+                     .zfactor(root_selection::stable);
+  return p / (z * R * t);
+}
+
+double gerg2008_mixture::density(double p, double t) const {
+  return this->create_isothermal_line(t).density(
+      p, this->initial_density(p, t));
+}
+
+double gerg2008_mixture::zfactor(double p, double t) const {
+  constexpr auto R = gas_constant<double>();
+  return p / (this->density(p, t) * R * t);
+}
+
+void gerg2008_mixture::density(gsl::span<const double> p,
+                               gsl::span<const double> t,
+                               gsl::span<double> rho) const {
+  assert(p.size() == t.size() && p.size() == rho.size());
+  gerg2008_isothermal_line line;
+  for (std::size_t i = 0; i < p.size(); ++i) {
+    if (i == 0 || t[i] != t[i - 1]) {
+      line = this->create_isothermal_line(t[i]);
+    }
+    rho[i] = line.density(p[i], this->initial_density(p[i], t[i]));
+  }
+}
+
+void gerg2008_mixture::zfactor(gsl::span<const double> p,
+                               gsl::span<const double> t,
+                               gsl::span<double> z) const {
+  constexpr auto R = gas_constant<double>();
+  this->density(p, t, z);
+  for (std::size_t i = 0; i < p.size(); ++i) {
+    z[i] = p[i] / (z[i] * R * t[i]);
+  }
+}
+
+gerg2008_isothermal_line::gerg2008_isothermal_line(
+    const gerg2008_mixture &mixture, double t)
+    : t_{t},
+      rt_{gas_constant<double>() * t},
+      rho_r_{mixture.rho_r_},
+      max_d_{0} {
+  const auto ln_tau = std::log(mixture.t_r_ / t);
+  terms_.reserve(mixture.terms_.size());
+  for (const auto &term : mixture.terms_) {
+    terms_.push_back({term.n * std::exp(term.t * ln_tau), term.d, term.c});
+    max_d_ = std::max({max_d_, term.d, term.c});
+    if (term.c > 0) {
+      exponents_.push_back(term.c);
+    }
+  }
+  std::sort(exponents_.begin(), exponents_.end());
+  exponents_.erase(std::unique(exponents_.begin(), exponents_.end()),
+                   exponents_.end());
+
+  departure_.reserve(mixture.departure_.size());
+  for (const auto &term : mixture.departure_) {
+    departure_.push_back({term.n * std::exp(term.t * ln_tau), term.d,
+                          term.eta, term.epsilon, term.beta, term.gamma});
+    max_d_ = std::max(max_d_, term.d);
+  }
+}
+
+gerg_residual gerg2008_isothermal_line::evaluate(double delta) const
+    noexcept {
+  constexpr auto size = gerg2008_eos::max_exponent + 1;
+  std::array<double, size> pow;
+  pow[0] = 1.0;
+  for (int k = 1; k <= max_d_; ++k) {
+    pow[k] = pow[k - 1] * delta;
+  }
+  // Exponentials shared by the terms of the same exponent
+  std::array<double, size> ex;
+  ex[0] = 1.0;
+  for (const auto c : exponents_) {
+    ex[c] = std::exp(-pow[c]);
+  }
+
+  gerg_residual r = {0.0, 0.0, 0.0};
+  for (const auto &term : terms_) {
+    const auto v = term.k * pow[term.d] * ex[term.c];
+    const auto d = static_cast<double>(term.d);
+    const auto cdc = term.c * pow[term.c];  // Zero for polynomial terms
+    const auto g = d - cdc;
+    r.a += v;
+    r.da += v * g;
+    r.d2a += v * (g * g - d - (term.c - 1) * cdc);
+  }
+  for (const auto &term : departure_) {
+    const auto x = delta - term.epsilon;
+    const auto v =
+        term.k * pow[term.d] *
+        std::exp(-term.eta * x * x - term.beta * (delta - term.gamma));
+    const auto d = static_cast<double>(term.d);
+    const auto g = d - 2 * term.eta * delta * x - term.beta * delta;
+    r.a += v;
+    r.da += v * g;
+    r.d2a += v * (g * g - d - 2 * term.eta * delta * delta);
+  }
+  return r;
+}
+
+double gerg2008_isothermal_line::pressure(double rho) const noexcept {
+  return rho * rt_ * (1 + this->evaluate(rho / rho_r_).da);
+}
+
+double gerg2008_isothermal_line::density(double p, double rho_init) const
+    noexcept {
+  auto rho = rho_init;
+  auto rho_stable = 0.0;  // The last mechanically stable density
+  for (int iter = 0; iter < 100; ++iter) {
+    const auto r = this->evaluate(rho / rho_r_);
+    const auto f = rho * rt_ * (1 + r.da) - p;
+    const auto df = rt_ * (1 + 2 * r.da + r.d2a);
+    if (!(df > 0)) {
+      // Steps back to the stable region
+      rho = rho_stable > 0 ? 0.5 * (rho + rho_stable) : 0.5 * rho;
+      continue;
+    }
+    rho_stable = rho;
+    if (std::fabs(f) < 1e-12 * rho * df) {
+      return rho - f / df;
+    }
+    rho = std::clamp(rho - f / df, 0.5 * rho, 2 * rho);
+  }
+  return std::numeric_limits<double>::quiet_NaN();
+}
+
+}  // namespace eos
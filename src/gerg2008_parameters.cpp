@@ -0,0 +1,639 @@
+#include "eos/gerg/gerg2008_parameters.hpp"
+
+#include <algorithm>  // std::find_if
+#include <array>      // std::array
+#include <cstddef>    // std::size_t
+#include <utility>    // std::move
+
+namespace eos {
+
+namespace {
+
+/// @brief Makes terms of the residual Helmholtz energy from the columns of a
+/// table
+template <std::size_t N>
+std::vector<gerg_term> make_terms(const std::array<double, N> &n,
+                                  const std::array<int, N> &d,
+                                  const std::array<double, N> &t,
+                                  const std::array<int, N> &c) {
+  std::vector<gerg_term> terms;
+  terms.reserve(N);
+  for (std::size_t k = 0; k < N; ++k) {
+    terms.push_back({n[k], d[k], t[k], c[k]});
+  }
+  return terms;
+}
+
+/// Exponents of the equations of methane, nitrogen and ethane
+constexpr std::array<int, 24> methane_type_d = {
+    1, 1, 2, 2, 4, 4, 1, 1, 1, 2, 3, 6, 2, 3, 3, 4, 4, 2, 3, 4, 5, 6, 6, 7};
+constexpr std::array<double, 24> methane_type_t = {
+    0.125, 1.125, 0.375, 1.125, 0.625, 1.5, 0.625, 2.625, 2.75, 2.125, 2.0,
+    1.75, 4.5, 4.75, 5.0, 4.0, 4.5, 7.5, 14.0, 11.5, 26.0, 28.0, 30.0, 16.0};
+constexpr std::array<int, 24> methane_type_c = {
+    0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 3, 3, 3, 6, 6, 6, 6};
+
+/// Exponents of the equations of Span and Wagner for nonpolar fluids
+constexpr std::array<int, 12> nonpolar_d = {1, 1, 1, 2, 3, 7, 2, 5, 1, 4, 3, 4};
+constexpr std::array<double, 12> nonpolar_t = {
+    0.25, 1.125, 1.5, 1.375, 0.25, 0.875, 0.625, 1.75, 3.625, 3.625, 14.5,
+    12.0};
+constexpr std::array<int, 12> nonpolar_c = {0, 0, 0, 0, 0, 0, 1, 1, 2, 2, 3, 3};
+
+/// Exponents of the equation of carbon dioxide
+constexpr std::array<int, 22> co2_d = {
+    1, 1, 2, 3, 3, 3, 4, 5, 6, 6, 1, 4, 1, 1, 3, 3, 4, 5, 5, 5, 5, 5};
+constexpr std::array<double, 22> co2_t = {
+    0.0, 1.25, 1.625, 0.375, 0.375, 1.375, 1.125, 1.375, 0.125, 1.625, 3.75,
+    3.5, 7.5, 8.0, 6.0, 16.0, 11.0, 24.0, 26.0, 28.0, 24.0, 26.0};
+constexpr std::array<int, 22> co2_c = {
+    0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 2, 2, 3, 3, 3, 3, 3, 5, 5, 5, 6, 6};
+
+/// Exponents of the equation of hydrogen
+constexpr std::array<int, 14> hydrogen_d = {
+    1, 1, 2, 2, 4, 1, 5, 5, 5, 1, 1, 2, 5, 1};
+constexpr std::array<double, 14> hydrogen_t = {
+    0.5, 0.625, 0.375, 0.625, 1.125, 2.625, 0.0, 0.25, 1.375, 4.0, 4.25, 5.0,
+    8.0, 8.0};
+constexpr std::array<int, 14> hydrogen_c = {
+    0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 3, 3, 5};
+
+/// Exponents of the equation of water
+constexpr std::array<int, 16> water_d = {
+    1, 1, 1, 2, 2, 3, 4, 1, 5, 5, 1, 2, 4, 4, 1, 1};
+constexpr std::array<double, 16> water_t = {
+    0.5, 1.25, 1.875, 0.125, 1.5, 1.0, 0.75, 1.5, 0.625, 2.625, 5.0, 4.0, 4.5,
+    3.0, 4.0, 6.0};
+constexpr std::array<int, 16> water_c = {
+    0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 2, 2, 2, 3, 5, 5};
+
+/// Exponents of the equation of helium
+constexpr std::array<int, 12> helium_d = {1, 1, 1, 4, 1, 3, 5, 5, 5, 2, 1, 2};
+constexpr std::array<double, 12> helium_t = {
+    0.0, 0.125, 0.75, 1.0, 0.75, 2.625, 0.125, 1.25, 2.0, 1.0, 4.5, 5.0};
+constexpr std::array<int, 12> helium_c = {0, 0, 0, 0, 1, 1, 1, 1, 1, 2, 3, 3};
+
+/// Coefficients of the terms of the components
+constexpr std::array<double, 24> methane_n = {
+    0.57335704239162, -1.676068752373, 0.23405291834916, -0.21947376343441,
+    0.016369201404128, 0.01500440638928, 0.098990489492918, 0.58382770929055,
+    -0.7478686756039, 0.30033302857974, 0.20985543806568, -0.018590151133061,
+    -0.15782558339049, 0.12716735220791, -0.032019743894346, -0.068049729364536,
+    0.024291412853736, 0.0051440451639444, -0.019084949733532,
+    0.0055229677241291, -0.0044197392976085, 0.040061416708429,
+    -0.033752085907575, -0.0025127658213357};
+constexpr std::array<double, 24> nitrogen_n = {
+    0.59889711801201, -1.6941557480731, 0.24579736191718, -0.23722456755175,
+    0.017954918715141, 0.014592875720215, 0.10008065936206, 0.73157115385532,
+    -0.88372272336366, 0.31887660246708, 0.20766491728799, -0.019379315454158,
+    -0.16936641554983, 0.13546846041701, -0.033066712095307, -0.060690817018557,
+    0.012797548292871, 0.0058743664107299, -0.018451951971969,
+    0.0047226622042472, -0.0052024079680599, 0.043563505956635,
+    -0.036251690750939, -0.0028974026866543};
+constexpr std::array<double, 22> carbon_dioxide_n = {
+    0.52646564804653, -1.4995725042592, 0.27329786733782, 0.12949500022786,
+    0.15404088341841, -0.58186950946814, -0.18022494838296, -0.095389904072812,
+    -0.0080486819317679, -0.03554775127309, -0.28079014882405,
+    -0.082435890081677, 0.010832427979006, -0.0067073993161097,
+    -0.0046827907600524, -0.028359911832177, 0.019500174744098,
+    -0.21609137507166, 0.43772794926972, -0.22130790113593, 0.015190189957331,
+    -0.0153809489533};
+constexpr std::array<double, 24> ethane_n = {
+    0.63596780450714, -1.7377981785459, 0.28914060926272, -0.33714276845694,
+    0.022405964699561, 0.015715424886913, 0.11450634253745, 1.0612049379745,
+    -1.2855224439423, 0.39414630777652, 0.31390924682041, -0.021592277117247,
+    -0.21723666564905, -0.28999574439489, 0.42321173025732, 0.04643410025926,
+    -0.13138398329741, 0.011492850364368, -0.033387688429909, 0.015183171583644,
+    -0.0047610805647657, 0.046917166277885, -0.039401755804649,
+    -0.0032569956247611};
+constexpr std::array<double, 12> propane_n = {
+    1.0403973107358, -2.8318404081403, 0.84393809606294, -0.076559591850023,
+    0.09469737305728, 0.00024796475497006, 0.2774376042287, -0.043846000648377,
+    -0.2699106478435, -0.06931341308986, -0.029632145981653, 0.01404012675138};
+constexpr std::array<double, 12> isobutane_n = {
+    1.04293315891, -2.8184272548892, 0.8617623239785, -0.10613619452487,
+    0.098615749302134, 0.00023948208682322, 0.3033000485695, -0.041598156135392,
+    -0.29991937470058, -0.080369342764109, -0.029761373251151,
+    0.01305963030314};
+constexpr std::array<double, 12> n_butane_n = {
+    1.0626277411455, -2.862095182835, 0.88738233403777, -0.12570581155345,
+    0.10286308708106, 0.00025358040602654, 0.32325200233982, -0.037950761057893,
+    -0.32534802014452, -0.079050969051011, -0.020636720547775,
+    0.005705380933475};
+constexpr std::array<double, 12> isopentane_n = {
+    1.1017531966644, -3.008236853198, 0.99411904271336, -0.14008636562629,
+    0.11193995351286, 0.0002954804254123, 0.36370108598133, -0.048236083488293,
+    -0.35100280270615, -0.10185043812047, -0.035242601785454,
+    0.019756797599888};
+constexpr std::array<double, 12> n_pentane_n = {
+    1.0968643098001, -2.9988888298061, 0.99516886799212, -0.16170708558539,
+    0.11334460072775, 0.00026760595150748, 0.40979881986931, -0.040876423083075,
+    -0.38169482469447, -0.10931956843993, -0.03207322332799, 0.016877016216975};
+constexpr std::array<double, 12> n_hexane_n = {
+    1.0553238013661, -2.6120615890629, 0.7661388296726, -0.29770320622459,
+    0.11879907733358, 0.00027922861062617, 0.46347589844105, 0.011433196980297,
+    -0.48256968738131, -0.093750558924659, -0.0067273247155994,
+    -0.0051141583585428};
+constexpr std::array<double, 12> n_heptane_n = {
+    1.0543747645262, -2.6500681506144, 0.81730047827543, -0.30451391253428,
+    0.122538687108, 0.00027266472743928, 0.4986582568167, -0.00071432815084176,
+    -0.5423689552545, -0.13801821610756, -0.0061595287380011,
+    0.00048602510393022};
+constexpr std::array<double, 12> n_octane_n = {
+    1.0722544875633, -2.4632951172003, 0.65386674054928, -0.36324974085628,
+    0.12713269626764, 0.0003071357277793, 0.5265685698754, 0.019362862857653,
+    -0.58939426849155, -0.14069963991934, -0.0078966330500036,
+    0.0033036597968109};
+constexpr std::array<double, 12> n_nonane_n = {
+    1.1151, -2.702, 0.83416, -0.38828, 0.1376, 0.00028185, 0.62037, 0.015847,
+    -0.61726, -0.15043, -0.012982, 0.0044325};
+constexpr std::array<double, 12> n_decane_n = {
+    1.0461, -2.4807, 0.74372, -0.52579, 0.15315, 0.00032865, 0.84178, 0.055424,
+    -0.73555, -0.18507, -0.020775, 0.012335};
+constexpr std::array<double, 14> hydrogen_n = {
+    5.3579928451252, -6.2050252530595, 0.13830241327086, -0.071397954896129,
+    0.015474053959733, -0.14976806405771, -0.026368723988451, 0.056681303156066,
+    -0.060063958030436, -0.45043942027132, 0.424788402445, -0.021997640827139,
+    -0.01049952137453, -0.0028955902866816};
+constexpr std::array<double, 12> oxygen_n = {
+    0.88878286369701, -2.4879433312148, 0.59750190775886, 0.0096501817061881,
+    0.07197042871277, 0.00022337443000195, 0.18558686391474, -0.03812936803576,
+    -0.15352245383006, -0.026726814910919, -0.025675298677127,
+    0.0095714302123668};
+constexpr std::array<double, 12> carbon_monoxide_n = {
+    0.92310041400851, -2.4885845205624, 0.58095213783396, 0.028859164394654,
+    0.070256257276544, 0.00021687043269488, 0.13758331015182,
+    -0.051501116343466, -0.14865357483379, -0.03885710088681,
+    -0.029100433948943, 0.014155684466279};
+constexpr std::array<double, 16> water_n = {
+    0.82728408749586, -1.8602220416584, -1.1199009613744, 0.15635753976056,
+    0.87375844859025, -0.36674403715731, 0.053987893432436, 1.0957690214499,
+    0.053213037828563, 0.013050533930825, -0.41079520434476, 0.1463744334412,
+    -0.055726838623719, -0.0112017741438, -0.0066062758068099,
+    0.0046918522004538};
+constexpr std::array<double, 12> hydrogen_sulfide_n = {
+    0.87641, -2.0367, 0.21634, -0.050199, 0.066994, 0.00019076, 0.20227,
+    -0.0045348, -0.2223, -0.034714, -0.014885, 0.0074154};
+constexpr std::array<double, 12> helium_n = {
+    -0.45579024006737, 1.2516390754925, -1.5438231650621, 0.020467489707221,
+    -0.34476212380781, -0.020858459512787, 0.016227414711778,
+    -0.057471818200892, 0.019462416430715, -0.03329568012302,
+    -0.010863577372367, -0.022173365245954};
+constexpr std::array<double, 12> argon_n = {
+    0.85095714803969, -2.400322294348, 0.54127841476466, 0.016919770692538,
+    0.068825965019035, 0.00021428032815338, 0.17429895321992,
+    -0.033654495604194, -0.13526799857691, -0.016387350791552,
+    -0.024987666851475, 0.0088769204815709};
+
+/// @brief Departure function of methane-nitrogen
+std::vector<gerg_departure_term> methane_nitrogen_departure() {
+  return {
+      {-0.0098038985517335, 1, 0.0, 0.0, 0.0, 0.0, 0.0},
+      {0.00042487270143005, 4, 1.85, 0.0, 0.0, 0.0, 0.0},
+      {-0.034800214576142, 1, 7.85, 1.0, 0.5, 1.0, 0.5},
+      {-0.13333813013896, 2, 5.4, 1.0, 0.5, 1.0, 0.5},
+      {-0.011993694974627, 2, 0.0, 0.25, 0.5, 2.5, 0.5},
+      {0.069243379775168, 2, 0.75, 0.0, 0.5, 3.0, 0.5},
+      {-0.31022508148249, 2, 2.8, 0.0, 0.5, 3.0, 0.5},
+      {0.24495491753226, 2, 4.45, 0.0, 0.5, 3.0, 0.5},
+      {0.22369816716981, 3, 4.25, 0.0, 0.5, 3.0, 0.5},
+  };
+}
+
+/// @brief Departure function of methane-carbon dioxide
+std::vector<gerg_departure_term> methane_carbon_dioxide_departure() {
+  return {
+      {-0.10859387354942, 1, 2.6, 0.0, 0.0, 0.0, 0.0},
+      {0.080228576727389, 2, 1.95, 0.0, 0.0, 0.0, 0.0},
+      {-0.0093303985115717, 3, 0.0, 0.0, 0.0, 0.0, 0.0},
+      {0.040989274005848, 1, 3.95, 1.0, 0.5, 1.0, 0.5},
+      {-0.24338019772494, 2, 7.95, 0.5, 0.5, 2.0, 0.5},
+      {0.23855347281124, 3, 8.0, 0.0, 0.5, 3.0, 0.5},
+  };
+}
+
+/// @brief Departure function of methane-ethane
+std::vector<gerg_departure_term> methane_ethane_departure() {
+  return {
+      {-0.00080926050298746, 3, 0.65, 0.0, 0.0, 0.0, 0.0},
+      {-0.00075381925080059, 4, 1.55, 0.0, 0.0, 0.0, 0.0},
+      {-0.041618768891219, 1, 3.1, 1.0, 0.5, 1.0, 0.5},
+      {-0.23452173681569, 2, 5.9, 1.0, 0.5, 1.0, 0.5},
+      {0.14003840584586, 2, 7.05, 1.0, 0.5, 1.0, 0.5},
+      {0.063281744807738, 2, 3.35, 0.875, 0.5, 1.25, 0.5},
+      {-0.034660425848809, 2, 1.2, 0.75, 0.5, 1.5, 0.5},
+      {-0.23918747334251, 2, 5.8, 0.5, 0.5, 2.0, 0.5},
+      {0.0019855255066891, 2, 2.7, 0.0, 0.5, 3.0, 0.5},
+      {6.1777746171555, 3, 0.45, 0.0, 0.5, 3.0, 0.5},
+      {-6.9575358271105, 3, 0.55, 0.0, 0.5, 3.0, 0.5},
+      {1.0630185306388, 3, 1.95, 0.0, 0.5, 3.0, 0.5},
+  };
+}
+
+/// @brief Departure function of methane-propane
+std::vector<gerg_departure_term> methane_propane_departure() {
+  return {
+      {0.013746429958576, 3, 1.85, 0.0, 0.0, 0.0, 0.0},
+      {-0.0074425012129552, 3, 3.95, 0.0, 0.0, 0.0, 0.0},
+      {-0.0045516600213685, 4, 0.0, 0.0, 0.0, 0.0, 0.0},
+      {-0.0054546603350237, 4, 1.85, 0.0, 0.0, 0.0, 0.0},
+      {0.0023682016824471, 4, 3.85, 0.0, 0.0, 0.0, 0.0},
+      {0.18007763721438, 1, 5.25, 0.25, 0.5, 0.75, 0.5},
+      {-0.44773942932486, 1, 3.85, 0.25, 0.5, 1.0, 0.5},
+      {0.0193273748882, 1, 0.2, 0.0, 0.5, 2.0, 0.5},
+      {-0.30632197804624, 2, 6.5, 0.0, 0.5, 3.0, 0.5},
+  };
+}
+
+/// @brief Departure function of nitrogen-carbon dioxide
+std::vector<gerg_departure_term> nitrogen_carbon_dioxide_departure() {
+  return {
+      {0.28661625028399, 2, 1.85, 0.0, 0.0, 0.0, 0.0},
+      {-0.10919833861247, 3, 1.4, 0.0, 0.0, 0.0, 0.0},
+      {-1.137403208227, 1, 3.2, 0.25, 0.5, 0.75, 0.5},
+      {0.76580544237358, 1, 2.5, 0.25, 0.5, 1.0, 0.5},
+      {0.0042638000926819, 1, 8.0, 0.0, 0.5, 2.0, 0.5},
+      {0.17673538204534, 2, 3.75, 0.0, 0.5, 3.0, 0.5},
+  };
+}
+
+/// @brief Departure function of nitrogen-ethane
+std::vector<gerg_departure_term> nitrogen_ethane_departure() {
+  return {
+      {-0.47376518126608, 2, 0.0, 0.0, 0.0, 0.0, 0.0},
+      {0.48961193461001, 2, 0.05, 0.0, 0.0, 0.0, 0.0},
+      {-0.0057011062090535, 3, 0.0, 0.0, 0.0, 0.0, 0.0},
+      {-0.1996682004132, 1, 3.65, 1.0, 0.5, 1.0, 0.5},
+      {-0.69411103101723, 2, 4.9, 1.0, 0.5, 1.0, 0.5},
+      {0.69226192739021, 2, 4.45, 0.875, 0.5, 1.25, 0.5},
+  };
+}
+
+/// @brief Departure function of methane-hydrogen
+std::vector<gerg_departure_term> methane_hydrogen_departure() {
+  return {
+      {-0.25157134971934, 1, 2.0, 0.0, 0.0, 0.0, 0.0},
+      {-0.0062203841111983, 3, -1.0, 0.0, 0.0, 0.0, 0.0},
+      {0.088850315184396, 3, 1.75, 0.0, 0.0, 0.0, 0.0},
+      {-0.035592212573239, 4, 1.4, 0.0, 0.0, 0.0, 0.0},
+  };
+}
+
+/// @brief Generalized departure function
+std::vector<gerg_departure_term> generalized_departure() {
+  return {
+      {2.5574776844118, 1, 1.0, 0.0, 0.0, 0.0, 0.0},
+      {-7.9846357136353, 1, 1.55, 0.0, 0.0, 0.0, 0.0},
+      {4.7859131465806, 1, 1.7, 0.0, 0.0, 0.0, 0.0},
+      {-0.73265392369587, 2, 0.25, 0.0, 0.0, 0.0, 0.0},
+      {1.3805471345312, 2, 1.35, 0.0, 0.0, 0.0, 0.0},
+      {0.28349603476365, 3, 0.0, 0.0, 0.0, 0.0, 0.0},
+      {-0.49087385940425, 3, 1.25, 0.0, 0.0, 0.0, 0.0},
+      {-0.10291888921447, 4, 0.0, 0.0, 0.0, 0.0, 0.0},
+      {0.11836314681968, 4, 0.7, 0.0, 0.0, 0.0, 0.0},
+      {5.5527385721943e-5, 4, 5.4, 0.0, 0.0, 0.0, 0.0},
+  };
+}
+
+/// @brief Parameters of reducing functions of a binary
+struct reducing_parameters {
+  std::size_t i;
+  std::size_t j;
+  double beta_v;
+  double gamma_v;
+  double beta_t;
+  double gamma_t;
+};
+
+/// Parameters of reducing functions, with 0-based indices of gerg_species
+constexpr std::array<reducing_parameters, 210> reducing_table = {{
+    {0, 1, 0.998721377, 1.013950311, 0.99809883, 0.979273013},
+    {0, 2, 0.999518072, 1.002806594, 1.02262449, 0.975665369},
+    {0, 3, 0.997547866, 1.006617867, 0.996336508, 1.049707697},
+    {0, 4, 1.00482707, 1.038470657, 0.989680305, 1.098655531},
+    {0, 5, 1.011240388, 1.054319053, 0.980315756, 1.161117729},
+    {0, 6, 0.979105972, 1.045375122, 0.99417491, 1.171607691},
+    {0, 7, 1.0, 1.343685343, 1.0, 1.188899743},
+    {0, 8, 0.94833012, 1.124508039, 0.992127525, 1.249173968},
+    {0, 9, 0.958015294, 1.052643846, 0.981844797, 1.330570181},
+    {0, 10, 0.962050831, 1.156655935, 0.977431529, 1.379850328},
+    {0, 11, 0.994740603, 1.116549372, 0.957473785, 1.449245409},
+    {0, 12, 1.002852287, 1.141895355, 0.947716769, 1.528532478},
+    {0, 13, 1.033086292, 1.146089637, 0.937777823, 1.568231489},
+    {0, 14, 1.0, 1.018702573, 1.0, 1.352643115},
+    {0, 15, 1.0, 1.0, 1.0, 0.95},
+    {0, 16, 0.997340772, 1.006102927, 0.987411732, 0.987473033},
+    {0, 17, 1.012783169, 1.585018334, 1.063333913, 0.775810513},
+    {0, 18, 1.012599087, 1.040161207, 1.011090031, 0.961155729},
+    {0, 19, 1.0, 0.881405683, 1.0, 3.159776855},
+    {0, 20, 1.034630259, 1.014678542, 0.990954281, 0.989843388},
+    {1, 2, 0.977794634, 1.047578256, 1.005894529, 1.107654104},
+    {1, 3, 0.978880168, 1.042352891, 1.007671428, 1.098650964},
+    {1, 4, 0.974424681, 1.081025408, 1.002677329, 1.201264026},
+    {1, 5, 0.98641583, 1.100576129, 0.99286813, 1.284462634},
+    {1, 6, 0.99608261, 1.146949309, 0.994515234, 1.304886838},
+    {1, 7, 1.0, 1.154135439, 1.0, 1.38177077},
+    {1, 8, 1.0, 1.078877166, 1.0, 1.419029041},
+    {1, 9, 1.0, 1.195952177, 1.0, 1.472607971},
+    {1, 10, 1.0, 1.40455409, 1.0, 1.520975334},
+    {1, 11, 1.0, 1.186067025, 1.0, 1.733280051},
+    {1, 12, 1.0, 1.100405929, 0.95637945, 1.749119996},
+    {1, 13, 1.0, 1.0, 0.957934447, 1.822157123},
+    {1, 14, 0.972532065, 0.970115357, 0.946134337, 1.175696583},
+    {1, 15, 0.99952177, 0.997082328, 0.997190589, 0.995157044},
+    {1, 16, 1.0, 1.008690943, 1.0, 0.993425388},
+    {1, 17, 1.0, 1.094749685, 1.0, 0.968808467},
+    {1, 18, 0.910394249, 1.256844157, 1.004692366, 0.9601742},
+    {1, 19, 0.969501055, 0.932629867, 0.692868765, 1.47183158},
+    {1, 20, 1.004166412, 1.002212182, 0.999069843, 0.990034831},
+    {2, 3, 1.002525718, 1.032876701, 1.013871147, 0.90094953},
+    {2, 4, 0.996898004, 1.047596298, 1.033620538, 0.908772477},
+    {2, 5, 1.076551882, 1.081909003, 1.023339824, 0.929982936},
+    {2, 6, 1.174760923, 1.222437324, 1.018171004, 0.911498231},
+    {2, 7, 1.060793104, 1.116793198, 1.019180957, 0.961218039},
+    {2, 8, 1.024311498, 1.068406078, 1.027000795, 0.979217302},
+    {2, 9, 1.0, 0.851343711, 1.0, 1.038675574},
+    {2, 10, 1.205469976, 1.164585914, 1.011806317, 1.046169823},
+    {2, 11, 1.026169373, 1.104043935, 1.02969078, 1.074455386},
+    {2, 12, 1.0, 0.973386152, 1.00768862, 1.140671202},
+    {2, 13, 1.000151132, 1.183394668, 1.02002879, 1.145512213},
+    {2, 14, 0.904142159, 1.15279255, 0.942320195, 1.782924792},
+    {2, 15, 1.0, 1.0, 1.0, 1.0},
+    {2, 16, 1.0, 1.0, 1.0, 1.0},
+    {2, 17, 0.949055959, 1.542328793, 0.997372205, 0.775453996},
+    {2, 18, 0.906630564, 1.024085837, 1.016034583, 0.92601888},
+    {2, 19, 0.846647561, 0.864141549, 0.76837763, 3.207456948},
+    {2, 20, 1.001378, 1.02971, 1.027147, 0.968781},
+    {3, 4, 0.997607277, 1.00303472, 0.996199694, 1.01473019},
+    {3, 5, 1.0, 1.006616886, 1.0, 1.033283811},
+    {3, 6, 0.999157205, 1.006179146, 0.999130554, 1.034832749},
+    {3, 7, 1.0, 1.045439935, 1.0, 1.021150247},
+    {3, 8, 0.993851009, 1.026085655, 0.998688946, 1.066665676},
+    {3, 9, 1.0, 1.169701102, 1.0, 1.092177796},
+    {3, 10, 1.0, 1.057666085, 1.0, 1.134532014},
+    {3, 11, 1.007469726, 1.071917985, 0.984068272, 1.168636194},
+    {3, 12, 1.0, 1.14353473, 1.0, 1.05603303},
+    {3, 13, 0.995676258, 1.098361281, 0.970918061, 1.237191558},
+    {3, 14, 0.925367171, 1.10607204, 0.932969831, 1.902008495},
+    {3, 15, 1.0, 1.0, 1.0, 1.0},
+    {3, 16, 1.0, 1.201417898, 1.0, 1.069224728},
+    {3, 17, 1.0, 1.0, 1.0, 1.0},
+    {3, 18, 1.010817909, 1.030988277, 0.990197354, 0.90273666},
+    {3, 19, 1.0, 1.0, 1.0, 1.0},
+    {3, 20, 1.0, 1.0, 1.0, 1.0},
+    {4, 5, 0.999243146, 1.001156119, 0.998012298, 1.005250774},
+    {4, 6, 0.999795868, 1.003264179, 1.000310289, 1.007392782},
+    {4, 7, 1.040459289, 0.999432118, 0.994364425, 1.0032695},
+    {4, 8, 1.044919431, 1.019921513, 0.996484021, 1.008344412},
+    {4, 9, 1.0, 1.057872566, 1.0, 1.025657518},
+    {4, 10, 1.0, 1.079648053, 1.0, 1.050044169},
+    {4, 11, 1.0, 1.102764612, 1.0, 1.063694129},
+    {4, 12, 1.0, 1.199769134, 1.0, 1.109973833},
+    {4, 13, 0.984104227, 1.053040574, 0.985331233, 1.140905252},
+    {4, 14, 1.0, 1.07400611, 1.0, 2.308215191},
+    {4, 15, 1.0, 1.0, 1.0, 1.0},
+    {4, 16, 1.0, 1.108143673, 1.0, 1.197564208},
+    {4, 17, 1.0, 1.011759763, 1.0, 0.600340961},
+    {4, 18, 0.936811219, 1.010593999, 0.992573556, 0.905829247},
+    {4, 19, 1.0, 1.0, 1.0, 1.0},
+    {4, 20, 1.0, 1.0, 1.0, 1.0},
+    {6, 5, 1.000880464, 1.00041444, 1.000077547, 1.001432824},
+    {5, 7, 1.0, 1.002284353, 1.0, 1.001835788},
+    {5, 8, 1.0, 1.002779804, 1.0, 1.002495889},
+    {5, 9, 1.0, 1.010493989, 1.0, 1.006018054},
+    {5, 10, 1.0, 1.021668316, 1.0, 1.00988576},
+    {5, 11, 1.0, 1.032807063, 1.0, 1.013945424},
+    {5, 12, 1.0, 1.047298475, 1.0, 1.017817492},
+    {5, 13, 1.0, 1.060243344, 1.0, 1.021624748},
+    {5, 14, 1.0, 1.147595688, 1.0, 1.895305393},
+    {5, 15, 1.0, 1.0, 1.0, 1.0},
+    {5, 16, 1.0, 1.087272232, 1.0, 1.161390082},
+    {5, 17, 1.0, 1.0, 1.0, 1.0},
+    {5, 18, 1.012994431, 0.988591117, 0.974550548, 0.937130844},
+    {5, 19, 1.0, 1.0, 1.0, 1.0},
+    {5, 20, 1.0, 1.0, 1.0, 1.0},
+    {6, 7, 1.0, 1.002728434, 1.0, 1.000792201},
+    {6, 8, 1.0, 1.01815965, 1.0, 1.00214364},
+    {6, 9, 1.0, 1.034995284, 1.0, 1.00915706},
+    {6, 10, 1.0, 1.019174227, 1.0, 1.021283378},
+    {6, 11, 1.0, 1.046905515, 1.0, 1.033180106},
+    {6, 12, 1.0, 1.049219137, 1.0, 1.014096448},
+    {6, 13, 0.976951968, 1.027845529, 0.993688386, 1.076466918},
+    {6, 14, 1.0, 1.232939523, 1.0, 2.509259945},
+    {6, 15, 1.0, 1.0, 1.0, 1.0},
+    {6, 16, 1.0, 1.084740904, 1.0, 1.173916162},
+    {6, 17, 1.0, 1.223638763, 1.0, 0.615512682},
+    {6, 18, 0.908113163, 1.033366041, 0.985962886, 0.926156602},
+    {6, 19, 1.0, 1.0, 1.0, 1.0},
+    {6, 20, 1.0, 1.214638734, 1.0, 1.245039498},
+    {8, 7, 1.0, 1.000024335, 1.0, 1.000050537},
+    {7, 9, 1.0, 1.002995876, 1.0, 1.001204174},
+    {7, 10, 1.0, 1.009928206, 1.0, 1.003194615},
+    {7, 11, 1.0, 1.017880545, 1.0, 1.00564748},
+    {7, 12, 1.0, 1.028994325, 1.0, 1.008191499},
+    {7, 13, 1.0, 1.039372957, 1.0, 1.010825138},
+    {7, 14, 1.0, 1.184340443, 1.0, 1.996386669},
+    {7, 15, 1.0, 1.0, 1.0, 1.0},
+    {7, 16, 1.0, 1.116694577, 1.0, 1.199326059},
+    {7, 17, 1.0, 1.0, 1.0, 1.0},
+    {7, 18, 1.0, 0.835763343, 1.0, 0.982651529},
+    {7, 19, 1.0, 1.0, 1.0, 1.0},
+    {7, 20, 1.0, 1.0, 1.0, 1.0},
+    {8, 9, 1.0, 1.002480637, 1.0, 1.000761237},
+    {8, 10, 1.0, 1.008972412, 1.0, 1.002441051},
+    {8, 11, 1.0, 1.069223964, 1.0, 1.016422347},
+    {8, 12, 1.0, 1.034910633, 1.0, 1.103421755},
+    {8, 13, 1.0, 1.016370338, 1.0, 1.049035838},
+    {8, 14, 1.0, 1.188334783, 1.0, 2.013859174},
+    {8, 15, 1.0, 1.0, 1.0, 1.0},
+    {8, 16, 1.0, 1.119954454, 1.0, 1.206043295},
+    {8, 17, 1.0, 0.95667731, 1.0, 0.447666011},
+    {8, 18, 0.984613203, 1.076539234, 0.962006651, 0.959065662},
+    {8, 19, 1.0, 1.0, 1.0, 1.0},
+    {8, 20, 1.0, 1.0, 1.0, 1.0},
+    {9, 10, 1.0, 1.001508227, 1.0, 0.999762786},
+    {9, 11, 1.0, 1.006268954, 1.0, 1.001633952},
+    {9, 12, 1.0, 1.02076168, 1.0, 1.055369591},
+    {9, 13, 1.001516371, 1.013511439, 0.99764101, 1.028939539},
+    {9, 14, 1.0, 1.243461678, 1.0, 3.021197546},
+    {9, 15, 1.0, 1.0, 1.0, 1.0},
+    {9, 16, 1.0, 1.155145836, 1.0, 1.233272781},
+    {9, 17, 1.0, 1.170217596, 1.0, 0.569681333},
+    {9, 18, 0.754473958, 1.339283552, 0.985891113, 0.956075596},
+    {9, 19, 1.0, 1.0, 1.0, 1.0},
+    {9, 20, 1.0, 1.0, 1.0, 1.0},
+    {10, 11, 1.0, 1.006767176, 1.0, 0.998793111},
+    {10, 12, 1.0, 1.001370076, 1.0, 1.001150096},
+    {10, 13, 1.0, 1.002972346, 1.0, 1.002229938},
+    {10, 14, 1.0, 1.159131722, 1.0, 3.169143057},
+    {10, 15, 1.0, 1.0, 1.0, 1.0},
+    {10, 16, 1.0, 1.190354273, 1.0, 1.256123503},
+    {10, 17, 1.0, 1.0, 1.0, 1.0},
+    {10, 18, 0.828967164, 1.087956749, 0.988937417, 1.013453092},
+    {10, 19, 1.0, 1.0, 1.0, 1.0},
+    {10, 20, 1.0, 1.0, 1.0, 1.0},
+    {11, 12, 1.0, 1.001357085, 1.0, 1.000235044},
+    {11, 13, 1.0, 1.002553544, 1.0, 1.007186267},
+    {11, 14, 1.0, 1.305249405, 1.0, 2.191555216},
+    {11, 15, 1.0, 1.0, 1.0, 1.0},
+    {11, 16, 1.0, 1.219206702, 1.0, 1.276565536},
+    {11, 17, 1.0, 0.599484191, 1.0, 0.662072469},
+    {11, 18, 1.0, 1.0, 1.0, 1.0},
+    {11, 19, 1.0, 1.0, 1.0, 1.0},
+    {11, 20, 1.0, 1.0, 1.0, 1.0},
+    {12, 13, 1.0, 1.00081052, 1.0, 1.000182392},
+    {12, 14, 1.0, 1.342647661, 1.0, 2.23435404},
+    {12, 15, 1.0, 1.0, 1.0, 1.0},
+    {12, 16, 1.0, 1.252151449, 1.0, 1.294070556},
+    {12, 17, 1.0, 1.0, 1.0, 1.0},
+    {12, 18, 1.0, 1.082905109, 1.0, 1.086557826},
+    {12, 19, 1.0, 1.0, 1.0, 1.0},
+    {12, 20, 1.0, 1.0, 1.0, 1.0},
+    {13, 14, 1.695358382, 1.120233729, 1.064818089, 3.786003724},
+    {13, 15, 1.0, 1.0, 1.0, 1.0},
+    {13, 16, 1.0, 0.87018496, 1.049594632, 1.803567587},
+    {13, 17, 1.0, 0.551405318, 0.897162268, 0.740416402},
+    {13, 18, 0.975187766, 1.171714677, 0.973091413, 1.103693489},
+    {13, 19, 1.0, 1.0, 1.0, 1.0},
+    {13, 20, 1.0, 1.0, 1.0, 1.0},
+    {14, 15, 1.0, 1.0, 1.0, 1.0},
+    {14, 16, 1.0, 1.121416201, 1.0, 1.377504607},
+    {14, 17, 1.0, 1.0, 1.0, 1.0},
+    {14, 18, 1.0, 1.0, 1.0, 1.0},
+    {14, 19, 1.0, 1.0, 1.0, 1.0},
+    {14, 20, 1.0, 1.0, 1.0, 1.0},
+    {15, 16, 1.0, 1.0, 1.0, 1.0},
+    {17, 15, 1.0, 1.0, 1.0, 1.0},
+    {15, 18, 1.0, 1.0, 1.0, 1.0},
+    {15, 19, 1.0, 1.0, 1.0, 1.0},
+    {15, 20, 1.006502, 1.001341, 0.999039, 0.988822},
+    {17, 16, 1.0, 1.0, 1.0, 1.0},
+    {16, 18, 0.795660392, 1.101731308, 1.025536736, 1.022749748},
+    {16, 19, 1.0, 1.0, 1.0, 1.0},
+    {16, 20, 1.0, 1.159720623, 1.0, 0.954215746},
+    {17, 18, 1.0, 1.014832832, 1.0, 0.940587083},
+    {17, 19, 1.0, 1.0, 1.0, 1.0},
+    {17, 20, 1.0, 1.0, 1.0, 1.0},
+    {18, 19, 1.0, 1.0, 1.0, 1.0},
+    {18, 20, 1.0, 1.0, 1.0, 1.0},
+    {19, 20, 1.0, 1.0, 1.0, 1.0},
+}};
+
+}  // namespace
+
+std::vector<gerg_component> gerg2008_components() {
+  return {
+      // Methane
+      {190.564, 10139.342719, 4.5992e6, 0.01142,
+       make_terms(methane_n, methane_type_d, methane_type_t, methane_type_c)},
+      // Nitrogen
+      {126.192, 11183.9, 3.3958e6, 0.0372,
+       make_terms(nitrogen_n, methane_type_d, methane_type_t, methane_type_c)},
+      // Carbon dioxide
+      {304.1282, 10624.978698, 7.3773e6, 0.22394,
+       make_terms(carbon_dioxide_n, co2_d, co2_t, co2_c)},
+      // Ethane
+      {305.322, 6870.85454, 4.8722e6, 0.0995,
+       make_terms(ethane_n, methane_type_d, methane_type_t, methane_type_c)},
+      // Propane
+      {369.825, 5000.043088, 4.2512e6, 0.1521,
+       make_terms(propane_n, nonpolar_d, nonpolar_t, nonpolar_c)},
+      // Isobutane
+      {407.817, 3860.14294, 3.629e6, 0.184,
+       make_terms(isobutane_n, nonpolar_d, nonpolar_t, nonpolar_c)},
+      // N-butane
+      {425.125, 3920.016792, 3.796e6, 0.201,
+       make_terms(n_butane_n, nonpolar_d, nonpolar_t, nonpolar_c)},
+      // Isopentane
+      {460.35, 3271.0, 3.378e6, 0.2274,
+       make_terms(isopentane_n, nonpolar_d, nonpolar_t, nonpolar_c)},
+      // N-pentane
+      {469.7, 3215.577588, 3.37e6, 0.251,
+       make_terms(n_pentane_n, nonpolar_d, nonpolar_t, nonpolar_c)},
+      // N-hexane
+      {507.82, 2705.877875, 3.034e6, 0.299,
+       make_terms(n_hexane_n, nonpolar_d, nonpolar_t, nonpolar_c)},
+      // N-heptane
+      {540.13, 2315.324434, 2.736e6, 0.349,
+       make_terms(n_heptane_n, nonpolar_d, nonpolar_t, nonpolar_c)},
+      // N-octane
+      {569.32, 2056.404127, 2.497e6, 0.393,
+       make_terms(n_octane_n, nonpolar_d, nonpolar_t, nonpolar_c)},
+      // N-nonane
+      {594.55, 1810.0, 2.281e6, 0.443,
+       make_terms(n_nonane_n, nonpolar_d, nonpolar_t, nonpolar_c)},
+      // N-decane
+      {617.7, 1640.0, 2.103e6, 0.488,
+       make_terms(n_decane_n, nonpolar_d, nonpolar_t, nonpolar_c)},
+      // Hydrogen
+      {33.19, 14940.0, 1.315e6, -0.219,
+       make_terms(hydrogen_n, hydrogen_d, hydrogen_t, hydrogen_c)},
+      // Oxygen
+      {154.595, 13630.0, 5.043e6, 0.0222,
+       make_terms(oxygen_n, nonpolar_d, nonpolar_t, nonpolar_c)},
+      // Carbon monoxide
+      {132.86, 10850.0, 3.494e6, 0.0497,
+       make_terms(carbon_monoxide_n, nonpolar_d, nonpolar_t, nonpolar_c)},
+      // Water
+      {647.096, 17873.71609, 22.064e6, 0.3443,
+       make_terms(water_n, water_d, water_t, water_c)},
+      // Hydrogen sulfide
+      {373.1, 10190.0, 9e6, 0.1005,
+       make_terms(hydrogen_sulfide_n, nonpolar_d, nonpolar_t, nonpolar_c)},
+      // Helium
+      {5.1953, 17399.0, 0.22746e6, -0.3836,
+       make_terms(helium_n, helium_d, helium_t, helium_c)},
+      // Argon
+      {150.687, 13407.429659, 4.863e6, -0.00219,
+       make_terms(argon_n, nonpolar_d, nonpolar_t, nonpolar_c)},
+  };
+}
+
+std::vector<gerg_binary> gerg2008_binaries() {
+  std::vector<gerg_binary> binaries;
+  binaries.reserve(reducing_table.size());
+  for (const auto &r : reducing_table) {
+    binaries.push_back({r.i, r.j, r.beta_v, r.gamma_v, r.beta_t, r.gamma_t,
+                        0.0, {}});
+  }
+
+  const auto set_departure = [&binaries](gerg_species i, gerg_species j,
+                                         double f, auto terms) {
+    const auto si = static_cast<std::size_t>(i);
+    const auto sj = static_cast<std::size_t>(j);
+    auto it = std::find_if(binaries.begin(), binaries.end(),
+                           [si, sj](const gerg_binary &b) {
+                             return (b.i == si && b.j == sj) ||
+                                    (b.i == sj && b.j == si);
+                           });
+    it->f = f;
+    it->departure = std::move(terms);
+  };
+  using s = gerg_species;
+  set_departure(s::methane, s::nitrogen, 1.0, methane_nitrogen_departure());
+  set_departure(s::methane, s::carbon_dioxide, 1.0,
+                methane_carbon_dioxide_departure());
+  set_departure(s::methane, s::ethane, 1.0, methane_ethane_departure());
+  set_departure(s::methane, s::propane, 1.0, methane_propane_departure());
+  set_departure(s::nitrogen, s::carbon_dioxide, 1.0,
+                nitrogen_carbon_dioxide_departure());
+  set_departure(s::nitrogen, s::ethane, 1.0, nitrogen_ethane_departure());
+  set_departure(s::methane, s::hydrogen, 1.0, methane_hydrogen_departure());
+  set_departure(s::methane, s::n_butane, 1.0, generalized_departure());
+  set_departure(s::methane, s::isobutane, 0.771035405688,
+                generalized_departure());
+  set_departure(s::ethane, s::propane, 0.13042476515, generalized_departure());
+  set_departure(s::ethane, s::n_butane, 0.281570073085,
+                generalized_departure());
+  set_departure(s::ethane, s::isobutane, 0.260632376098,
+                generalized_departure());
+  set_departure(s::propane, s::n_butane, 0.0312572600489,
+                generalized_departure());
+  set_departure(s::propane, s::isobutane, -0.0551609771024,
+                generalized_departure());
+  set_departure(s::isobutane, s::n_butane, -0.0551240293009,
+                generalized_departure());
+  return binaries;
+}
+
+}  // namespace eos
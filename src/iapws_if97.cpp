@@ -0,0 +1,801 @@
+#include "eos/water/iapws_if97.hpp"
+
+#include <array>    // std::array
+#include <cassert>  // assert
+#include <cmath>    // std::abs, std::log, std::sqrt
+#include <limits>   // std::numeric_limits
+
+namespace eos {
+
+namespace {
+
+/// @brief Term of a polynomial in two variables, n x^i y^j
+struct ij_term {
+  int i;
+  int j;
+  double n;
+};
+
+/// @brief Powers of a value with integer exponents in [Min, Max] computed by
+/// repeated multiplication
+template <int Min, int Max>
+class power_table {
+ public:
+  explicit power_table(double x) noexcept {
+    pow_[-Min] = 1.0;
+    for (int k = 1; k <= Max; ++k) {
+      pow_[k - Min] = pow_[k - 1 - Min] * x;
+    }
+    if constexpr (Min < 0) {
+      const auto inv = 1 / x;
+      for (int k = -1; k >= Min; --k) {
+        pow_[k - Min] = pow_[k + 1 - Min] * inv;
+      }
+    }
+  }
+
+  double operator[](int k) const noexcept { return pow_[k - Min]; }
+
+ private:
+  std::array<double, Max - Min + 1> pow_;
+};
+
+/// @brief Evaluates a polynomial of tabulated powers
+template <typename X, typename Y, std::size_t N>
+double evaluate(const std::array<ij_term, N> &terms, const X &x,
+                const Y &y) noexcept {
+  double sum = 0.0;
+  for (const auto &term : terms) {
+    sum += term.n * x[term.i] * y[term.j];
+  }
+  return sum;
+}
+
+constexpr double nan = std::numeric_limits<double>::quiet_NaN();
+constexpr double R = 461.526;  // Specific gas constant [J/kg-K]
+
+/// @brief Residual part of Gibbs energy of region 1
+constexpr std::array<ij_term, 34> region1 = {{
+    {0, -2, 0.14632971213167},    {0, -1, -0.84548187169114},
+    {0, 0, -0.37563603672040e1},  {0, 1, 0.33855169168385e1},
+    {0, 2, -0.95791963387872},    {0, 3, 0.15772038513228},
+    {0, 4, -0.16616417199501e-1}, {0, 5, 0.81214629983568e-3},
+    {1, -9, 0.28319080123804e-3}, {1, -7, -0.60706301565874e-3},
+    {1, -1, -0.18990068218419e-1}, {1, 0, -0.32529748770505e-1},
+    {1, 1, -0.21841717175414e-1}, {1, 3, -0.52838357969930e-4},
+    {2, -3, -0.47184321073267e-3}, {2, 0, -0.30001780793026e-3},
+    {2, 1, 0.47661393906987e-4},  {2, 3, -0.44141845330846e-5},
+    {2, 17, -0.72694996297594e-15}, {3, -4, -0.31679644845054e-4},
+    {3, 0, -0.28270797985312e-5}, {3, 6, -0.85205128120103e-9},
+    {4, -5, -0.22425281908000e-5}, {4, -2, -0.65171222895601e-6},
+    {4, 10, -0.14341729937924e-12}, {5, -8, -0.40516996860117e-6},
+    {8, -11, -0.12734301741641e-8}, {8, -6, -0.17424871230634e-9},
+    {21, -29, -0.68762131295531e-18}, {23, -31, 0.14478307828521e-19},
+    {29, -38, 0.26335781662795e-22}, {30, -39, -0.11947622640071e-22},
+    {31, -40, 0.18228094581404e-23}, {32, -41, -0.93537087292458e-25},
+}};
+
+/// @brief Ideal-gas part of Gibbs energy of region 2, with i unused
+constexpr std::array<ij_term, 9> region2_ideal = {{
+    {0, 0, -0.96927686500217e1},
+    {0, 1, 0.10086655968018e2},
+    {0, -5, -0.56087911283020e-2},
+    {0, -4, 0.71452738081455e-1},
+    {0, -3, -0.40710498223928},
+    {0, -2, 0.14240819171444e1},
+    {0, -1, -0.43839511319450e1},
+    {0, 2, -0.28408632460772},
+    {0, 3, 0.21268463753307e-1},
+}};
+
+/// @brief Residual part of Gibbs energy of region 2
+constexpr std::array<ij_term, 43> region2_residual = {{
+    {1, 0, -0.17731742473213e-2},  {1, 1, -0.17834862292358e-1},
+    {1, 2, -0.45996013696365e-1},  {1, 3, -0.57581259083432e-1},
+    {1, 6, -0.50325278727930e-1},  {2, 1, -0.33032641670203e-4},
+    {2, 2, -0.18948987516315e-3},  {2, 4, -0.39392777243355e-2},
+    {2, 7, -0.43797295650573e-1},  {2, 36, -0.26674547914087e-4},
+    {3, 0, 0.20481737692309e-7},   {3, 1, 0.43870667284435e-6},
+    {3, 3, -0.32277677238570e-4},  {3, 6, -0.15033924542148e-2},
+    {3, 35, -0.40668253562649e-1}, {4, 1, -0.78847309559367e-9},
+    {4, 2, 0.12790717852285e-7},   {4, 3, 0.48225372718507e-6},
+    {5, 7, 0.22922076337661e-5},   {6, 3, -0.16714766451061e-10},
+    {6, 16, -0.21171472321355e-2}, {6, 35, -0.23895741934104e2},
+    {7, 0, -0.59059564324270e-17}, {7, 11, -0.12621808899101e-5},
+    {7, 25, -0.38946842435739e-1}, {8, 8, 0.11256211360459e-10},
+    {8, 36, -0.82311340897998e1},  {9, 13, 0.19809712802088e-7},
+    {10, 4, 0.10406965210174e-18}, {10, 10, -0.10234747095929e-12},
+    {10, 14, -0.10018179379511e-8}, {16, 29, -0.80882908646985e-10},
+    {16, 50, 0.10693031879409},    {18, 57, -0.33662250574171},
+    {20, 20, 0.89185845355421e-24}, {20, 35, 0.30629316876232e-12},
+    {20, 48, -0.42002467698208e-5}, {21, 21, -0.59056029685639e-25},
+    {22, 53, 0.37826947613457e-5}, {23, 39, -0.12768608934681e-14},
+    {24, 26, 0.73087610595061e-28}, {24, 40, 0.55414715350778e-16},
+    {24, 58, -0.94369707241210e-6},
+}};
+
+/// @brief Residual part of Helmholtz energy of region 3, without the
+/// logarithmic term
+constexpr std::array<ij_term, 39> region3 = {{
+    {0, 0, -0.15732845290239e2},  {0, 1, 0.20944396974307e2},
+    {0, 2, -0.76867707878716e1},  {0, 7, 0.26185947787954e1},
+    {0, 10, -0.28080781148620e1}, {0, 12, 0.12053369696517e1},
+    {0, 23, -0.84566812812502e-2}, {1, 2, -0.12654315477714e1},
+    {1, 6, -0.11524407806681e1},  {1, 15, 0.88521043984318},
+    {1, 17, -0.64207765181607},   {2, 0, 0.38493460186671},
+    {2, 2, -0.85214708824206},    {2, 6, 0.48972281541877e1},
+    {2, 7, -0.30502617256965e1},  {2, 22, 0.39420536879154e-1},
+    {2, 26, 0.12558408424308},    {3, 0, -0.27999329698710},
+    {3, 2, 0.13899799569460e1},   {3, 4, -0.20189915023570e1},
+    {3, 16, -0.82147637173963e-2}, {3, 26, -0.47596035734923},
+    {4, 0, 0.43984074473500e-1},  {4, 2, -0.44476435428739},
+    {4, 4, 0.90572070719733},     {4, 26, 0.70522450087967},
+    {5, 1, 0.10770512626332},     {5, 3, -0.32913623258954},
+    {5, 26, -0.50871062041158},   {6, 0, -0.22175400873096e-1},
+    {6, 2, 0.94260751665092e-1},  {6, 26, 0.16436278447961},
+    {7, 2, -0.13503372241348e-1}, {8, 26, -0.14834345352472e-1},
+    {9, 2, 0.57922953628084e-3},  {9, 26, 0.32308904703711e-2},
+    {10, 0, 0.80964802996215e-4}, {10, 1, -0.16557679795037e-3},
+    {11, 26, -0.44923899061815e-4},
+}};
+
+/// @brief Coefficient of the logarithmic term of region 3
+constexpr double region3_log = 0.10658070028513e1;
+
+/// @brief Backward equation T(p, h) of region 1
+constexpr std::array<ij_term, 20> region1_ph = {{
+    {0, 0, -0.23872489924521e3}, {0, 1, 0.40421188637945e3},
+    {0, 2, 0.11349746881718e3},  {0, 6, -0.58457616048039e1},
+    {0, 22, -0.15285482413140e-3}, {0, 32, -0.10866707695377e-5},
+    {1, 0, -0.13391744872602e2}, {1, 1, 0.43211039183559e2},
+    {1, 2, -0.54010067170506e2}, {1, 3, 0.30535892203916e2},
+    {1, 4, -0.65964749423638e1}, {1, 10, 0.93965400878363e-2},
+    {1, 32, 0.11573647505340e-6}, {2, 10, -0.25858641282073e-4},
+    {2, 32, -0.40644363084799e-8}, {3, 10, 0.66456186191635e-7},
+    {3, 32, 0.80670734103027e-10}, {4, 32, -0.93477771213947e-12},
+    {5, 32, 0.58265442020601e-14}, {6, 32, -0.15020185953503e-16},
+}};
+
+/// @brief Backward equation T(p, s) of region 1
+constexpr std::array<ij_term, 20> region1_ps = {{
+    {0, 0, 0.17478268058307e3},  {0, 1, 0.34806930892873e2},
+    {0, 2, 0.65292584978455e1},  {0, 3, 0.33039981775489},
+    {0, 11, -0.19281382923196e-6}, {0, 31, -0.24909197244573e-22},
+    {1, 0, -0.26107636489332},   {1, 1, 0.22592965981586},
+    {1, 2, -0.64256463395226e-1}, {1, 3, 0.78876289270526e-2},
+    {1, 12, 0.35672110607366e-9}, {1, 31, 0.17332496994895e-23},
+    {2, 0, 0.56608900654837e-3}, {2, 1, -0.32635483139717e-3},
+    {2, 2, 0.44778286690632e-4}, {2, 9, -0.51322156908507e-9},
+    {2, 31, -0.42522657042207e-25}, {3, 10, 0.26400441360689e-12},
+    {3, 32, 0.78124600459723e-28}, {4, 32, -0.30732199903668e-30},
+}};
+
+/// @brief Backward equation T(p, h) of region 2a
+constexpr std::array<ij_term, 34> region2a_ph = {{
+    {0, 0, 0.10898952318288e4},   {0, 1, 0.84951654495535e3},
+    {0, 2, -0.10781748091826e3},  {0, 3, 0.33153654801263e2},
+    {0, 7, -0.74232016790248e1},  {0, 20, 0.11765048724356e2},
+    {1, 0, 0.18445749355790e1},   {1, 1, -0.41792700549624e1},
+    {1, 2, 0.62478196935812e1},   {1, 3, -0.17344563108114e2},
+    {1, 7, -0.20058176862096e3},  {1, 9, 0.27196065473796e3},
+    {1, 11, -0.45511318285818e3}, {1, 18, 0.30919688604755e4},
+    {1, 44, 0.25226640357872e6},  {2, 0, -0.61707422868339e-2},
+    {2, 2, -0.31078046629583},    {2, 7, 0.11670873077107e2},
+    {2, 36, 0.12812798404046e9},  {2, 38, -0.98554909623276e9},
+    {2, 40, 0.28224546973002e10}, {2, 42, -0.35948971410703e10},
+    {2, 44, 0.17227349913197e10}, {3, 24, -0.13551334240775e5},
+    {3, 44, 0.12848734664650e8},  {4, 12, 0.13865724283226e1},
+    {4, 32, 0.23598832556514e6},  {4, 44, -0.13105236545054e8},
+    {5, 32, 0.73999835474766e4},  {5, 36, -0.55196697030060e6},
+    {5, 42, 0.37154085996233e7},  {6, 34, 0.19127729239660e5},
+    {6, 44, -0.41535164835634e6}, {7, 28, -0.62459855192507e2},
+}};
+
+/// @brief Backward equation T(p, h) of region 2b
+constexpr std::array<ij_term, 38> region2b_ph = {{
+    {0, 0, 0.14895041079516e4},   {0, 1, 0.74307798314034e3},
+    {0, 2, -0.97708318797837e2},  {0, 12, 0.24742464705674e1},
+    {0, 18, -0.63281320016026},   {0, 24, 0.11385952129658e1},
+    {0, 28, -0.47811863648625},   {0, 40, 0.85208123431544e-2},
+    {1, 0, 0.93747147377932},     {1, 2, 0.33593118604916e1},
+    {1, 6, 0.33809355601454e1},   {1, 12, 0.16844539671904},
+    {1, 18, 0.73875745236695},    {1, 24, -0.47128737436186},
+    {1, 28, 0.15020273139707},    {1, 40, -0.21764114219750e-2},
+    {2, 2, -0.21810755324761e-1}, {2, 8, -0.10829784403677},
+    {2, 18, -0.46333324635812e-1}, {2, 40, 0.71280351959551e-4},
+    {3, 1, 0.11032831789999e-3},  {3, 2, 0.18955248387902e-3},
+    {3, 12, 0.30891541160537e-2}, {3, 24, 0.13555504554949e-2},
+    {4, 2, 0.28640237477456e-6},  {4, 12, -0.10779857357512e-4},
+    {4, 18, -0.76462712454814e-4}, {4, 24, 0.14052392818316e-4},
+    {4, 28, -0.31083814331434e-4}, {4, 40, -0.10302738212103e-5},
+    {5, 18, 0.28217281635040e-6}, {5, 24, 0.12704902271945e-5},
+    {5, 40, 0.73803353468292e-7}, {6, 28, -0.11030139238909e-7},
+    {7, 2, -0.81456365207833e-13}, {7, 28, -0.25180545682962e-10},
+    {9, 1, -0.17565233969407e-17}, {9, 40, 0.86934156344163e-14},
+}};
+
+/// @brief Backward equation T(p, h) of region 2c
+constexpr std::array<ij_term, 23> region2c_ph = {{
+    {-7, 0, -0.32368398555242e13}, {-7, 4, 0.73263350902181e13},
+    {-6, 0, 0.35825089945447e12},  {-6, 2, -0.58340131851590e12},
+    {-5, 0, -0.10783068217470e11}, {-5, 2, 0.20825544563171e11},
+    {-2, 0, 0.61074783564516e6},   {-2, 1, 0.85977722535580e6},
+    {-1, 0, -0.25745723604170e5},  {-1, 2, 0.31081088422714e5},
+    {0, 0, 0.12082315865936e4},    {0, 1, 0.48219755109255e3},
+    {1, 4, 0.37966001272486e1},    {1, 8, -0.10842984880077e2},
+    {2, 4, -0.45364172676660e-1},  {6, 0, 0.14559115658698e-12},
+    {6, 1, 0.11261597407230e-11},  {6, 4, -0.17804982240686e-10},
+    {6, 10, 0.12324579690832e-6},   {6, 12, -0.11606921130984e-5},
+    {6, 16, 0.27846367088554e-4},   {6, 20, -0.59270038474176e-3},
+    {6, 22, 0.12918582991878e-2},
+}};
+
+/// @brief Backward equation T(p, s) of region 2a, with i in quarters
+constexpr std::array<ij_term, 46> region2a_ps = {{
+    {-6, -24, -0.39235983861984e6}, {-6, -23, 0.51526573827270e6},
+    {-6, -19, 0.40482443161048e5},  {-6, -13, -0.32193790923902e3},
+    {-6, -11, 0.96961424218694e2},  {-6, -10, -0.22867846371773e2},
+    {-5, -19, -0.44942914124357e6}, {-5, -15, -0.50118336020166e4},
+    {-5, -6, 0.35684463560015},     {-4, -26, 0.44235335848190e5},
+    {-4, -21, -0.13673388811708e5}, {-4, -17, 0.42163260207864e6},
+    {-4, -16, 0.22516925837475e5},  {-4, -9, 0.47442144865646e3},
+    {-4, -8, -0.14931130797647e3},  {-3, -15, -0.19781126320452e6},
+    {-3, -14, -0.23554399470760e5}, {-2, -26, -0.19070616302076e5},
+    {-2, -13, 0.55375669883164e5},  {-2, -9, 0.38293691437363e4},
+    {-2, -7, -0.60391860580567e3},  {-1, -27, 0.19363102620331e4},
+    {-1, -25, 0.42660643698610e4},  {-1, -11, -0.59780638872718e4},
+    {-1, -6, -0.70401463926862e3},  {1, 1, 0.33836784107553e3},
+    {1, 4, 0.20862786635187e2},     {1, 8, 0.33834172656196e-1},
+    {1, 11, -0.43124428414893e-4},  {2, 0, 0.16653791356412e3},
+    {2, 1, -0.13986292055898e3},    {2, 5, -0.78849547999872},
+    {2, 6, 0.72132411753872e-1},    {2, 10, -0.59754839398283e-2},
+    {2, 14, -0.12141358953904e-4},  {2, 16, 0.23227096733871e-6},
+    {3, 0, -0.10538463566194e2},    {3, 4, 0.20718925496502e1},
+    {3, 9, -0.72193155260427e-1},   {3, 17, 0.20749887081120e-6},
+    {4, 7, -0.18340657911379e-1},   {4, 18, 0.29036272348696e-6},
+    {5, 3, 0.21037527893619},       {5, 15, 0.25681239729999e-3},
+    {6, 5, -0.12799002933781e-1},   {6, 18, -0.82198102652018e-5},
+}};
+
+/// @brief Backward equation T(p, s) of region 2b
+constexpr std::array<ij_term, 44> region2b_ps = {{
+    {-6, 0, 0.31687665083497e6},  {-6, 11, 0.20864175881858e2},
+    {-5, 0, -0.39859399803599e6}, {-5, 11, -0.21816058518877e2},
+    {-4, 0, 0.22369785194242e6},  {-4, 1, -0.27841703445817e4},
+    {-4, 11, 0.99207436071480e1}, {-3, 0, -0.75197512299157e5},
+    {-3, 1, 0.29708605951158e4},  {-3, 11, -0.34406878548526e1},
+    {-3, 12, 0.38815564249115},   {-2, 0, 0.17511295085750e5},
+    {-2, 1, -0.14237112854449e4}, {-2, 6, 0.10943803364167e1},
+    {-2, 10, 0.89971619308495},   {-1, 0, -0.33759740098958e4},
+    {-1, 1, 0.47162885818355e3},  {-1, 5, -0.19188241993679e1},
+    {-1, 8, 0.41078580492196},    {-1, 9, -0.33465378172097},
+    {0, 0, 0.13870034777505e4},   {0, 1, -0.40663326195838e3},
+    {0, 2, 0.41727347159610e2},   {0, 4, 0.21932549434532e1},
+    {0, 5, -0.10320050009077e1},  {0, 6, 0.35882943516703},
+    {0, 9, 0.52511453726066e-2},  {1, 0, 0.12838916450705e2},
+    {1, 1, -0.28642437219381e1},  {1, 2, 0.56912683664855},
+    {1, 3, -0.99962954584931e-1}, {1, 7, -0.32632037778459e-2},
+    {1, 8, 0.23320922576723e-3},  {2, 0, -0.15334809857450},
+    {2, 1, 0.29072288239902e-1},  {2, 5, 0.37534702741167e-3},
+    {3, 0, 0.17296691702411e-2},  {3, 1, -0.38556050844504e-3},
+    {3, 3, -0.35017712292608e-4}, {4, 0, -0.14566393631492e-4},
+    {4, 1, 0.56420857267269e-5},  {5, 0, 0.41286150074605e-7},
+    {5, 1, -0.20684671118824e-7}, {5, 2, 0.16409393674725e-8},
+}};
+
+/// @brief Backward equation T(p, s) of region 2c
+constexpr std::array<ij_term, 30> region2c_ps = {{
+    {-2, 0, 0.90968501005365e3},  {-2, 1, 0.24045667088420e4},
+    {-1, 0, -0.59162326387130e3}, {0, 0, 0.54145404128074e3},
+    {0, 1, -0.27098308411192e3},  {0, 2, 0.97976525097926e3},
+    {0, 3, -0.46966772959435e3},  {1, 0, 0.14399274604723e2},
+    {1, 1, -0.19104204230429e2},  {1, 3, 0.53299167111971e1},
+    {1, 4, -0.21252975375934e2},  {2, 0, -0.31147334413760},
+    {2, 1, 0.60334840894623},     {2, 2, -0.42764839702509e-1},
+    {3, 0, 0.58185597255259e-2},  {3, 1, -0.14597008284753e-1},
+    {3, 5, 0.56631175631027e-2},  {4, 0, -0.76155864584577e-4},
+    {4, 1, 0.22440342919332e-3},  {4, 4, -0.12561095013413e-4},
+    {5, 0, 0.63323132660934e-6},  {5, 1, -0.20541989675375e-5},
+    {5, 2, 0.36405370390082e-7},  {6, 0, -0.29759897789215e-8},
+    {6, 1, 0.10136618529763e-7},  {7, 0, 0.59925719692351e-11},
+    {7, 1, -0.20677870105164e-10}, {7, 3, -0.20874278181886e-10},
+    {7, 4, 0.10162166825089e-9},  {7, 5, -0.16429828281347e-9},
+}};
+
+/// @brief Backward equation T(p, h) of region 3a
+constexpr std::array<ij_term, 31> region3a_ph = {{
+    {-12, 0, -0.133645667811215e-6}, {-12, 1, 0.455912656802978e-5},
+    {-12, 2, -0.146294640700979e-4}, {-12, 6, 0.63934131297008e-2},
+    {-12, 14, 0.372783927268847e3},  {-12, 16, -0.718654377460447e4},
+    {-12, 20, 0.5734947521034e6},    {-12, 22, -0.267569329111439e7},
+    {-10, 1, -0.334066283302614e-4}, {-10, 5, -0.245479214069597e-1},
+    {-10, 12, 0.478087847764996e2},  {-8, 0, 0.764664131818904e-5},
+    {-8, 2, 0.128350627676972e-2},   {-8, 4, 0.171219081377331e-1},
+    {-8, 10, -0.851007304583213e1},  {-5, 2, -0.136513461629781e-1},
+    {-3, 0, -0.384460997596657e-5},  {-2, 1, 0.337423807911655e-2},
+    {-2, 3, -0.551624873066791},     {-2, 4, 0.72920227710747},
+    {-1, 0, -0.992522757376041e-2},  {-1, 2, -0.119308831407288},
+    {0, 0, 0.793929190615421},       {0, 1, 0.454270731799386},
+    {1, 1, 0.20999859125991},        {3, 0, -0.642109823904738e-2},
+    {3, 1, -0.23515586860454e-1},    {4, 0, 0.252233108341612e-2},
+    {4, 3, -0.764885133368119e-2},   {10, 4, 0.136176427574291e-1},
+    {12, 5, -0.133027883575669e-1},
+}};
+
+/// @brief Backward equation T(p, h) of region 3b
+constexpr std::array<ij_term, 33> region3b_ph = {{
+    {-12, 0, 0.32325457364492e-4},   {-12, 1, -0.127575556587181e-3},
+    {-10, 0, -0.475851877356068e-3}, {-10, 1, 0.156183014181602e-2},
+    {-10, 5, 0.105724860113781},     {-10, 10, -0.858514221132534e2},
+    {-10, 12, 0.724140095480911e3},  {-8, 0, 0.296475810273257e-2},
+    {-8, 1, -0.592721983365988e-2},  {-8, 2, -0.126305422818666e-1},
+    {-8, 4, -0.115716196364853},     {-8, 10, 0.849000969739595e2},
+    {-6, 0, -0.108602260086615e-1},  {-6, 1, 0.154304475328851e-1},
+    {-6, 2, 0.750455441524466e-1},   {-4, 0, 0.252520973612982e-1},
+    {-4, 1, -0.602507901232996e-1},  {-3, 5, -0.307622221350501e1},
+    {-2, 0, -0.574011959864879e-1},  {-2, 4, 0.503471360939849e1},
+    {-1, 2, -0.925081888584834},     {-1, 4, 0.391733882917546e1},
+    {-1, 6, -0.77314600713019e2},    {-1, 10, 0.949308762098587e4},
+    {-1, 14, -0.141043719679409e7},  {-1, 16, 0.849166230819026e7},
+    {0, 0, 0.861095729446704},       {0, 2, 0.32334644281172},
+    {1, 1, 0.873281936020439},       {3, 1, -0.436653048526683},
+    {5, 1, 0.286596714529479},       {6, 1, -0.131778331276228},
+    {8, 1, 0.676682064330275e-2},
+}};
+
+/// @brief Backward equation T(p, s) of region 3a
+constexpr std::array<ij_term, 33> region3a_ps = {{
+    {-12, 28, 0.150042008263875e10}, {-12, 32, -0.159397258480424e12},
+    {-10, 4, 0.502181140217975e-3},  {-10, 10, -0.672057767855466e2},
+    {-10, 12, 0.145058545404456e4},  {-10, 14, -0.82388953488889e4},
+    {-8, 5, -0.154852214233853},     {-8, 7, 0.112305046746695e2},
+    {-8, 8, -0.297000213482822e2},   {-8, 28, 0.438565132635495e11},
+    {-6, 2, 0.137837838635464e-2},   {-6, 6, -0.297478527157462e1},
+    {-6, 32, 0.971777947349413e13},  {-5, 0, -0.571527767052398e-4},
+    {-5, 14, 0.28830794977842e5},    {-5, 32, -0.744428289262703e14},
+    {-4, 6, 0.128017324848921e2},    {-4, 10, -0.368275545889071e3},
+    {-4, 36, 0.664768904779177e16},  {-2, 1, 0.44935925195888e-1},
+    {-2, 4, -0.422897836099655e1},   {-1, 1, -0.240614376434179},
+    {-1, 6, -0.474341365254924e1},   {0, 0, 0.72409399912611},
+    {0, 1, 0.923874349695897},       {0, 4, 0.399043655281015e1},
+    {1, 0, 0.384066651868009e-1},    {2, 0, -0.359344365571848e-2},
+    {2, 3, -0.735196448821653},      {3, 2, 0.188367048396131},
+    {8, 0, 0.141064266818704e-3},    {8, 1, -0.257418501496337e-2},
+    {10, 2, 0.123220024851555e-2},
+}};
+
+/// @brief Backward equation T(p, s) of region 3b
+constexpr std::array<ij_term, 28> region3b_ps = {{
+    {-12, 1, 0.52711170160166},    {-12, 3, -0.401317830052742e2},
+    {-12, 4, 0.153020073134484e3}, {-12, 7, -0.224799398218827e4},
+    {-8, 0, -0.193993484669048},   {-8, 1, -0.140467557893768e1},
+    {-8, 3, 0.426799878114024e2},  {-6, 0, 0.752810643416743},
+    {-6, 2, 0.226657238616417e2},  {-6, 4, -0.622873556909932e3},
+    {-5, 0, -0.660823667935396},   {-5, 1, 0.841267087271658},
+    {-5, 2, -0.253717501764397e2}, {-5, 4, 0.485708963532948e3},
+    {-5, 6, 0.880531517490555e3},  {-4, 12, 0.265015592794626e7},
+    {-3, 1, -0.359287150025783},   {-3, 6, -0.656991567673753e3},
+    {-2, 2, 0.241768149185367e1},  {0, 0, 0.856873461222588},
+    {2, 1, 0.655143675313458},     {3, 1, -0.213535213206406},
+    {4, 0, 0.562974957606348e-2},  {5, 24, -0.316955725450471e15},
+    {6, 0, -0.699997000152457e-3}, {8, 3, 0.119845803210767e-1},
+    {12, 1, 0.193848122022095e-4}, {14, 2, -0.215095749182309e-4},
+}};
+/// @brief Coefficients of the saturation-pressure equation
+constexpr std::array<double, 10> sat = {
+    0.11670521452767e4,  -0.72421316703206e6, -0.17073846940092e2,
+    0.12020824702470e5,  -0.32325550322333e7, 0.14915108613530e2,
+    -0.48232657361591e4, 0.40511340542057e6,  -0.23855557567849,
+    0.65017534844798e3};
+
+/// @brief Coefficients of the boundary between regions 2 and 3
+constexpr std::array<double, 5> b23 = {
+    0.34805185628969e3, -0.11671859879975e1, 0.10192970039326e-2,
+    0.57254459862746e3, 0.13918839778870e2};
+
+/// @brief Coefficients of the boundary between regions 2b and 2c
+constexpr std::array<double, 5> b2bc = {
+    0.90584278514723e3, -0.67955786399241, 0.12809002730136e-3,
+    0.26526571908428e4, 0.45257578905948e1};
+
+/// @brief Coefficients of the boundary enthalpy between regions 3a and 3b
+constexpr std::array<double, 4> b3ab = {
+    0.201464004206875e4, 0.374696550136983e1, -0.219921901054187e-1,
+    0.875131686009950e-4};
+
+constexpr double t_min = 273.15;       // Minimum temperature [K]
+constexpr double t_13 = 623.15;        // Boundary of regions 1 and 3 [K]
+constexpr double t_23_max = 863.15;    // Maximum temperature of B23 [K]
+constexpr double t_max = 1073.15;      // Maximum temperature [K]
+constexpr double t_5_max = 2273.15;    // Maximum temperature of region 5
+constexpr double p_max = 100e6;        // Maximum pressure [Pa]
+constexpr double p_5_max = 50e6;       // Maximum pressure of region 5 [Pa]
+constexpr double p_2ab = 4e6;          // Boundary of regions 2a and 2b [Pa]
+constexpr double s_2bc = 5.85e3;       // Boundary of regions 2b and 2c
+constexpr double t_crit = 647.096;     // Critical temperature [K]
+constexpr double p_crit = 22.064e6;    // Critical pressure [Pa]
+constexpr double p_triple = 611.213;   // Triple-point pressure [Pa]
+constexpr double rho_crit = 322.0;     // Critical density [kg/m3]
+constexpr double rho_3_max = 800.0;    // Density above 100 MPa in region 3
+// Boundary of regions 3a and 3b in entropy, the critical entropy [J/kg-K]
+constexpr double s_3ab = 4.41202148223476e3;
+
+/// @brief Reduced Helmholtz energy of region 3 and its derivatives, each
+/// multiplied by the reduced variables of differentiation
+struct region3_terms {
+  double f;   // phi
+  double d;   // delta phi_delta
+  double dd;  // delta^2 phi_delta_delta
+  double t;   // tau phi_tau
+  double tt;  // tau^2 phi_tau_tau
+  double dt;  // delta tau phi_delta_tau
+};
+
+region3_terms region3_helmholtz(double rho, double t) noexcept {
+  const auto delta = rho / rho_crit;
+  const power_table<0, 11> pd(delta);
+  const power_table<0, 26> pt(t_crit / t);
+  region3_terms x = {region3_log * std::log(delta), region3_log,
+                     -region3_log, 0.0, 0.0, 0.0};
+  for (const auto &term : region3) {
+    const auto y = term.n * pd[term.i] * pt[term.j];
+    const auto i = static_cast<double>(term.i);
+    const auto j = static_cast<double>(term.j);
+    x.f += y;
+    x.d += y * i;
+    x.dd += y * i * (i - 1);
+    x.t += y * j;
+    x.tt += y * j * (j - 1);
+    x.dt += y * i * j;
+  }
+  return x;
+}
+
+/// @brief Solves density of region 3 from pressure by Newton's method
+/// @param[in] vapor Whether the root is on the vapor branch below the
+/// critical temperature
+///
+/// The isotherm is concave on the vapor branch and convex on the liquid
+/// branch, so that iterations start from the ideal-gas density or from a
+/// density above the maximum pressure and approach the root monotonically.
+/// Above the critical temperature, bisection safeguards the iterations.
+double region3_density(double p, double t, bool vapor) noexcept {
+  const auto rt = R * t;
+  auto lo = p / rt;
+  auto hi = rho_3_max;
+  if (t < t_crit) {
+    (vapor ? hi : lo) = rho_crit;
+  }
+  auto rho = vapor ? lo : hi;
+  for (int k = 0; k < 100; ++k) {
+    const auto x = region3_helmholtz(rho, t);
+    const auto f = rho * rt * x.d - p;
+    (f < 0 ? lo : hi) = rho;
+    auto next = rho - f / (rt * (2 * x.d + x.dd));
+    if (!(next > lo && next < hi)) {
+      next = (lo + hi) / 2;
+    }
+    if (std::abs(next - rho) <= 1e-13 * rho) {
+      return next;
+    }
+    rho = next;
+  }
+  return rho;
+}
+
+/// @brief Computes properties of region 3 on a branch of density
+if97_properties region3_properties(double p, double t, bool vapor) noexcept {
+  const auto rho = region3_density(p, t, vapor);
+  const auto x = region3_helmholtz(rho, t);
+  const auto rt = R * t;
+  const auto c = x.d - x.dt;
+  const auto b = 2 * x.d + x.dd;
+  return {1 / rho, (x.t + x.d) * rt, (x.t - x.f) * R,
+          (c * c / b - x.tt) * R, std::sqrt(rt * (b - c * c / x.tt))};
+}
+
+double temperature_ph_1(double p, double h) noexcept {
+  const power_table<0, 6> pi(p * 1e-6);
+  const power_table<0, 32> eta(h / 2500e3 + 1);
+  return evaluate(region1_ph, pi, eta);
+}
+
+double temperature_ph_2(double p, double h) noexcept {
+  const auto pi = p * 1e-6;
+  const auto eta = h / 2000e3;
+  if (p <= p_2ab) {
+    return evaluate(region2a_ph, power_table<0, 7>(pi),
+                    power_table<0, 44>(eta - 2.1));
+  }
+  const auto hk = h * 1e-3;
+  const auto pi_bc = b2bc[0] + b2bc[1] * hk + b2bc[2] * hk * hk;
+  if (pi <= pi_bc) {
+    return evaluate(region2b_ph, power_table<0, 9>(pi - 2),
+                    power_table<0, 40>(eta - 2.6));
+  }
+  return evaluate(region2c_ph, power_table<-7, 6>(pi + 25),
+                  power_table<0, 22>(eta - 1.8));
+}
+
+double temperature_ps_1(double p, double s) noexcept {
+  const power_table<0, 6> pi(p * 1e-6);
+  const power_table<0, 32> sigma(s * 1e-3 + 2);
+  return evaluate(region1_ps, pi, sigma);
+}
+
+double temperature_ps_2(double p, double s) noexcept {
+  const auto pi = p * 1e-6;
+  const auto sk = s * 1e-3;
+  if (p <= p_2ab) {
+    // Exponents of pressure are multiples of a quarter
+    return evaluate(region2a_ps, power_table<-6, 6>(std::sqrt(std::sqrt(pi))),
+                    power_table<-27, 18>(sk / 2 - 2));
+  }
+  if (s >= s_2bc) {
+    return evaluate(region2b_ps, power_table<-6, 5>(pi),
+                    power_table<0, 12>(10 - sk / 0.7853));
+  }
+  return evaluate(region2c_ps, power_table<-2, 7>(pi),
+                  power_table<0, 5>(2 - sk / 2.9251));
+}
+
+double temperature_ph_3(double p, double h) noexcept {
+  const auto pi = p * 1e-6;
+  const auto h_3ab = ((b3ab[3] * pi + b3ab[2]) * pi + b3ab[1]) * pi + b3ab[0];
+  if (h <= h_3ab * 1e3) {
+    return 760 * evaluate(region3a_ph, power_table<-12, 12>(pi / 100 + 0.240),
+                          power_table<0, 22>(h / 2300e3 - 0.615));
+  }
+  return 860 * evaluate(region3b_ph, power_table<-12, 8>(pi / 100 + 0.298),
+                        power_table<0, 16>(h / 2800e3 - 0.720));
+}
+
+double temperature_ps_3(double p, double s) noexcept {
+  const auto pi = p * 1e-8;
+  if (s <= s_3ab) {
+    return 760 * evaluate(region3a_ps, power_table<-12, 10>(pi + 0.240),
+                          power_table<0, 36>(s / 4.4e3 - 0.703));
+  }
+  return 860 * evaluate(region3b_ps, power_table<-12, 14>(pi + 0.760),
+                        power_table<0, 24>(s / 5.3e3 - 0.818));
+}
+
+/// @brief Computes temperature by a backward equation of regions 1, 2 and
+/// 3, where the value of the state is enthalpy or entropy
+template <typename Property, typename Liquid, typename Vapor,
+          typename NearCritical>
+double backward_temperature(double p, double x, Property &&property,
+                            Liquid &&liquid, Vapor &&vapor,
+                            NearCritical &&near_critical) noexcept {
+  if (!(p >= p_triple && p <= p_max)) {
+    return nan;
+  }
+  if (p < iapws_if97::saturation_pressure(t_13)) {
+    const auto ts = iapws_if97::saturation_temperature(p);
+    if (x <= property(iapws_if97::liquid_properties(p, ts))) {
+      return liquid(p, x);
+    }
+    if (x >= property(iapws_if97::vapor_properties(p, ts))) {
+      return vapor(p, x);
+    }
+    return ts;
+  }
+  if (x <= property(iapws_if97::liquid_properties(p, t_13))) {
+    return liquid(p, x);
+  }
+  const auto t23 = iapws_if97::boundary23_temperature(p);
+  if (x >= property(iapws_if97::vapor_properties(p, t23))) {
+    return vapor(p, x);
+  }
+  // Two-phase region in region 3
+  if (p < p_crit) {
+    const auto ts = iapws_if97::saturation_temperature(p);
+    if (x > property(region3_properties(p, ts, false)) &&
+        x < property(region3_properties(p, ts, true))) {
+      return ts;
+    }
+  }
+  return near_critical(p, x);
+}
+
+}  // namespace
+
+if97_region iapws_if97::region(double p, double t) noexcept {
+  if (!(p > 0 && t >= t_min)) {
+    return if97_region::out_of_range;
+  }
+  if (t > t_max) {
+    return t <= t_5_max && p <= p_5_max ? if97_region::high_temperature
+                                        : if97_region::out_of_range;
+  }
+  if (p > p_max) {
+    return if97_region::out_of_range;
+  }
+  if (t <= t_13) {
+    return p >= saturation_pressure(t) ? if97_region::liquid
+                                       : if97_region::vapor;
+  }
+  if (t <= t_23_max && p > boundary23_pressure(t)) {
+    return if97_region::near_critical;
+  }
+  return if97_region::vapor;
+}
+
+double iapws_if97::saturation_pressure(double t) noexcept {
+  if (!(t >= t_min && t <= t_crit)) {
+    return nan;
+  }
+  const auto theta = t + sat[8] / (t - sat[9]);
+  const auto a = (theta + sat[0]) * theta + sat[1];
+  const auto b = (sat[2] * theta + sat[3]) * theta + sat[4];
+  const auto c = (sat[5] * theta + sat[6]) * theta + sat[7];
+  const auto x = 2 * c / (-b + std::sqrt(b * b - 4 * a * c));
+  return x * x * x * x * 1e6;
+}
+
+double iapws_if97::saturation_temperature(double p) noexcept {
+  if (!(p >= p_triple && p <= p_crit)) {
+    return nan;
+  }
+  const auto beta = std::sqrt(std::sqrt(p * 1e-6));
+  const auto e = (beta + sat[2]) * beta + sat[5];
+  const auto f = (sat[0] * beta + sat[3]) * beta + sat[6];
+  const auto g = (sat[1] * beta + sat[4]) * beta + sat[7];
+  const auto d = 2 * g / (-f - std::sqrt(f * f - 4 * e * g));
+  const auto x = sat[9] + d;
+  return (x - std::sqrt(x * x - 4 * (sat[8] + sat[9] * d))) / 2;
+}
+
+double iapws_if97::boundary23_pressure(double t) noexcept {
+  return (b23[0] + (b23[1] + b23[2] * t) * t) * 1e6;
+}
+
+double iapws_if97::boundary23_temperature(double p) noexcept {
+  return b23[3] + std::sqrt((p * 1e-6 - b23[4]) / b23[2]);
+}
+
+if97_properties iapws_if97::properties(double p, double t) noexcept {
+  switch (region(p, t)) {
+    case if97_region::liquid:
+      return liquid_properties(p, t);
+    case if97_region::vapor:
+      return vapor_properties(p, t);
+    case if97_region::near_critical:
+      return near_critical_properties(p, t);
+    default:
+      return {nan, nan, nan, nan, nan};
+  }
+}
+
+if97_properties iapws_if97::liquid_properties(double p, double t) noexcept {
+  const auto pi = p / 16.53e6;
+  const auto tau = 1386.0 / t;
+  const auto a = 7.1 - pi;
+  const auto b = tau - 1.222;
+  const power_table<0, 32> pa(a);
+  const power_table<-41, 17> pb(b);
+  const auto ia = 1 / a;
+  const auto ib = 1 / b;
+
+  double g = 0.0, gp = 0.0, gpp = 0.0, gt = 0.0, gtt = 0.0, gpt = 0.0;
+  for (const auto &term : region1) {
+    const auto x = term.n * pa[term.i] * pb[term.j];
+    const auto i = static_cast<double>(term.i);
+    const auto j = static_cast<double>(term.j);
+    g += x;
+    gp -= x * i * ia;
+    gpp += x * i * (i - 1) * ia * ia;
+    gt += x * j * ib;
+    gtt += x * j * (j - 1) * ib * ib;
+    gpt -= x * i * j * ia * ib;
+  }
+
+  const auto rt = R * t;
+  const auto d = gp - tau * gpt;
+  return {pi * gp * rt / p, tau * gt * rt, (tau * gt - g) * R,
+          -tau * tau * gtt * R,
+          std::sqrt(rt * gp * gp / (d * d / (tau * tau * gtt) - gpp))};
+}
+
+if97_properties iapws_if97::vapor_properties(double p, double t) noexcept {
+  const auto pi = p * 1e-6;
+  const auto tau = 540.0 / t;
+  const auto b = tau - 0.5;
+
+  double g0 = std::log(pi), g0t = 0.0, g0tt = 0.0;
+  const power_table<-7, 3> pt(tau);
+  for (const auto &term : region2_ideal) {
+    const auto j = static_cast<double>(term.j);
+    g0 += term.n * pt[term.j];
+    g0t += term.n * j * pt[term.j - 1];
+    g0tt += term.n * j * (j - 1) * pt[term.j - 2];
+  }
+
+  const power_table<0, 24> pp(pi);
+  const power_table<0, 58> pb(b);
+  const auto ip = 1 / pi;
+  const auto ib = 1 / b;
+  double g = 0.0, gp = 0.0, gpp = 0.0, gt = 0.0, gtt = 0.0, gpt = 0.0;
+  for (const auto &term : region2_residual) {
+    const auto x = term.n * pp[term.i] * pb[term.j];
+    const auto i = static_cast<double>(term.i);
+    const auto j = static_cast<double>(term.j);
+    g += x;
+    gp += x * i * ip;
+    gpp += x * i * (i - 1) * ip * ip;
+    gt += x * j * ib;
+    gtt += x * j * (j - 1) * ib * ib;
+    gpt += x * i * j * ip * ib;
+  }
+
+  const auto rt = R * t;
+  const auto ttt = tau * tau * (g0tt + gtt);
+  const auto d = 1 + pi * gp - tau * pi * gpt;
+  const auto w2 = rt * (1 + 2 * pi * gp + pi * pi * gp * gp) /
+                  ((1 - pi * pi * gpp) + d * d / ttt);
+  return {pi * (ip + gp) * rt / p, tau * (g0t + gt) * rt,
+          (tau * (g0t + gt) - (g0 + g)) * R, -ttt * R, std::sqrt(w2)};
+}
+
+if97_properties iapws_if97::near_critical_properties(double p,
+                                                     double t) noexcept {
+  return region3_properties(p, t, t < t_crit && p < saturation_pressure(t));
+}
+
+double iapws_if97::temperature_ph(double p, double h) noexcept {
+  return backward_temperature(
+      p, h, [](const if97_properties &x) { return x.h; }, temperature_ph_1,
+      temperature_ph_2, temperature_ph_3);
+}
+
+double iapws_if97::temperature_ps(double p, double s) noexcept {
+  return backward_temperature(
+      p, s, [](const if97_properties &x) { return x.s; }, temperature_ps_1,
+      temperature_ps_2, temperature_ps_3);
+}
+
+void iapws_if97::saturation_pressure(gsl::span<const double> t,
+                                     gsl::span<double> p) noexcept {
+  assert(t.size() == p.size());
+  for (std::size_t i = 0; i < t.size(); ++i) {
+    p[i] = saturation_pressure(t[i]);
+  }
+}
+
+void iapws_if97::density(gsl::span<const double> p,
+                         gsl::span<const double> t,
+                         gsl::span<double> rho) noexcept {
+  assert(p.size() == t.size() && p.size() == rho.size());
+  for (std::size_t i = 0; i < p.size(); ++i) {
+    rho[i] = 1 / properties(p[i], t[i]).v;
+  }
+}
+
+void iapws_if97::enthalpy(gsl::span<const double> p,
+                          gsl::span<const double> t,
+                          gsl::span<double> h) noexcept {
+  assert(p.size() == t.size() && p.size() == h.size());
+  for (std::size_t i = 0; i < p.size(); ++i) {
+    h[i] = properties(p[i], t[i]).h;
+  }
+}
+
+void iapws_if97::temperature_ph(gsl::span<const double> p,
+                                gsl::span<const double> h,
+                                gsl::span<double> t) noexcept {
+  assert(p.size() == h.size() && p.size() == t.size());
+  for (std::size_t i = 0; i < p.size(); ++i) {
+    t[i] = temperature_ph(p[i], h[i]);
+  }
+}
+
+void iapws_if97::temperature_ps(gsl::span<const double> p,
+                                gsl::span<const double> s,
+                                gsl::span<double> t) noexcept {
+  assert(p.size() == s.size() && p.size() == t.size());
+  for (std::size_t i = 0; i < p.size(); ++i) {
+    t[i] = temperature_ps(p[i], s[i]);
+  }
+}
+
+}  // namespace eos
@@ -0,0 +1,159 @@
+#pragma once
+
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstddef>
+#include <string>
+#include <system_error>
+
+namespace eos {
+
+inline std::system_error make_system_error(const char *what) {
+  return std::system_error(errno, std::generic_category(), what);
+}
+
+/// @brief Owner of a file descriptor
+class file_descriptor {
+ public:
+  file_descriptor() noexcept : fd_{-1} {}
+  explicit file_descriptor(int fd) noexcept : fd_{fd} {}
+
+  file_descriptor(const file_descriptor &) = delete;
+  file_descriptor(file_descriptor &&other) noexcept : fd_{other.fd_} {
+    other.fd_ = -1;
+  }
+
+  ~file_descriptor() {
+    if (fd_ >= 0) {
+      ::close(fd_);
+    }
+  }
+
+  file_descriptor &operator=(const file_descriptor &) = delete;
+  file_descriptor &operator=(file_descriptor &&other) noexcept {
+    if (this != &other) {
+      if (fd_ >= 0) {
+        ::close(fd_);
+      }
+      fd_ = other.fd_;
+      other.fd_ = -1;
+    }
+    return *this;
+  }
+
+  int get() const noexcept { return fd_; }
+
+ private:
+  int fd_;
+};
+
+/// @brief POSIX shared memory mapped to the address space of a process
+///
+/// The creator of shared memory unlinks its name on destruction.
+class shared_memory_wrapper {
+ public:
+  /// @param[in] name Name of shared memory
+  /// @param[in] size Size in bytes, which is ignored if create is false
+  /// @param[in] create True if shared memory is created
+  shared_memory_wrapper(const std::string &name, std::size_t size, bool create)
+      : name_{name}, data_{nullptr}, size_{size}, owner_{create} {
+    const auto flags = create ? O_RDWR | O_CREAT | O_EXCL : O_RDWR;
+    file_descriptor fd(::shm_open(name_.c_str(), flags, 0600));
+    if (fd.get() < 0) {
+      throw make_system_error("Error: shm_open failed!");
+    }
+    if (create) {
+      if (::ftruncate(fd.get(), static_cast<off_t>(size_)) != 0) {
+        const auto e = make_system_error("Error: ftruncate failed!");
+        ::shm_unlink(name_.c_str());
+        throw e;
+      }
+    } else {
+      struct stat st;
+      if (::fstat(fd.get(), &st) != 0) {
+        throw make_system_error("Error: fstat failed!");
+      }
+      size_ = static_cast<std::size_t>(st.st_size);
+    }
+    data_ = ::mmap(nullptr, size_, PROT_READ | PROT_WRITE, MAP_SHARED,
+                   fd.get(), 0);
+    if (data_ == MAP_FAILED) {
+      const auto e = make_system_error("Error: mmap failed!");
+      if (owner_) {
+        ::shm_unlink(name_.c_str());
+      }
+      throw e;
+    }
+  }
+
+  shared_memory_wrapper(const shared_memory_wrapper &) = delete;
+  shared_memory_wrapper &operator=(const shared_memory_wrapper &) = delete;
+
+  ~shared_memory_wrapper() {
+    ::munmap(data_, size_);
+    if (owner_) {
+      ::shm_unlink(name_.c_str());
+    }
+  }
+
+  char *data() const noexcept { return static_cast<char *>(data_); }
+  std::size_t size() const noexcept { return size_; }
+
+ private:
+  std::string name_;
+  void *data_;
+  std::size_t size_;
+  bool owner_;
+};
+
+/// @brief Sends exactly n bytes
+/// @return False if the peer is closed
+inline bool send_all(int fd, const void *buf, std::size_t n) {
+  auto p = static_cast<const char *>(buf);
+  while (n > 0) {
+    const auto k = ::send(fd, p, n, MSG_NOSIGNAL);
+    if (k < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      if (errno == EPIPE || errno == ECONNRESET) {
+        return false;
+      }
+      throw make_system_error("Error: send failed!");
+    }
+    p += k;
+    n -= static_cast<std::size_t>(k);
+  }
+  return true;
+}
+
+/// @brief Receives exactly n bytes
+/// @return False if the peer is closed
+inline bool recv_all(int fd, void *buf, std::size_t n) {
+  auto p = static_cast<char *>(buf);
+  while (n > 0) {
+    const auto k = ::recv(fd, p, n, 0);
+    if (k < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      if (errno == ECONNRESET) {
+        return false;
+      }
+      throw make_system_error("Error: recv failed!");
+    }
+    if (k == 0) {
+      return false;
+    }
+    p += k;
+    n -= static_cast<std::size_t>(k);
+  }
+  return true;
+}
+
+}  // namespace eos
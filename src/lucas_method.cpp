@@ -39,6 +39,23 @@ double lucas_method::viscosity_at_high_pressure(double p,
   return z2 * fp * fq / xi_;
 }
 
+void lucas_method::viscosity_at_low_pressure(
+    gsl::span<const double> t, gsl::span<double> mu) const noexcept {
+  assert(t.size() == mu.size());
+  for (std::size_t i = 0; i < t.size(); ++i) {
+    mu[i] = this->viscosity_at_low_pressure(t[i]);
+  }
+}
+
+void lucas_method::viscosity_at_high_pressure(
+    gsl::span<const double> p, gsl::span<const double> t,
+    gsl::span<double> mu) const noexcept {
+  assert(p.size() == t.size() && p.size() == mu.size());
+  for (std::size_t i = 0; i < p.size(); ++i) {
+    mu[i] = this->viscosity_at_high_pressure(p[i], t[i]);
+  }
+}
+
 double lucas_method::reduced_viscosity_at_high_pressure(double z1, double pr,
                                                         double tr) noexcept {
   using std::exp;
@@ -0,0 +1,247 @@
+#include "eos/server/property_client.hpp"
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <cstring>
+#include <stdexcept>
+
+#include "ipc_wrapper.hpp"
+
+namespace eos {
+
+namespace {
+
+/// @brief Makes a unique name of shared memory
+std::string make_shared_memory_name() {
+  static std::atomic<unsigned> counter{0};
+  return "/eoscpp-" + std::to_string(::getpid()) + "-" +
+         std::to_string(counter++);
+}
+
+file_descriptor connect_to(const std::string &socket_path) {
+  sockaddr_un addr;
+  std::memset(&addr, 0, sizeof(addr));
+  if (socket_path.size() >= sizeof(addr.sun_path)) {
+    throw std::invalid_argument("Error: socket path is too long!");
+  }
+  addr.sun_family = AF_UNIX;
+  std::strcpy(addr.sun_path, socket_path.c_str());
+
+  file_descriptor fd(::socket(AF_UNIX, SOCK_STREAM, 0));
+  if (fd.get() < 0) {
+    throw make_system_error("Error: socket failed!");
+  }
+  if (::connect(fd.get(), reinterpret_cast<sockaddr *>(&addr),
+                sizeof(addr)) != 0) {
+    throw make_system_error("Error: connect failed!");
+  }
+  return fd;
+}
+
+/// @brief Array passed to the server
+struct array_arg {
+  const void *input;   /// Input array, or nullptr for an output
+  void *output;        /// Output array, or nullptr for an input
+  std::size_t stride;  /// Size of an element in bytes
+};
+
+}  // namespace
+
+class property_client::impl {
+ public:
+  impl(const std::string &socket_path, std::size_t buffer_size,
+       std::size_t staging_size)
+      : name_{make_shared_memory_name()},
+        staging_bytes_{staging_size * sizeof(double)},
+        buffer_size_{buffer_size},
+        shm_{name_, staging_bytes_ + buffer_size * sizeof(double), true},
+        fd_{connect_to(socket_path)} {
+    property_request req{};
+    req.type = property_request_type::attach;
+    if (name_.size() >= property_request::max_name_length) {
+      throw std::invalid_argument("Error: shared memory name is too long!");
+    }
+    std::memcpy(req.name, name_.c_str(), name_.size() + 1);
+    this->call(req);
+  }
+
+  std::uint32_t register_fluid(const fluid_params &params) {
+    property_request req{};
+    req.type = property_request_type::register_fluid;
+    req.params = params;
+    return this->call(req).fluid;
+  }
+
+  /// @brief Sends a batch request
+  /// @param[in] req Request without count and offsets
+  /// @param[in] args Arrays of the request
+  /// @param[in] n Number of points
+  ///
+  /// Arrays in the user buffer are passed by offsets, and the others are
+  /// copied through the staging area by chunks.
+  template <std::size_t N>
+  void batch(property_request req, const std::array<array_arg, N> &args,
+             std::size_t n) {
+    static_assert(N <= 4, "Too many arrays");
+    std::array<bool, N> resident;
+    std::size_t staged_stride = 0;
+    for (std::size_t k = 0; k < N; ++k) {
+      const auto p = args[k].input ? args[k].input : args[k].output;
+      resident[k] = this->in_buffer(p, n * args[k].stride);
+      if (!resident[k]) {
+        staged_stride += args[k].stride;
+      }
+    }
+
+    const auto chunk = staged_stride > 0 ? staging_bytes_ / staged_stride : n;
+    if (chunk == 0 && n > 0) {
+      throw std::length_error("Error: staging area is too small!");
+    }
+
+    for (std::size_t i = 0; i < n; i += chunk) {
+      const auto m = std::min(chunk, n - i);
+      std::size_t cursor = 0;
+      for (std::size_t k = 0; k < N; ++k) {
+        const auto s = args[k].stride;
+        if (resident[k]) {
+          const auto p = args[k].input ? args[k].input : args[k].output;
+          req.offset[k] = static_cast<const char *>(p) - shm_.data() + i * s;
+        } else {
+          req.offset[k] = cursor;
+          if (args[k].input) {
+            std::memcpy(shm_.data() + cursor,
+                        static_cast<const char *>(args[k].input) + i * s,
+                        m * s);
+          }
+          cursor += m * s;
+        }
+      }
+
+      req.count = m;
+      this->call(req);
+
+      for (std::size_t k = 0; k < N; ++k) {
+        const auto s = args[k].stride;
+        if (!resident[k] && args[k].output) {
+          std::memcpy(static_cast<char *>(args[k].output) + i * s,
+                      shm_.data() + req.offset[k], m * s);
+        }
+      }
+    }
+  }
+
+  gsl::span<double> buffer() noexcept {
+    return gsl::make_span(
+        reinterpret_cast<double *>(shm_.data() + staging_bytes_),
+        buffer_size_);
+  }
+
+ private:
+  bool in_buffer(const void *p, std::size_t bytes) const noexcept {
+    const auto first = shm_.data() + staging_bytes_;
+    const auto last = shm_.data() + shm_.size();
+    const auto x = static_cast<const char *>(p);
+    return x >= first && x <= last &&
+           bytes <= static_cast<std::size_t>(last - x);
+  }
+
+  property_response call(const property_request &req) {
+    property_response res;
+    if (!send_all(fd_.get(), &req, sizeof(req)) ||
+        !recv_all(fd_.get(), &res, sizeof(res))) {
+      throw std::runtime_error("Error: property server is disconnected!");
+    }
+    switch (res.status) {
+      case property_status::success:
+        return res;
+      case property_status::invalid_fluid:
+        throw std::invalid_argument("Error: invalid fluid ID!");
+      case property_status::out_of_range:
+        throw std::out_of_range("Error: array is out of shared memory!");
+      default:
+        throw std::invalid_argument("Error: invalid request!");
+    }
+  }
+
+  std::string name_;
+  std::size_t staging_bytes_;
+  std::size_t buffer_size_;
+  shared_memory_wrapper shm_;
+  file_descriptor fd_;
+};
+
+property_client::property_client(const std::string &socket_path,
+                                 std::size_t buffer_size,
+                                 std::size_t staging_size)
+    : pimpl_{std::make_unique<impl>(socket_path, buffer_size, staging_size)} {}
+
+property_client::property_client(property_client &&) = default;
+
+property_client::~property_client() = default;
+
+property_client &property_client::operator=(property_client &&) = default;
+
+std::uint32_t property_client::register_fluid(const fluid_params &params) {
+  return pimpl_->register_fluid(params);
+}
+
+void property_client::zfactor(std::uint32_t fluid, gsl::span<const double> p,
+                              gsl::span<const double> t, gsl::span<double> z,
+                              root_selection selection) {
+  assert(p.size() == t.size() && p.size() == z.size());
+  property_request req{};
+  req.type = property_request_type::zfactor;
+  req.fluid = fluid;
+  req.option = static_cast<std::uint32_t>(selection);
+  pimpl_->batch(req,
+                std::array<array_arg, 3>{{{p.data(), nullptr, sizeof(double)},
+                                          {t.data(), nullptr, sizeof(double)},
+                                          {nullptr, z.data(), sizeof(double)}}},
+                p.size());
+}
+
+void property_client::vapor_pressure(std::uint32_t fluid,
+                                     gsl::span<const double> p_init,
+                                     gsl::span<const double> t,
+                                     gsl::span<double> p,
+                                     gsl::span<flash_iteration_result> r) {
+  assert(p_init.size() == t.size() && p_init.size() == p.size() &&
+          p_init.size() == r.size());
+  property_request req{};
+  req.type = property_request_type::vapor_pressure;
+  req.fluid = fluid;
+  pimpl_->batch(
+      req,
+      std::array<array_arg, 4>{
+          {{p_init.data(), nullptr, sizeof(double)},
+           {t.data(), nullptr, sizeof(double)},
+           {nullptr, p.data(), sizeof(double)},
+           {nullptr, r.data(), sizeof(flash_iteration_result)}}},
+      p.size());
+}
+
+void property_client::viscosity(std::uint32_t fluid, gsl::span<const double> p,
+                                gsl::span<const double> t,
+                                gsl::span<double> mu) {
+  assert(p.size() == t.size() && p.size() == mu.size());
+  property_request req{};
+  req.type = property_request_type::viscosity;
+  req.fluid = fluid;
+  pimpl_->batch(
+      req,
+      std::array<array_arg, 3>{{{p.data(), nullptr, sizeof(double)},
+                                {t.data(), nullptr, sizeof(double)},
+                                {nullptr, mu.data(), sizeof(double)}}},
+      p.size());
+}
+
+gsl::span<double> property_client::buffer() noexcept {
+  return pimpl_->buffer();
+}
+
+}  // namespace eos
@@ -0,0 +1,331 @@
+#include "eos/server/property_server.hpp"
+
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <deque>
+#include <exception>
+#include <list>
+#include <mutex>
+#include <shared_mutex>
+#include <stdexcept>
+#include <thread>
+#include <variant>
+#include <vector>
+
+#include "eos/cubic_eos/peng_robinson_eos.hpp"
+#include "eos/cubic_eos/soave_redlich_kwong_eos.hpp"
+#include "eos/cubic_eos/vapor_liquid_flash.hpp"
+#include "eos/viscosity/lucas_method.hpp"
+#include "ipc_wrapper.hpp"
+
+namespace eos {
+
+namespace {
+
+template <typename Eos>
+struct cubic_model {
+  Eos eos;
+  vapor_liquid_flash<Eos> flash;
+};
+
+template <typename Eos>
+cubic_model<Eos> make_cubic_model(const fluid_params &x) {
+  const Eos eos(x.pc, x.tc, x.omega);
+  return {eos, vapor_liquid_flash<Eos>(eos)};
+}
+
+struct fluid_model {
+  fluid_params params;
+  std::variant<cubic_model<soave_redlich_kwong_eos>,
+               cubic_model<peng_robinson_eos>>
+      cubic;
+  lucas_method viscosity;
+};
+
+bool is_same_fluid(const fluid_params &x, const fluid_params &y) noexcept {
+  return x.eos == y.eos && x.pc == y.pc && x.tc == y.tc &&
+         x.omega == y.omega && x.zc == y.zc && x.mw == y.mw && x.dm == y.dm &&
+         x.q == y.q;
+}
+
+struct connection {
+  file_descriptor fd;
+  std::unique_ptr<shared_memory_wrapper> shm;
+};
+
+/// @brief Returns an array in the shared memory of a client
+/// @return False if the array is out of the shared memory
+template <typename T>
+bool map_array(const connection &c, std::uint64_t offset, std::uint64_t count,
+               gsl::span<T> &x) noexcept {
+  const auto size = c.shm->size();
+  if (offset % alignof(T) != 0 || offset > size ||
+      count > (size - offset) / sizeof(T)) {
+    return false;
+  }
+  x = gsl::make_span(reinterpret_cast<T *>(c.shm->data() + offset),
+                     static_cast<std::size_t>(count));
+  return true;
+}
+
+}  // namespace
+
+class property_server::impl {
+ public:
+  impl(const std::string &socket_path) : path_{socket_path} {
+    sockaddr_un addr;
+    std::memset(&addr, 0, sizeof(addr));
+    if (path_.size() >= sizeof(addr.sun_path)) {
+      throw std::invalid_argument("Error: socket path is too long!");
+    }
+    addr.sun_family = AF_UNIX;
+    std::strcpy(addr.sun_path, path_.c_str());
+
+    listener_ = file_descriptor(::socket(AF_UNIX, SOCK_STREAM, 0));
+    if (listener_.get() < 0) {
+      throw make_system_error("Error: socket failed!");
+    }
+    // Removes a socket left by a server which was not shut down cleanly
+    ::unlink(path_.c_str());
+    if (::bind(listener_.get(), reinterpret_cast<sockaddr *>(&addr),
+               sizeof(addr)) != 0) {
+      throw make_system_error("Error: bind failed!");
+    }
+    if (::listen(listener_.get(), SOMAXCONN) != 0) {
+      throw make_system_error("Error: listen failed!");
+    }
+  }
+
+  ~impl() {
+    stopping_ = true;
+    for (auto &w : workers_) {
+      w.thread.join();
+    }
+    ::unlink(path_.c_str());
+  }
+
+  /// @brief Accepts a connection and starts its worker
+  /// @param[in] timeout Timeout in milliseconds
+  void poll(int timeout) {
+    // Joins workers of closed connections
+    for (auto it = workers_.begin(); it != workers_.end();) {
+      if (it->done) {
+        it->thread.join();
+        it = workers_.erase(it);
+      } else {
+        ++it;
+      }
+    }
+
+    pollfd fds = {listener_.get(), POLLIN, 0};
+    if (::poll(&fds, 1, timeout) < 0) {
+      if (errno == EINTR) {
+        return;
+      }
+      throw make_system_error("Error: poll failed!");
+    }
+
+    if (fds.revents & POLLIN) {
+      file_descriptor fd(::accept(listener_.get(), nullptr, nullptr));
+      if (fd.get() >= 0) {
+        auto &w = workers_.emplace_back();
+        w.thread = std::thread(
+            [this, &w, fd = std::move(fd)]() mutable {
+              this->serve(std::move(fd));
+              w.done = true;
+            });
+      }
+    }
+  }
+
+  std::size_t num_fluids() const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    return fluids_.size();
+  }
+
+ private:
+  /// @brief Worker serving a connection
+  struct worker {
+    std::thread thread;
+    std::atomic<bool> done{false};
+  };
+
+  /// @brief Serves requests of a connection until it is closed
+  ///
+  /// A request is received in pieces as they arrive, so that a stalled
+  /// client never blocks the server from being stopped.
+  void serve(file_descriptor fd) noexcept {
+    connection c{std::move(fd), nullptr};
+    property_request req;
+    std::size_t received = 0;
+    pollfd fds = {c.fd.get(), POLLIN, 0};
+    try {
+      while (!stopping_) {
+        const auto n = ::poll(&fds, 1, 100);
+        if (n == 0 || (n < 0 && errno == EINTR)) {
+          continue;
+        }
+        if (n < 0) {
+          return;
+        }
+        const auto k =
+            ::recv(c.fd.get(), reinterpret_cast<char *>(&req) + received,
+                   sizeof(req) - received, MSG_DONTWAIT);
+        if (k < 0 && (errno == EINTR || errno == EAGAIN)) {
+          continue;
+        }
+        if (k <= 0) {
+          return;
+        }
+        received += static_cast<std::size_t>(k);
+        if (received < sizeof(req)) {
+          continue;
+        }
+        received = 0;
+        const auto res = this->process(c, req);
+        if (!send_all(c.fd.get(), &res, sizeof(res))) {
+          return;
+        }
+      }
+    } catch (const std::exception &) {
+      // Closes the connection
+    }
+  }
+
+  property_response process(connection &c, const property_request &req) {
+    if (req.type == property_request_type::attach) {
+      const auto end = req.name + property_request::max_name_length;
+      if (c.shm || std::find(req.name, end, '\0') == end) {
+        return {property_status::invalid_request, 0};
+      }
+      try {
+        c.shm = std::make_unique<shared_memory_wrapper>(req.name, 0, false);
+      } catch (const std::system_error &) {
+        return {property_status::invalid_request, 0};
+      }
+      return {property_status::success, 0};
+    }
+
+    if (req.type == property_request_type::register_fluid) {
+      return this->register_fluid(req.params);
+    }
+
+    if (!c.shm) {
+      return {property_status::invalid_request, 0};
+    }
+    const auto fluid_ptr = this->find_fluid(req.fluid);
+    if (!fluid_ptr) {
+      return {property_status::invalid_fluid, req.fluid};
+    }
+    const auto &fluid = *fluid_ptr;
+    const auto n = req.count;
+
+    switch (req.type) {
+      case property_request_type::zfactor: {
+        gsl::span<const double> p, t;
+        gsl::span<double> z;
+        if (req.option > static_cast<std::uint32_t>(root_selection::stable)) {
+          return {property_status::invalid_request, req.fluid};
+        }
+        if (!(map_array(c, req.offset[0], n, p) &&
+              map_array(c, req.offset[1], n, t) &&
+              map_array(c, req.offset[2], n, z))) {
+          return {property_status::out_of_range, req.fluid};
+        }
+        const auto selection = static_cast<root_selection>(req.option);
+        std::visit([&](const auto &m) { m.eos.zfactor(p, t, z, selection); },
+                   fluid.cubic);
+        return {property_status::success, req.fluid};
+      }
+      case property_request_type::vapor_pressure: {
+        gsl::span<const double> p_init, t;
+        gsl::span<double> p;
+        gsl::span<flash_iteration_result> r;
+        if (!(map_array(c, req.offset[0], n, p_init) &&
+              map_array(c, req.offset[1], n, t) &&
+              map_array(c, req.offset[2], n, p) &&
+              map_array(c, req.offset[3], n, r))) {
+          return {property_status::out_of_range, req.fluid};
+        }
+        std::visit(
+            [&](const auto &m) { m.flash.vapor_pressure(p_init, t, p, r); },
+            fluid.cubic);
+        return {property_status::success, req.fluid};
+      }
+      case property_request_type::viscosity: {
+        gsl::span<const double> p, t;
+        gsl::span<double> mu;
+        if (!(map_array(c, req.offset[0], n, p) &&
+              map_array(c, req.offset[1], n, t) &&
+              map_array(c, req.offset[2], n, mu))) {
+          return {property_status::out_of_range, req.fluid};
+        }
+        fluid.viscosity.viscosity_at_high_pressure(p, t, mu);
+        return {property_status::success, req.fluid};
+      }
+      default:
+        return {property_status::invalid_request, req.fluid};
+    }
+  }
+
+  /// @brief Returns a registered fluid, or nullptr if not found
+  ///
+  /// Elements of std::deque stay in place while fluids are appended.
+  const fluid_model *find_fluid(std::uint32_t id) const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    return id < fluids_.size() ? &fluids_[id] : nullptr;
+  }
+
+  property_response register_fluid(const fluid_params &x) {
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    for (std::size_t i = 0; i < fluids_.size(); ++i) {
+      if (is_same_fluid(fluids_[i].params, x)) {
+        return {property_status::success, static_cast<std::uint32_t>(i)};
+      }
+    }
+
+    fluid_model fluid{x, {}, {x.pc, x.tc, x.zc, x.mw, x.dm, x.q}};
+    switch (x.eos) {
+      case served_eos::soave_redlich_kwong:
+        fluid.cubic = make_cubic_model<soave_redlich_kwong_eos>(x);
+        break;
+      case served_eos::peng_robinson:
+        fluid.cubic = make_cubic_model<peng_robinson_eos>(x);
+        break;
+      default:
+        return {property_status::invalid_request, 0};
+    }
+    fluids_.push_back(std::move(fluid));
+    return {property_status::success,
+            static_cast<std::uint32_t>(fluids_.size() - 1)};
+  }
+
+  std::string path_;
+  file_descriptor listener_;
+  std::list<worker> workers_;
+  std::deque<fluid_model> fluids_;
+  mutable std::shared_mutex mutex_;  /// Guards fluids_
+  std::atomic<bool> stopping_{false};
+};
+
+property_server::property_server(const std::string &socket_path)
+    : pimpl_{std::make_unique<impl>(socket_path)}, running_{true} {}
+
+property_server::~property_server() = default;
+
+void property_server::run() {
+  while (running_) {
+    pimpl_->poll(100);
+  }
+}
+
+std::size_t property_server::num_fluids() const noexcept {
+  return pimpl_->num_fluids();
+}
+
+}  // namespace eos
@@ -0,0 +1,555 @@
+#include "eos/table/property_table.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstring>
+#include <istream>
+#include <limits>
+#include <ostream>
+#include <stdexcept>
+#include <tuple>
+
+namespace eos {
+
+namespace {
+
+template <typename T>
+T load(const std::uint8_t *p) noexcept {
+  T x;
+  std::memcpy(&x, p, sizeof(T));
+  return x;
+}
+
+template <typename T>
+void store(std::uint8_t *p, T x) noexcept {
+  std::memcpy(p, &x, sizeof(T));
+}
+
+/// @brief Normalizes values of a block into [0, 1]
+property_table::block_params normalize(const double *v,
+                                       std::size_t n) noexcept {
+  const auto [lo, hi] = std::minmax_element(v, v + n);
+  return {*lo, *hi - *lo};
+}
+
+double normalized(double v, const property_table::block_params &bp) noexcept {
+  return bp.scale > 0 ? (v - bp.offset) / bp.scale : 0.0;
+}
+
+struct float64_codec {
+  static constexpr std::size_t bytes = sizeof(double);
+
+  static property_table::block_params encode(const double *v, std::size_t n,
+                                             std::uint8_t *out) noexcept {
+    for (std::size_t k = 0; k < n; ++k) {
+      store(out + k * bytes, v[k]);
+    }
+    return {0.0, 1.0};
+  }
+
+  static double decode(const std::uint8_t *in,
+                       const property_table::block_params &,
+                       std::size_t k) noexcept {
+    return load<double>(in + k * bytes);
+  }
+};
+
+struct float32_codec {
+  static constexpr std::size_t bytes = sizeof(float);
+
+  static property_table::block_params encode(const double *v, std::size_t n,
+                                             std::uint8_t *out) noexcept {
+    for (std::size_t k = 0; k < n; ++k) {
+      store(out + k * bytes, static_cast<float>(v[k]));
+    }
+    return {0.0, 1.0};
+  }
+
+  static double decode(const std::uint8_t *in,
+                       const property_table::block_params &,
+                       std::size_t k) noexcept {
+    return load<float>(in + k * bytes);
+  }
+};
+
+struct bfloat16_codec {
+  static constexpr std::size_t bytes = sizeof(std::uint16_t);
+
+  static property_table::block_params encode(const double *v, std::size_t n,
+                                             std::uint8_t *out) noexcept {
+    const auto bp = normalize(v, n);
+    for (std::size_t k = 0; k < n; ++k) {
+      const auto f = static_cast<float>(normalized(v[k], bp));
+      std::uint32_t x;
+      std::memcpy(&x, &f, sizeof(x));
+      // Rounds to the nearest even
+      store(out + k * bytes,
+            static_cast<std::uint16_t>((x + 0x7fff + ((x >> 16) & 1)) >> 16));
+    }
+    return bp;
+  }
+
+  static double decode(const std::uint8_t *in,
+                       const property_table::block_params &bp,
+                       std::size_t k) noexcept {
+    const std::uint32_t x = load<std::uint16_t>(in + k * bytes);
+    float f;
+    const auto bits = x << 16;
+    std::memcpy(&f, &bits, sizeof(f));
+    return bp.offset + bp.scale * f;
+  }
+};
+
+struct float16_codec {
+  static constexpr std::size_t bytes = sizeof(std::uint16_t);
+
+  /// @brief Converts a float in [0, 1] to half precision rounding to the
+  /// nearest even
+  static std::uint16_t to_half(float f) noexcept {
+    std::uint32_t x;
+    std::memcpy(&x, &f, sizeof(x));
+    if (x < 0x38800000) {
+      // Subnormal half
+      return static_cast<std::uint16_t>(std::nearbyint(f * 0x1p24f));
+    }
+    x -= 0x38000000;  // Rebias the exponent from 127 to 15
+    x += 0x0fff + ((x >> 13) & 1);
+    return static_cast<std::uint16_t>(x >> 13);
+  }
+
+  static property_table::block_params encode(const double *v, std::size_t n,
+                                             std::uint8_t *out) noexcept {
+    const auto bp = normalize(v, n);
+    for (std::size_t k = 0; k < n; ++k) {
+      store(out + k * bytes,
+            to_half(static_cast<float>(normalized(v[k], bp))));
+    }
+    return bp;
+  }
+
+  static double decode(const std::uint8_t *in,
+                       const property_table::block_params &bp,
+                       std::size_t k) noexcept {
+    // Shifts the exponent and mantissa into a float and rebiases the
+    // exponent by multiplication, which also handles subnormal halves
+    const std::uint32_t bits = (load<std::uint16_t>(in + k * bytes) & 0x7fff)
+                               << 13;
+    float f;
+    std::memcpy(&f, &bits, sizeof(f));
+    return bp.offset + bp.scale * (f * 0x1p112f);
+  }
+};
+
+struct delta8_codec {
+  static constexpr std::size_t bytes = sizeof(std::int8_t);
+
+  static property_table::block_params encode(const double *v, std::size_t n,
+                                             std::uint8_t *out) noexcept {
+    double max_delta = 0.0;
+    for (std::size_t k = 1; k < n; ++k) {
+      max_delta = std::max(max_delta, std::fabs(v[k] - v[k - 1]));
+    }
+    // The error of reconstruction is at most half the step, and a quantized
+    // difference including it fits in [-127, 127]
+    const property_table::block_params bp = {v[0], max_delta / 126.5};
+    store(out, std::int8_t{0});
+    long sum = 0;
+    for (std::size_t k = 1; k < n; ++k) {
+      long q = 0;
+      if (bp.scale > 0) {
+        const auto r = bp.offset + bp.scale * static_cast<double>(sum);
+        q = std::clamp(std::lround((v[k] - r) / bp.scale), -127L, 127L);
+      }
+      sum += q;
+      store(out + k * bytes, static_cast<std::int8_t>(q));
+    }
+    return bp;
+  }
+
+  /// @param[in] anchors Running sums at every anchor_interval-th element of
+  /// the block
+  static double decode(const std::uint8_t *in,
+                       const property_table::block_params &bp,
+                       const std::int16_t *anchors, std::size_t k) noexcept {
+    return bp.offset + bp.scale * static_cast<double>(sum(in, anchors, k));
+  }
+
+  /// @brief Returns the sum of quantized differences up to the k-th element
+  static int sum(const std::uint8_t *in, const std::int16_t *anchors,
+                 std::size_t k) noexcept {
+    // Adds the anchor_interval - 1 differences after the anchor masked by
+    // the position, so that the loop has a fixed trip count without branches
+    const auto first = k / property_table::anchor_interval *
+                       property_table::anchor_interval;
+    int sum = anchors[k / property_table::anchor_interval];
+    for (std::size_t r = 1; r < property_table::anchor_interval; ++r) {
+      // Clamped to stay within the block
+      const auto m = std::min(first + r, k);
+      sum += static_cast<int>(first + r <= k) * load<std::int8_t>(in + m);
+    }
+    return sum;
+  }
+};
+
+std::size_t anchors_per_block(std::size_t block_size) noexcept {
+  return (block_size + property_table::anchor_interval - 1) /
+         property_table::anchor_interval;
+}
+
+/// @brief Read-only view of a table for a codec
+template <typename Codec>
+class table_view {
+ public:
+  table_view(const property_table_header &h,
+             const property_table::block_params *blocks,
+             const std::uint8_t *data, const std::int16_t *anchors) noexcept
+      : h_{h},
+        blocks_{blocks},
+        data_{data},
+        anchors_{anchors},
+        blocks_per_row_{(h.x.size + h.block_size - 1) / h.block_size},
+        anchors_per_block_{anchors_per_block(h.block_size)} {}
+
+  double value(std::size_t i, std::size_t j) const noexcept {
+    const auto b = i / h_.block_size;
+    const auto first = b * h_.block_size;
+    const auto block = j * blocks_per_row_ + b;
+    const auto in = data_ + (j * h_.x.size + first) * Codec::bytes;
+    if constexpr (std::is_same_v<Codec, delta8_codec>) {
+      return Codec::decode(in, blocks_[block],
+                           anchors_ + block * anchors_per_block_, i - first);
+    } else {
+      return Codec::decode(in, blocks_[block], i - first);
+    }
+  }
+
+  /// @brief Decodes the values at (i, j) and (i + 1, j)
+  std::pair<double, double> segment(std::size_t i, std::size_t j) const
+      noexcept {
+    if constexpr (std::is_same_v<Codec, delta8_codec>) {
+      // The second value adds one difference to the sum of the first unless
+      // it starts the next block
+      const auto b = i / h_.block_size;
+      const auto k = i - b * h_.block_size;
+      if (k + 1 < h_.block_size) {
+        const auto block = j * blocks_per_row_ + b;
+        const auto in = data_ + j * h_.x.size + b * h_.block_size;
+        const auto &bp = blocks_[block];
+        const auto sum =
+            Codec::sum(in, anchors_ + block * anchors_per_block_, k);
+        const auto next = sum + load<std::int8_t>(in + k + 1);
+        return {bp.offset + bp.scale * static_cast<double>(sum),
+                bp.offset + bp.scale * static_cast<double>(next)};
+      }
+    }
+    return {this->value(i, j), this->value(i + 1, j)};
+  }
+
+  double interpolate(double x, double y) const noexcept {
+    double i, wx, j, wy;
+    locate(h_.x, x, i, wx);
+    locate(h_.y, y, j, wy);
+    return this->blend(static_cast<std::size_t>(i),
+                       static_cast<std::size_t>(j), wx, wy);
+  }
+
+  /// Number of points of a tile of interpolate(x, y, value, n)
+  static constexpr std::size_t tile_size = 64;
+
+  /// @brief Interpolates at up to tile_size points
+  ///
+  /// Cells and weights of the points, and the bilinear interpolation, are
+  /// computed by branch-free loops, which are vectorized. Only the nodes are
+  /// decoded point by point, since they are gathered from blocks which
+  /// differ from point to point.
+  void interpolate(const double *x, const double *y, double *value,
+                   std::size_t n) const noexcept {
+    assert(n <= tile_size);
+    double i[tile_size], wx[tile_size], j[tile_size], wy[tile_size];
+    for (std::size_t k = 0; k < n; ++k) {
+      locate(h_.x, x[k], i[k], wx[k]);
+      locate(h_.y, y[k], j[k], wy[k]);
+    }
+    double v00[tile_size], v10[tile_size], v01[tile_size], v11[tile_size];
+    for (std::size_t k = 0; k < n; ++k) {
+      const auto ik = static_cast<std::size_t>(i[k]);
+      const auto jk = static_cast<std::size_t>(j[k]);
+      std::tie(v00[k], v10[k]) = this->segment(ik, jk);
+      std::tie(v01[k], v11[k]) = this->segment(ik, jk + 1);
+    }
+    for (std::size_t k = 0; k < n; ++k) {
+      const auto v0 = v00[k] + wx[k] * (v10[k] - v00[k]);
+      const auto v1 = v01[k] + wx[k] * (v11[k] - v01[k]);
+      value[k] = v0 + wy[k] * (v1 - v0);
+    }
+  }
+
+ private:
+  /// @brief Computes the index of a cell and the weight in the cell
+  /// @param[in] a Axis
+  /// @param[in] x Coordinate
+  /// @param[out] i Index of the cell, which is zero if x is not finite
+  /// @param[out] w Weight in the cell, which is NaN if x is not finite so
+  /// that the interpolated value is NaN
+  ///
+  /// The index is kept in double so that the loop over points is
+  /// vectorized, and is exact below 2^53 nodes.
+  static void locate(const table_axis &a, double x, double &i,
+                     double &w) noexcept {
+    constexpr auto max_double = std::numeric_limits<double>::max();
+    constexpr auto nan = std::numeric_limits<double>::quiet_NaN();
+    const auto s = (x - a.first) / a.step;
+    const auto finite = std::fabs(s) <= max_double;
+    const auto n = static_cast<double>(a.size - 2);
+    i = std::min(std::max(std::floor(finite ? s : 0.0), 0.0), n);
+    w = finite ? s - i : nan;
+  }
+
+  /// @brief Interpolates in the cell (i, j) by weights
+  double blend(std::size_t i, std::size_t j, double wx, double wy) const
+      noexcept {
+    const auto [v00, v10] = this->segment(i, j);
+    const auto [v01, v11] = this->segment(i, j + 1);
+    const auto v0 = v00 + wx * (v10 - v00);
+    const auto v1 = v01 + wx * (v11 - v01);
+    return v0 + wy * (v1 - v0);
+  }
+
+  const property_table_header &h_;
+  const property_table::block_params *blocks_;
+  const std::uint8_t *data_;
+  const std::int16_t *anchors_;
+  std::size_t blocks_per_row_;
+  std::size_t anchors_per_block_;
+};
+
+std::size_t element_bytes(table_encoding encoding) noexcept {
+  switch (encoding) {
+    case table_encoding::float64:
+      return float64_codec::bytes;
+    case table_encoding::float32:
+      return float32_codec::bytes;
+    case table_encoding::bfloat16:
+      return bfloat16_codec::bytes;
+    case table_encoding::float16:
+      return float16_codec::bytes;
+    default:
+      return delta8_codec::bytes;
+  }
+}
+
+/// @brief Calls a function with the codec of an encoding
+template <typename Function>
+decltype(auto) visit_codec(table_encoding encoding, Function &&f) {
+  switch (encoding) {
+    case table_encoding::float64:
+      return f(float64_codec{});
+    case table_encoding::float32:
+      return f(float32_codec{});
+    case table_encoding::bfloat16:
+      return f(bfloat16_codec{});
+    case table_encoding::float16:
+      return f(float16_codec{});
+    default:
+      return f(delta8_codec{});
+  }
+}
+
+constexpr char magic[8] = {'E', 'O', 'S', 'T', 'B', 'L', '0', '1'};
+
+}  // namespace
+
+property_table::property_table(table_encoding encoding, const table_axis &x,
+                               const table_axis &y,
+                               gsl::span<const double> values,
+                               std::size_t block_size)
+    : header_{encoding, x, y, block_size, 0.0, 0.0} {
+  if (x.size < 2 || y.size < 2 || block_size == 0) {
+    throw std::invalid_argument("Error: table needs at least 2x2 nodes!");
+  }
+  if (values.size() != x.size * y.size) {
+    throw std::invalid_argument("Error: size of values does not match axes!");
+  }
+  if (encoding == table_encoding::delta8 && block_size > 256) {
+    throw std::invalid_argument("Error: block size of delta8 exceeds 256!");
+  }
+
+  const auto blocks_per_row = (x.size + block_size - 1) / block_size;
+  blocks_.resize(blocks_per_row * y.size);
+  data_.resize(values.size() * element_bytes(encoding));
+  visit_codec(encoding, [&](auto codec) {
+    using codec_type = decltype(codec);
+    for (std::size_t j = 0; j < y.size; ++j) {
+      for (std::size_t b = 0; b < blocks_per_row; ++b) {
+        const auto first = j * x.size + b * block_size;
+        const auto n = std::min(block_size, x.size - b * block_size);
+        blocks_[j * blocks_per_row + b] = codec_type::encode(
+            &values[first], n, data_.data() + first * codec_type::bytes);
+      }
+    }
+  });
+  this->build_anchors();
+
+  for (std::size_t j = 0; j < y.size; ++j) {
+    for (std::size_t i = 0; i < x.size; ++i) {
+      const auto v = values[j * x.size + i];
+      const auto e = std::fabs(this->value(i, j) - v);
+      header_.max_abs_error = std::max(header_.max_abs_error, e);
+      if (v != 0) {
+        header_.max_rel_error =
+            std::max(header_.max_rel_error, e / std::fabs(v));
+      }
+    }
+  }
+}
+
+double property_table::interpolate(double x, double y) const noexcept {
+  return visit_codec(header_.encoding, [&](auto codec) {
+    return table_view<decltype(codec)>(header_, blocks_.data(), data_.data(),
+                                       anchors_.data())
+        .interpolate(x, y);
+  });
+}
+
+void property_table::interpolate(gsl::span<const double> x,
+                                 gsl::span<const double> y,
+                                 gsl::span<double> value) const noexcept {
+  assert(x.size() == y.size() && x.size() == value.size());
+  // Dispatches once per batch so that decoding is inlined into the loop
+  visit_codec(header_.encoding, [&](auto codec) {
+    using view_type = table_view<decltype(codec)>;
+    const view_type view(header_, blocks_.data(), data_.data(),
+                         anchors_.data());
+    for (std::size_t k = 0; k < x.size(); k += view_type::tile_size) {
+      const auto n = std::min(view_type::tile_size, x.size() - k);
+      view.interpolate(&x[k], &y[k], &value[k], n);
+    }
+  });
+}
+
+double property_table::value(std::size_t i, std::size_t j) const noexcept {
+  assert(i < header_.x.size && j < header_.y.size);
+  return visit_codec(header_.encoding, [&](auto codec) {
+    return table_view<decltype(codec)>(header_, blocks_.data(), data_.data(),
+                                       anchors_.data())
+        .value(i, j);
+  });
+}
+
+std::size_t property_table::storage_bytes() const noexcept {
+  return data_.size() + blocks_.size() * sizeof(block_params) +
+         anchors_.size() * sizeof(std::int16_t);
+}
+
+void property_table::build_anchors() {
+  anchors_.clear();
+  if (header_.encoding != table_encoding::delta8) {
+    return;
+  }
+  const auto &h = header_;
+  const auto blocks_per_row = (h.x.size + h.block_size - 1) / h.block_size;
+  const auto n_anchors = anchors_per_block(h.block_size);
+  anchors_.resize(blocks_.size() * n_anchors);
+  for (std::size_t j = 0; j < h.y.size; ++j) {
+    for (std::size_t b = 0; b < blocks_per_row; ++b) {
+      const auto first = b * h.block_size;
+      const auto n = std::min(h.block_size, h.x.size - first);
+      const auto in = data_.data() + j * h.x.size + first;
+      auto anchor = anchors_.data() + (j * blocks_per_row + b) * n_anchors;
+      int sum = 0;
+      for (std::size_t k = 0; k < n; ++k) {
+        if (k > 0) {
+          sum += load<std::int8_t>(in + k);
+        }
+        if (k % anchor_interval == 0) {
+          anchor[k / anchor_interval] = static_cast<std::int16_t>(sum);
+        }
+      }
+    }
+  }
+}
+
+void property_table::write(std::ostream &os) const {
+  const auto write_u64 = [&os](std::uint64_t x) {
+    os.write(reinterpret_cast<const char *>(&x), sizeof(x));
+  };
+  const auto write_f64 = [&os](double x) {
+    os.write(reinterpret_cast<const char *>(&x), sizeof(x));
+  };
+  os.write(magic, sizeof(magic));
+  write_u64(static_cast<std::uint64_t>(header_.encoding));
+  for (const auto &a : {header_.x, header_.y}) {
+    write_f64(a.first);
+    write_f64(a.step);
+    write_u64(a.size);
+  }
+  write_u64(header_.block_size);
+  write_f64(header_.max_abs_error);
+  write_f64(header_.max_rel_error);
+  for (const auto &bp : blocks_) {
+    write_f64(bp.offset);
+    write_f64(bp.scale);
+  }
+  os.write(reinterpret_cast<const char *>(data_.data()),
+           static_cast<std::streamsize>(data_.size()));
+  if (!os) {
+    throw std::runtime_error("Error: failed to write property table!");
+  }
+}
+
+property_table property_table::read(std::istream &is) {
+  const auto read_u64 = [&is] {
+    std::uint64_t x = 0;
+    is.read(reinterpret_cast<char *>(&x), sizeof(x));
+    return x;
+  };
+  const auto read_f64 = [&is] {
+    double x = 0.0;
+    is.read(reinterpret_cast<char *>(&x), sizeof(x));
+    return x;
+  };
+
+  char m[sizeof(magic)];
+  is.read(m, sizeof(m));
+  if (!is || std::memcmp(m, magic, sizeof(magic)) != 0) {
+    throw std::runtime_error("Error: not a property table!");
+  }
+
+  property_table table;
+  auto &h = table.header_;
+  const auto encoding = read_u64();
+  if (encoding > static_cast<std::uint64_t>(table_encoding::delta8)) {
+    throw std::runtime_error("Error: unknown encoding of property table!");
+  }
+  h.encoding = static_cast<table_encoding>(encoding);
+  for (auto a : {&h.x, &h.y}) {
+    a->first = read_f64();
+    a->step = read_f64();
+    a->size = read_u64();
+  }
+  h.block_size = read_u64();
+  h.max_abs_error = read_f64();
+  h.max_rel_error = read_f64();
+  if (!is || h.x.size < 2 || h.y.size < 2 || h.block_size == 0 ||
+      (h.encoding == table_encoding::delta8 && h.block_size > 256)) {
+    throw std::runtime_error("Error: invalid header of property table!");
+  }
+
+  const auto blocks_per_row = (h.x.size + h.block_size - 1) / h.block_size;
+  table.blocks_.resize(blocks_per_row * h.y.size);
+  for (auto &bp : table.blocks_) {
+    bp.offset = read_f64();
+    bp.scale = read_f64();
+  }
+  table.data_.resize(h.x.size * h.y.size * element_bytes(h.encoding));
+  is.read(reinterpret_cast<char *>(table.data_.data()),
+          static_cast<std::streamsize>(table.data_.size()));
+  if (!is) {
+    throw std::runtime_error("Error: property table is truncated!");
+  }
+  table.build_anchors();
+  return table;
+}
+
+}  // namespace eos
@@ -0,0 +1,69 @@
+#include "eos/math/quartic_equation.hpp"
+
+#include <gsl/gsl_poly.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace eos {
+
+std::size_t quartic_equation::real_roots(std::array<double, 4>& x) const
+    noexcept {
+  // Depressed quartic y^4 + p y^2 + q y + r = 0 where x = y - a / 4
+  const auto a2 = this->a * this->a;
+  const auto p = this->b - 3.0 / 8.0 * a2;
+  const auto q = this->c - this->a * this->b / 2 + a2 * this->a / 8;
+  const auto r = this->d - this->a * this->c / 4 + a2 * this->b / 16 -
+                 3.0 / 256.0 * a2 * a2;
+  const auto shift = -this->a / 4;
+
+  int n = 0;
+  const auto scale = std::max({std::fabs(p), std::sqrt(std::fabs(r)), 1.0});
+  if (std::fabs(q) < 1e-14 * scale * scale) {
+    // Biquadratic equation
+    double y2[2];
+    const auto m = gsl_poly_solve_quadratic(1.0, p, r, &y2[0], &y2[1]);
+    for (int i = 0; i < m; ++i) {
+      if (y2[i] >= 0) {
+        const auto y = std::sqrt(y2[i]);
+        x[n++] = shift - y;
+        x[n++] = shift + y;
+      }
+    }
+  } else {
+    // The largest root of the resolvent cubic is positive when q != 0
+    double m[3];
+    const auto k = gsl_poly_solve_cubic(p, p * p / 4 - r, -q * q / 8,  //
+                                        &m[0], &m[1], &m[2]);
+    const auto mm = m[k - 1];
+    const auto s = std::sqrt(2 * mm);
+    double y[2];
+    for (const auto sign : {1.0, -1.0}) {
+      const auto j = gsl_poly_solve_quadratic(
+          1.0, -sign * s, p / 2 + mm + sign * q / (2 * s), &y[0], &y[1]);
+      for (int i = 0; i < j; ++i) {
+        x[n++] = shift + y[i];
+      }
+    }
+  }
+
+  // Polish roots by Newton's method
+  for (int i = 0; i < n; ++i) {
+    for (int iter = 0; iter < 2; ++iter) {
+      const auto xi = x[i];
+      const auto f =
+          (((xi + this->a) * xi + this->b) * xi + this->c) * xi + this->d;
+      const auto df =
+          ((4 * xi + 3 * this->a) * xi + 2 * this->b) * xi + this->c;
+      if (df == 0) {
+        break;
+      }
+      x[i] -= f / df;
+    }
+  }
+
+  std::sort(x.begin(), x.begin() + n);
+  return static_cast<std::size_t>(n);
+}
+
+}  // namespace eos
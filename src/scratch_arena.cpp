@@ -0,0 +1,74 @@
+#include "eos/common/scratch_arena.hpp"
+
+#include <algorithm>
+
+namespace eos {
+
+namespace {
+
+using block_type = std::max_align_t;
+
+std::unique_ptr<block_type[]> make_block(std::size_t size) {
+  const auto n = (size + sizeof(block_type) - 1) / sizeof(block_type);
+  return std::unique_ptr<block_type[]>(new block_type[n]);
+}
+
+}  // namespace
+
+scratch_arena::scratch_arena(std::size_t capacity)
+    : block_{make_block(capacity)},
+      overflow_{},
+      capacity_{capacity},
+      offset_{0},
+      used_{0},
+      peak_{0},
+      heap_allocations_{1} {}
+
+scratch_arena::~scratch_arena() = default;
+
+void scratch_arena::reset() {
+  offset_ = 0;
+  used_ = 0;
+  // Overflow blocks may have been freed by inner scopes
+  if (!overflow_.empty() || peak_ > capacity_) {
+    overflow_.clear();
+    // Grows the main block so that the peak usage fits in it
+    capacity_ = std::max(2 * capacity_, peak_);
+    block_ = make_block(capacity_);
+    ++heap_allocations_;
+  }
+}
+
+void* scratch_arena::allocate_bytes(std::size_t size, std::size_t alignment) {
+  const auto first = (offset_ + alignment - 1) / alignment * alignment;
+  if (first + size <= capacity_) {
+    used_ += first + size - offset_;
+    offset_ = first + size;
+    peak_ = std::max(peak_, used_);
+    return reinterpret_cast<char*>(block_.get()) + first;
+  }
+
+  overflow_.push_back(make_block(size));
+  ++heap_allocations_;
+  used_ += size;
+  peak_ = std::max(peak_, used_);
+  return overflow_.back().get();
+}
+
+void scratch_arena::release(std::size_t offset, std::size_t used,
+                            std::size_t overflow) {
+  if (used == 0) {
+    this->reset();
+  } else {
+    offset_ = offset;
+    used_ = used;
+    overflow_.resize(overflow);
+  }
+}
+
+scratch_arena& thread_scratch_arena() {
+  thread_local scratch_arena arena;
+  return arena;
+}
+
+}  // namespace eos
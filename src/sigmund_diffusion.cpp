@@ -0,0 +1,183 @@
+#include "eos/diffusion/sigmund_diffusion.hpp"
+
+#include <cassert>    // assert
+#include <cmath>      // std::cbrt, std::exp, std::log, std::pow, std::sqrt
+#include <stdexcept>  // std::invalid_argument
+
+#include "eos/common/scratch_arena.hpp"
+#include "eos/math/vector_math.hpp"  // eos::vector_math::exp
+
+namespace eos {
+
+sigmund_diffusion::sigmund_diffusion(gsl::span<const double> tc,
+                                     gsl::span<const double> vc,
+                                     gsl::span<const double> zc,
+                                     gsl::span<const double> mw)
+    : mw_(mw.begin(), mw.end()) {
+  const auto n = mw.size();
+  if (tc.size() != n || vc.size() != n || zc.size() != n) {
+    throw std::invalid_argument("Size of parameters mismatch");
+  }
+
+  // Lennard-Jones parameters from critical properties
+  std::vector<double> sigma(n), eps(n);
+  vc23_.resize(n);
+  vc53_.resize(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    const auto vc_cm3 = vc[i] * 1e6;
+    sigma[i] = 0.1866 * std::cbrt(vc_cm3) * std::pow(zc[i], -1.2);
+    eps[i] = 65.3 * tc[i] * std::pow(zc[i], 3.6);
+    vc23_[i] = std::cbrt(vc[i] * vc[i]);
+    vc53_[i] = vc23_[i] * vc[i];
+  }
+
+  // Chapman-Enskog theory, 0.0018583 T^(3/2) (1/Mi + 1/Mj)^(1/2) /
+  // (p sigma^2 Omega) [cm2/s] with p in atm, times the density of ideal gas
+  constexpr auto c = 1.8583e-7 * 101325.0 / gas_constant<double>();
+  const auto size = n * (n + 1) / 2;
+  inv_eps_.reserve(size);
+  ln_eps_.reserve(size);
+  factor_.reserve(size);
+  for (std::size_t i = 0; i < n; ++i) {
+    for (std::size_t j = i; j < n; ++j) {
+      const auto s = 0.5 * (sigma[i] + sigma[j]);
+      const auto e = std::sqrt(eps[i] * eps[j]);
+      inv_eps_.push_back(1 / e);
+      ln_eps_.push_back(std::log(e));
+      factor_.push_back(c * std::sqrt(1 / mw[i] + 1 / mw[j]) / (s * s));
+    }
+  }
+}
+
+double sigmund_diffusion::density_correction(double rho_r) noexcept {
+  if (rho_r > 3.0) {
+    return 0.18839 * std::exp(3.0 - rho_r);
+  }
+  return 0.99589 +
+         rho_r * (0.096016 + rho_r * (-0.22035 + rho_r * 0.032874));
+}
+
+void sigmund_diffusion::dilute_gas_products(double t, std::size_t first,
+                                            gsl::span<double> rd) const
+    noexcept {
+  assert(first + rd.size() <= factor_.size());
+  // Collision integral of Neufeld et al. with T*^(-B) = exp(-B ln T*). The
+  // exponentials of eos::vector_math are inlined so that the loop is
+  // vectorized.
+  using vector_math::exp;
+  const auto sqrt_t = std::sqrt(t);
+  const auto ln_t = std::log(t);
+  const auto inv_eps = inv_eps_.data() + first;
+  const auto ln_eps = ln_eps_.data() + first;
+  const auto factor = factor_.data() + first;
+  const auto out = rd.data();
+  for (std::size_t k = 0; k < rd.size(); ++k) {
+    const auto ts = t * inv_eps[k];
+    const auto omega = 1.06036 * exp(-0.15610 * (ln_t - ln_eps[k])) +
+                       0.19300 * exp(-0.47635 * ts) +
+                       1.03587 * exp(-1.52996 * ts) +
+                       1.76474 * exp(-3.89411 * ts);
+    out[k] = factor[k] * sqrt_t / omega;
+  }
+}
+
+double sigmund_diffusion::reduced_density(double rho,
+                                          gsl::span<const double> x) const
+    noexcept {
+  double num = 0.0, den = 0.0;
+  for (std::size_t i = 0; i < x.size(); ++i) {
+    num += x[i] * vc53_[i];
+    den += x[i] * vc23_[i];
+  }
+  return rho * num / den;
+}
+
+void sigmund_diffusion::binary_coefficients(double t, double rho,
+                                            gsl::span<const double> x,
+                                            gsl::span<double> d) const {
+  const auto n = mw_.size();
+  assert(x.size() == n && d.size() == n * n);
+  auto &arena = thread_scratch_arena();
+  scratch_arena::scope scope(arena);
+  const auto rd = arena.allocate<double>(factor_.size());
+  this->dilute_gas_products(t, 0, rd);
+
+  const auto f = density_correction(this->reduced_density(rho, x)) / rho;
+  std::size_t k = 0;
+  for (std::size_t i = 0; i < n; ++i) {
+    for (std::size_t j = i; j < n; ++j, ++k) {
+      d[i * n + j] = d[j * n + i] = rd[k] * f;
+    }
+  }
+}
+
+void sigmund_diffusion::effective_coefficients(double t, double rho,
+                                               gsl::span<const double> x,
+                                               gsl::span<double> d) const {
+  auto &arena = thread_scratch_arena();
+  scratch_arena::scope scope(arena);
+  this->effective_coefficients(t, rho, x, arena.allocate<double>(mw_.size()),
+                               d);
+}
+
+void sigmund_diffusion::effective_coefficients(double t, double rho,
+                                               gsl::span<const double> x,
+                                               gsl::span<double> rd,
+                                               gsl::span<double> d) const
+    noexcept {
+  const auto n = mw_.size();
+  assert(x.size() == n && d.size() == n && rd.size() >= n);
+
+  // Sums of x_j / (rho D_ij) over j other than i. The products of a row of
+  // the upper triangle are computed into the workspace, which stays in
+  // cache, and are consumed at once by the terms of both i and j.
+  const auto xp = x.data();
+  const auto dp = d.data();
+  const auto row = rd.data();
+  for (std::size_t i = 0; i < n; ++i) {
+    dp[i] = 0.0;
+  }
+  std::size_t k = 0;
+  for (std::size_t i = 0; i < n; ++i) {
+    ++k;  // Skips the diagonal
+    const auto m = n - i - 1;
+    this->dilute_gas_products(t, k, rd.subspan(0, m));
+    const auto xi = xp[i];
+    const auto xj = xp + i + 1;
+    const auto dj = dp + i + 1;
+    for (std::size_t j = 0; j < m; ++j) {
+      const auto inv = 1 / row[j];
+      dj[j] += xi * inv;
+      row[j] = xj[j] * inv;
+    }
+    double sum = 0.0;
+    for (std::size_t j = 0; j < m; ++j) {
+      sum += row[j];
+    }
+    dp[i] += sum;
+    k += m;
+  }
+
+  const auto f = density_correction(this->reduced_density(rho, x)) / rho;
+  for (std::size_t i = 0; i < n; ++i) {
+    d[i] = (1 - x[i]) / d[i] * f;
+  }
+}
+
+void sigmund_diffusion::effective_coefficients(gsl::span<const double> t,
+                                               gsl::span<const double> rho,
+                                               gsl::span<const double> x,
+                                               gsl::span<double> d) const {
+  const auto n = mw_.size();
+  assert(t.size() == rho.size() && x.size() == t.size() * n &&
+         d.size() == x.size());
+  auto &arena = thread_scratch_arena();
+  scratch_arena::scope scope(arena);
+  const auto rd = arena.allocate<double>(n);
+  for (std::size_t i = 0; i < t.size(); ++i) {
+    this->effective_coefficients(t[i], rho[i], x.subspan(i * n, n), rd,
+                                 d.subspan(i * n, n));
+  }
+}
+
+}  // namespace eos
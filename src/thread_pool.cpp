@@ -0,0 +1,63 @@
+#include "eos/parallel/thread_pool.hpp"
+
+#include <algorithm>
+#include <utility>
+
+namespace eos {
+
+namespace {
+
+/// @brief Pool of the worker running on this thread, or nullptr
+thread_local const thread_pool *current_pool = nullptr;
+
+}  // namespace
+
+thread_pool::thread_pool(std::size_t num_threads) : stopped_{false} {
+  if (num_threads == 0) {
+    num_threads = std::max(1u, std::thread::hardware_concurrency());
+  }
+  workers_.reserve(num_threads);
+  for (std::size_t i = 0; i < num_threads; ++i) {
+    workers_.emplace_back([this] { this->work(); });
+  }
+}
+
+thread_pool::~thread_pool() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stopped_ = true;
+  }
+  cv_.notify_all();
+  for (auto &w : workers_) {
+    w.join();
+  }
+}
+
+void thread_pool::submit(std::function<void()> task) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    tasks_.push(std::move(task));
+  }
+  cv_.notify_one();
+}
+
+bool thread_pool::in_worker() const noexcept { return current_pool == this; }
+
+void thread_pool::work() {
+  current_pool = this;
+  while (true) {
+    std::function<void()> task;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      cv_.wait(lock, [this] { return stopped_ || !tasks_.empty(); });
+      if (tasks_.empty()) {
+        return;
+      }
+      task = std::move(tasks_.front());
+      tasks_.pop();
+    }
+    task();
+  }
+}
+
+}  // namespace eos
@@ -0,0 +1,89 @@
+#include "eos/arrow/arrow_batch.hpp"
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "eos/cubic_eos/peng_robinson_eos.hpp"
+
+class ArrowBatchTest : public ::testing::Test {
+ protected:
+  // Methane
+  static constexpr double pc = 4e6;       // Critical pressure [Pa]
+  static constexpr double tc = 190.6;     // Critical temperature [K]
+  static constexpr double omega = 0.008;  // Acentric factor
+  static constexpr double zc = 0.286;     // Critical Z-factor
+  static constexpr double mw = 16.043;    // Molecular weight [kg/kmol]
+
+  static std::shared_ptr<arrow::DoubleArray> make_array(
+      const std::vector<double> &x, const std::vector<bool> &valid = {}) {
+    arrow::DoubleBuilder builder;
+    if (valid.empty()) {
+      EXPECT_TRUE(builder.AppendValues(x).ok());
+    } else {
+      EXPECT_TRUE(builder.AppendValues(x, valid).ok());
+    }
+    std::shared_ptr<arrow::DoubleArray> a;
+    EXPECT_TRUE(builder.Finish(&a).ok());
+    return a;
+  }
+};
+
+TEST_F(ArrowBatchTest, ZFactorAndFugacityTest) {
+  using namespace eos;
+  const auto eos = make_peng_robinson_eos(pc, tc, omega);
+
+  const std::vector<double> p = {1e5, 1e6, 3e6, 1e7};
+  const std::vector<double> t = {150.0, 180.0, 200.0, 300.0};
+  const auto pa = make_array(p);
+  const auto ta = make_array(t);
+
+  auto z = make_double_array_data(4).ValueOrDie();
+  const auto values = z->buffers[1]->data();
+  ASSERT_TRUE(zfactor(eos, *pa, *ta, root_selection::stable, *z).ok());
+  // Results are written to the preallocated buffer
+  EXPECT_EQ(z->buffers[1]->data(), values);
+  EXPECT_EQ(z->null_count, 0);
+
+  auto ln_phi = make_double_array_data(4).ValueOrDie();
+  ASSERT_TRUE(
+      ln_fugacity_coeff(eos, *pa, *ta, root_selection::stable, *ln_phi).ok());
+
+  const arrow::DoubleArray za(z), ln_phi_a(ln_phi);
+  for (std::size_t i = 0; i < p.size(); ++i) {
+    const auto state = eos.create_isobaric_isothermal_state(p[i], t[i]);
+    const auto zi = state.zfactor(root_selection::stable);
+    EXPECT_EQ(za.Value(i), zi);
+    EXPECT_EQ(ln_phi_a.Value(i), state.ln_fugacity_coeff(zi));
+  }
+}
+
+TEST_F(ArrowBatchTest, NullPropagationTest) {
+  using namespace eos;
+  const auto lucas = make_lucas_method(pc, tc, zc, mw, 0.0, 0.0);
+
+  const auto pa = make_array({1e6, 2e6, 3e6, 4e6}, {true, false, true, true});
+  const auto ta =
+      make_array({200.0, 250.0, 300.0, 350.0}, {true, true, true, false});
+
+  auto mu = make_double_array_data(4).ValueOrDie();
+  ASSERT_TRUE(viscosity(lucas, *pa, *ta, *mu).ok());
+
+  const arrow::DoubleArray mu_a(mu);
+  EXPECT_EQ(mu_a.null_count(), 2);
+  EXPECT_TRUE(mu_a.IsValid(0));
+  EXPECT_TRUE(mu_a.IsNull(1));
+  EXPECT_TRUE(mu_a.IsValid(2));
+  EXPECT_TRUE(mu_a.IsNull(3));
+  EXPECT_EQ(mu_a.Value(2), lucas.viscosity_at_high_pressure(3e6, 300.0));
+}
+
+TEST_F(ArrowBatchTest, InvalidLengthTest) {
+  using namespace eos;
+  const auto eos = make_peng_robinson_eos(pc, tc, omega);
+  const auto pa = make_array({1e6, 2e6});
+  const auto ta = make_array({200.0});
+  auto z = make_double_array_data(2).ValueOrDie();
+  EXPECT_TRUE(
+      zfactor(eos, *pa, *ta, root_selection::stable, *z).IsInvalid());
+}
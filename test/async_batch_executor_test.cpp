@@ -0,0 +1,126 @@
+#include "eos/parallel/async_batch_executor.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+#include "eos/cubic_eos/peng_robinson_eos.hpp"
+
+TEST(ThreadPoolTest, SubmitTest) {
+  std::atomic<int> count{0};
+  {
+    eos::thread_pool pool(4);
+    EXPECT_EQ(pool.size(), 4);
+    for (int i = 0; i < 100; ++i) {
+      pool.submit([&count] { ++count; });
+    }
+  }
+  EXPECT_EQ(count, 100);
+}
+
+class AsyncBatchExecutorTest : public ::testing::Test {
+ protected:
+  // Methane
+  static constexpr double pc = 4e6;       // Critical pressure [Pa]
+  static constexpr double tc = 190.6;     // Critical temperature [K]
+  static constexpr double omega = 0.008;  // Acentric factor
+
+  AsyncBatchExecutorTest()
+      : eos_{eos::make_peng_robinson_eos(pc, tc, omega)}, pool_{4} {}
+
+  eos::peng_robinson_eos eos_;
+  eos::thread_pool pool_;
+};
+
+TEST_F(AsyncBatchExecutorTest, FutureTest) {
+  using namespace eos;
+  async_batch_executor<peng_robinson_eos> executor(pool_, eos_, 2);
+
+  const std::size_t n = 64;
+  std::vector<double> p(n), t(n), z_expected(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    p[i] = 1e5 * (i + 1);
+    t[i] = 150.0 + i;
+  }
+  eos_.zfactor(p, t, z_expected, root_selection::stable);
+
+  // Reuses two output buffers in turn
+  std::vector<std::vector<double>> z(2, std::vector<double>(n));
+  std::vector<std::future<void>> futures(2);
+  for (int k = 0; k < 10; ++k) {
+    auto &f = futures[k % 2];
+    if (f.valid()) {
+      f.get();
+    }
+    f = executor.zfactor(p, t, z[k % 2], root_selection::stable);
+    EXPECT_LE(executor.in_flight(), executor.max_in_flight());
+  }
+  for (std::size_t k = 0; k < 2; ++k) {
+    futures[k].get();
+    for (std::size_t i = 0; i < n; ++i) {
+      EXPECT_EQ(z[k][i], z_expected[i]);
+    }
+  }
+}
+
+TEST_F(AsyncBatchExecutorTest, CallbackTest) {
+  using namespace eos;
+  async_batch_executor<peng_robinson_eos> executor(pool_, eos_, 1);
+
+  const std::vector<double> t = {150.0, 160.0, 170.0, 180.0};
+  std::vector<double> p_init(t.size());
+  for (std::size_t i = 0; i < t.size(); ++i) {
+    p_init[i] = estimate_vapor_pressure(t[i], pc, tc, omega);
+  }
+
+  const std::size_t num_batches = 8;
+  std::vector<std::vector<double>> p(num_batches,
+                                     std::vector<double>(t.size()));
+  std::vector<std::vector<flash_iteration_result>> r(
+      num_batches, std::vector<flash_iteration_result>(t.size()));
+  std::atomic<std::size_t> completed{0};
+  for (std::size_t k = 0; k < num_batches; ++k) {
+    executor.vapor_pressure(p_init, t, p[k], r[k], [&completed] {
+      ++completed;
+    });
+    EXPECT_LE(executor.in_flight(), 1);
+  }
+  executor.wait();
+  EXPECT_EQ(completed, num_batches);
+
+  const auto flash = make_vapor_liquid_flash(eos_);
+  for (std::size_t i = 0; i < t.size(); ++i) {
+    const auto [pvap, result] = flash.vapor_pressure(p_init[i], t[i]);
+    for (std::size_t k = 0; k < num_batches; ++k) {
+      EXPECT_EQ(p[k][i], pvap);
+      EXPECT_EQ(r[k][i].error, result.error);
+    }
+  }
+}
+
+TEST_F(AsyncBatchExecutorTest, ExceptionTest) {
+  using namespace eos;
+  async_batch_executor<peng_robinson_eos> executor(pool_, eos_, 1);
+  auto f = executor.submit([] { throw std::runtime_error("error"); });
+  EXPECT_THROW(f.get(), std::runtime_error);
+}
+
+TEST_F(AsyncBatchExecutorTest, ReentrantTest) {
+  using namespace eos;
+  EXPECT_FALSE(pool_.in_worker());
+  async_batch_executor<peng_robinson_eos> executor(pool_, eos_, 1);
+  // The only slot is taken by the running batch
+  std::promise<bool> thrown;
+  executor.submit([&] {
+    EXPECT_TRUE(pool_.in_worker());
+    try {
+      executor.submit([] {});
+      thrown.set_value(false);
+    } catch (const std::logic_error &) {
+      thrown.set_value(true);
+    }
+  });
+  EXPECT_TRUE(thrown.get_future().get());
+}
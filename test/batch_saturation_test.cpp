@@ -0,0 +1,100 @@
+#include "eos/parallel/batch_saturation.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <future>
+#include <vector>
+
+#include "eos/cubic_eos/peng_robinson_eos.hpp"
+#include "eos/cubic_eos/vapor_liquid_flash.hpp"
+
+TEST(BatchSaturationTest, ComputeSaturationTest) {
+  using namespace eos;
+  // Methane, n-decane, CO2, and synthetic components
+  std::vector<double> pc = {4e6, 2.11e6, 7.38e6};
+  std::vector<double> tc = {190.6, 617.7, 304.1};
+  std::vector<double> omega = {0.008, 0.49, 0.225};
+  for (int i = 0; i < 18; ++i) {
+    pc.push_back(2e6 + 2e5 * i);
+    tc.push_back(300.0 + 15.0 * i);
+    omega.push_back(0.05 * i);
+  }
+  std::vector<double> t;
+  for (int j = 0; j < 16; ++j) {
+    t.push_back(150.0 + 30.0 * j);
+  }
+  const auto nc = pc.size();
+  const auto nt = t.size();
+
+  std::vector<double> p(nc * nt), zl(nc * nt), zv(nc * nt);
+  std::vector<flash_iteration_result> r(nc * nt);
+  thread_pool pool(4);
+  compute_saturation<peng_robinson_eos>(pool, pc, tc, omega, t,
+                                        {p, zl, zv, r});
+
+  for (std::size_t j = 0; j < nt; ++j) {
+    for (std::size_t i = 0; i < nc; ++i) {
+      const auto k = j * nc + i;
+      if (!(t[j] < tc[i])) {
+        EXPECT_EQ(p[k], 0.0);
+        EXPECT_EQ(r[k].error, flash_iteration_error::multiple_roots_not_found);
+        continue;
+      }
+      if (t[j] < 0.4 * tc[i]) {
+        // vapor_liquid_flash may break down at such low temperatures
+        continue;
+      }
+      const peng_robinson_eos eos(pc[i], tc[i], omega[i]);
+      auto flash = make_vapor_liquid_flash(eos);
+      flash.set_initial_guess(
+          {vapor_pressure_guess::lee_kesler, pc[i], tc[i], omega[i]});
+      const auto [p_ref, r_ref] = flash.vapor_pressure(t[j]);
+      ASSERT_EQ(r[k].error, r_ref.error) << "i = " << i << ", j = " << j;
+      if (r_ref.error != flash_iteration_error::success) {
+        continue;
+      }
+      // Both converge to the tolerance of the relative difference of fugacity
+      EXPECT_NEAR(p[k], p_ref, 1e-5 * p_ref);
+      EXPECT_GT(r[k].iter, 0);
+
+      // Z-factors are the smallest and largest roots at the vapor pressure
+      const auto state = eos.create_isobaric_isothermal_state(p[k], t[j]);
+      const auto eq = peng_robinson_eos::zfactor_cubic_eq(
+          state.reduced_attraction_param(), state.reduced_repulsion_param());
+      for (const auto z : {zl[k], zv[k]}) {
+        const auto f = ((z + eq.a) * z + eq.b) * z + eq.c;
+        const auto df = (3 * z + 2 * eq.a) * z + eq.b;
+        EXPECT_LT(std::fabs(f / df), 1e-10 * z);
+      }
+      EXPECT_GT(zl[k], state.reduced_repulsion_param());
+      EXPECT_LT(zl[k], zv[k]);
+    }
+  }
+}
+
+TEST(BatchSaturationTest, WorkerThreadTest) {
+  using namespace eos;
+  const std::vector<double> pc = {4e6, 2.11e6, 7.38e6};
+  const std::vector<double> tc = {190.6, 617.7, 304.1};
+  const std::vector<double> omega = {0.008, 0.49, 0.225};
+  const std::vector<double> t = {150.0, 250.0, 350.0};
+  const auto n = pc.size() * t.size();
+
+  std::vector<double> p(n), zl(n), zv(n), p_ref(n), zl_ref(n), zv_ref(n);
+  std::vector<flash_iteration_result> r(n), r_ref(n);
+  // The only worker would wait for itself if it submitted the blocks
+  thread_pool pool(1);
+  compute_saturation<peng_robinson_eos>(pool, pc, tc, omega, t,
+                                        {p_ref, zl_ref, zv_ref, r_ref});
+  std::promise<void> done;
+  pool.submit([&] {
+    compute_saturation<peng_robinson_eos>(pool, pc, tc, omega, t,
+                                          {p, zl, zv, r});
+    done.set_value();
+  });
+  done.get_future().get();
+  EXPECT_EQ(p, p_ref);
+  EXPECT_EQ(zl, zl_ref);
+  EXPECT_EQ(zv, zv_ref);
+}
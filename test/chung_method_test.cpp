@@ -0,0 +1,76 @@
+#include "eos/thermal_conductivity/chung_method.hpp"
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "eos/common/thermodynamic_constants.hpp"
+#include "eos/cubic_eos/peng_robinson_eos.hpp"
+
+// Parameters are taken from Appendix A of Poling et al. 2001. "The Properties
+// of Gases and Liquids", fifth edition, McGRAW-HILL.
+
+class ChungMethodTest : public ::testing::Test {
+ protected:
+  ChungMethodTest()
+      : methane_{190.56, 98.6e-6, 0.011, 16.043, 0.0, 0.0,
+                 eos::ideal_gas_heat_capacity(4.568, -8.975e-3, 3.631e-5,
+                                              -3.407e-8, 1.091e-11)},
+        hexane_{507.6, 368e-6, 0.301, 86.177, 0.0, 0.0,
+                eos::ideal_gas_heat_capacity(8.831, -0.166e-3, 14.302e-5,
+                                             -18.314e-8, 7.124e-11)} {}
+
+  eos::chung_method methane_;
+  eos::chung_method hexane_;
+};
+
+TEST_F(ChungMethodTest, LowPressureTest) {
+  // Measured value of methane at 300 K is 0.0343 W/m-K
+  EXPECT_NEAR(methane_.thermal_conductivity_at_low_pressure(300.0), 0.0343,
+              0.0017);
+  // Dense-fluid form reduces to the low-pressure one at zero density
+  EXPECT_DOUBLE_EQ(methane_.thermal_conductivity(300.0, 0.0),
+                   methane_.thermal_conductivity_at_low_pressure(300.0));
+  EXPECT_NEAR(methane_.thermal_conductivity(300.0, 1e-3),
+              methane_.thermal_conductivity_at_low_pressure(300.0), 1e-8);
+}
+
+TEST_F(ChungMethodTest, DenseFluidTest) {
+  // Measured value of liquid n-hexane at 298.15 K and 655 kg/m3 is 0.12 W/m-K
+  const auto rho = 655.0 / 86.177e-3;
+  EXPECT_NEAR(hexane_.thermal_conductivity(298.15, rho), 0.12, 0.012);
+
+  // Conductivity increases with density from the EoS
+  const auto pr = eos::make_peng_robinson_eos(4.599e6, 190.56, 0.011);
+  double prev = 0.0;
+  for (const auto p : {0.1e6, 5e6, 10e6, 20e6, 50e6}) {
+    const auto state = pr.create_isobaric_isothermal_state(p, 300.0);
+    const auto lambda =
+        methane_.thermal_conductivity(state, eos::root_selection::stable);
+    EXPECT_GT(lambda, prev);
+    prev = lambda;
+  }
+}
+
+TEST_F(ChungMethodTest, BatchTest) {
+  constexpr auto R = eos::gas_constant<double>();
+  const std::vector<double> t = {300.0, 300.0, 350.0, 350.0};
+  const std::vector<double> p = {1e6, 10e6, 1e6, 10e6};
+  const auto pr = eos::make_peng_robinson_eos(4.599e6, 190.56, 0.011);
+  std::vector<double> rho(t.size()), lambda(t.size());
+  for (std::size_t i = 0; i < t.size(); ++i) {
+    const auto z = pr.create_isobaric_isothermal_state(p[i], t[i])
+                       .zfactor(eos::root_selection::stable);
+    rho[i] = p[i] / (z * R * t[i]);
+  }
+  methane_.thermal_conductivity(t, rho, lambda);
+  for (std::size_t i = 0; i < t.size(); ++i) {
+    EXPECT_DOUBLE_EQ(lambda[i], methane_.thermal_conductivity(t[i], rho[i]));
+  }
+
+  const auto line = methane_.create_isothermal_line(300.0);
+  std::vector<double> lambda2(2);
+  line.thermal_conductivity(gsl::span<const double>(rho).first(2), lambda2);
+  EXPECT_DOUBLE_EQ(lambda2[0], lambda[0]);
+  EXPECT_DOUBLE_EQ(lambda2[1], lambda[1]);
+}
@@ -0,0 +1,105 @@
+#include "eos/solubility/co2_brine_solubility.hpp"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cmath>
+#include <vector>
+
+#include "eos/cubic_eos/flash_iteration_result.hpp"
+#include "eos/cubic_eos/root_selection.hpp"
+#include "eos/cubic_eos/soave_redlich_kwong_eos.hpp"
+
+TEST(Co2BrineSolubilityTest, PureWaterTest) {
+  // Measured values at 323.15 K and 100 bar are x = 0.0187 and y = 0.0040
+  const eos::co2_brine_solubility model;
+  const auto e = model.solve(100e5, 323.15, 0.0);
+  ASSERT_EQ(e.result.error, eos::flash_iteration_error::success);
+  EXPECT_NEAR(e.x_co2, 0.0187, 0.002);
+  EXPECT_NEAR(e.y_h2o, 0.0040, 0.001);
+}
+
+TEST(Co2BrineSolubilityTest, ValidationTest) {
+  // Approximate solubilities of CO2 in pure water [mol/kg] from the tables
+  // of Duan and Sun (2003), which reproduce measured data within about 7%
+  struct point {
+    double t;         // Temperature [K]
+    double p;         // Pressure [bar]
+    double molality;  // Solubility of CO2 [mol/kg]
+  };
+  constexpr std::array<point, 12> points = {{{285.15, 50.0, 1.55},
+                                             {285.15, 200.0, 1.72},
+                                             {298.15, 100.0, 1.41},
+                                             {298.15, 400.0, 1.63},
+                                             {323.15, 100.0, 1.08},
+                                             {323.15, 200.0, 1.26},
+                                             {323.15, 400.0, 1.43},
+                                             {323.15, 600.0, 1.55},
+                                             {373.15, 100.0, 0.81},
+                                             {373.15, 200.0, 1.11},
+                                             {373.15, 400.0, 1.42},
+                                             {373.15, 600.0, 1.59}}};
+  const eos::co2_brine_solubility model;
+  for (const auto &pt : points) {
+    const auto e = model.solve(pt.p * 1e5, pt.t, 0.0);
+    ASSERT_EQ(e.result.error, eos::flash_iteration_error::success);
+    const auto x = pt.molality / (55.508 + pt.molality);
+    EXPECT_NEAR(e.x_co2, x, 0.10 * x) << pt.t << " K, " << pt.p << " bar";
+  }
+}
+
+TEST(Co2BrineSolubilityTest, SaltingOutTest) {
+  using eos::co2_brine_solubility;
+  EXPECT_DOUBLE_EQ(co2_brine_solubility::ln_activity_coeff(100e5, 323.15, 0.0),
+                   0.0);
+  EXPECT_NEAR(co2_brine_solubility::ln_activity_coeff(100e5, 323.15, 1.0),
+              0.205, 0.005);
+
+  const co2_brine_solubility model;
+  double x_prev = 1.0, y_prev = 1.0;
+  for (const auto m : {0.0, 1.0, 2.0, 4.0}) {
+    const auto e = model.solve(200e5, 323.15, m);
+    ASSERT_EQ(e.result.error, eos::flash_iteration_error::success);
+    EXPECT_LT(e.x_co2, x_prev);
+    EXPECT_LT(e.y_h2o, y_prev);
+    x_prev = e.x_co2;
+    y_prev = e.y_h2o;
+  }
+}
+
+TEST(Co2BrineSolubilityTest, FugacityCoeffTest) {
+  // The fugacity coefficient of CO2 is that of pure CO2 by Redlich-Kwong
+  // EoS, a / T^0.5 = (7.54e7 - 4.13e4 T) / T^0.5 and b = 27.80
+  using eos_type = eos::soave_redlich_kwong_eos;
+  const eos::co2_brine_solubility model;
+  constexpr auto R = 83.1447;
+  const auto t = 323.15;
+  for (const auto p : {10e5, 100e5, 300e5}) {
+    const auto p_bar = p * 1e-5;
+    const auto a = (7.54e7 - 4.13e4 * t) * p_bar / (R * R * std::pow(t, 2.5));
+    const auto b = 27.80 * p_bar / (R * t);
+    const auto z =
+        eos::select_zfactor<eos_type>(a, b, eos::root_selection::stable);
+    const auto ln_phi = model.ln_fugacity_coeffs(p, t);
+    EXPECT_NEAR(ln_phi[0], eos_type::ln_fugacity_coeff(z, a, b), 1e-12);
+    // Water is less volatile than in ideal gas at high pressure
+    EXPECT_LT(ln_phi[1], ln_phi[0]);
+  }
+}
+
+TEST(Co2BrineSolubilityTest, BatchTest) {
+  const eos::co2_brine_solubility model;
+  const std::vector<double> p = {50e5, 60e5, 70e5, 80e5, 90e5, 100e5};
+  const std::vector<double> t(p.size(), 333.15);
+  const std::vector<double> m(p.size(), 1.0);
+  std::vector<double> x(p.size()), y(p.size());
+  std::vector<eos::flash_iteration_result> r(p.size());
+  model.solve(p, t, m, x, y, r);
+
+  for (std::size_t i = 0; i < p.size(); ++i) {
+    const auto e = model.solve(p[i], t[i], m[i]);
+    ASSERT_EQ(r[i].error, eos::flash_iteration_error::success);
+    EXPECT_EQ(x[i], e.x_co2);
+    EXPECT_EQ(y[i], e.y_h2o);
+  }
+}
@@ -0,0 +1,170 @@
+#include "eos/cpa/cpa_eos.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+namespace {
+
+/// @brief Solves site fractions by successive substitution
+int solve_by_substitution(const eos::association_sites &sites,
+                          double rho_delta,
+                          std::array<double, 4> &x) noexcept {
+  x.fill(1.0);
+  for (int iter = 1; iter <= 10000; ++iter) {
+    double eps = 0.0;
+    auto x_new = x;
+    for (std::size_t i = 0; i < sites.num_types; ++i) {
+      double s = 0.0;
+      for (std::size_t j = 0; j < sites.num_types; ++j) {
+        if (sites.bond[i][j]) {
+          s += sites.count[j] * x[j];
+        }
+      }
+      x_new[i] = 1 / (1 + rho_delta * s);
+      eps = std::max(eps, std::fabs(x_new[i] - x[i]));
+    }
+    x = x_new;
+    if (eps < 1e-12) {
+      return iter;
+    }
+  }
+  return 10000;
+}
+
+}  // namespace
+
+class CpaEosTest : public ::testing::Test {
+ protected:
+  // Water of the 4C scheme and methanol of the 2B scheme
+  CpaEosTest()
+      : water_{647.29, 0.12277, 1.4515e-5, 0.67359,
+               16655,  0.0692,  eos::association_scheme::four_c},
+        methanol_{512.64, 0.40531, 3.0978e-5, 0.43102,
+                  24591,  0.0161,  eos::association_scheme::two_b} {}
+
+  eos::cpa_eos water_;
+  eos::cpa_eos methanol_;
+};
+
+TEST(AssociationTest, AnalyticSolutionTest) {
+  using namespace eos;
+  const auto sites = make_association_sites(association_scheme::two_b);
+  for (const auto rho_delta : {1e-3, 1.0, 50.0, 1e4}) {
+    association_state state;
+    solve_site_fractions(sites, rho_delta, state);
+    const auto expected =
+        (-1 + std::sqrt(1 + 4 * rho_delta)) / (2 * rho_delta);
+    EXPECT_NEAR(state.x[0], expected, 1e-12);
+    EXPECT_NEAR(state.x[1], expected, 1e-12);
+  }
+}
+
+TEST(AssociationTest, NewtonVersusSubstitutionTest) {
+  using namespace eos;
+  const auto sites = make_association_sites(association_scheme::four_c);
+  for (const auto rho_delta : {1.0, 10.0, 100.0}) {
+    association_state state;
+    const auto newton = solve_site_fractions(sites, rho_delta, state);
+    std::array<double, 4> x;
+    const auto substitution = solve_by_substitution(sites, rho_delta, x);
+    EXPECT_NEAR(state.x[0], x[0], 1e-10);
+    EXPECT_NEAR(state.x[1], x[1], 1e-10);
+    EXPECT_LT(newton, substitution);
+  }
+}
+
+TEST(AssociationTest, DerivativeTest) {
+  using namespace eos;
+  const auto sites = make_association_sites(association_scheme::three_b);
+  const auto rho_delta = 5.0;
+  const auto h = 1e-6;
+  association_state s0, s1, s2;
+  solve_site_fractions(sites, rho_delta, s0);
+  solve_site_fractions(sites, rho_delta - h, s1);
+  solve_site_fractions(sites, rho_delta + h, s2);
+  std::array<double, 4> dx;
+  site_fraction_derivatives(sites, rho_delta, s0.x, dx);
+  for (std::size_t i = 0; i < sites.num_types; ++i) {
+    EXPECT_NEAR(dx[i], (s2.x[i] - s1.x[i]) / (2 * h), 1e-7);
+  }
+}
+
+TEST_F(CpaEosTest, DensityTest) {
+  using namespace eos;
+  cpa_state state;
+  const auto water =
+      water_.properties(1e5, 298.15, root_selection::smallest, state);
+  EXPECT_NEAR(water.density, 55.3e3, 0.02 * 55.3e3);
+  EXPECT_NEAR(water_.pressure(298.15, 1 / water.density), 1e5, 1e-3);
+
+  state = cpa_state{};
+  const auto methanol =
+      methanol_.properties(1e5, 298.15, root_selection::smallest, state);
+  EXPECT_NEAR(methanol.density, 24.6e3, 0.02 * 24.6e3);
+
+  // Vapor is nearly ideal at low pressure
+  EXPECT_NEAR(water_.zfactor(1e3, 373.15, root_selection::largest), 1.0,
+              1e-2);
+}
+
+TEST_F(CpaEosTest, VaporPressureTest) {
+  using namespace eos;
+  const auto water = water_.vapor_pressure(1e5, 373.15);
+  EXPECT_EQ(water.second.error, flash_iteration_error::success);
+  EXPECT_NEAR(water.first, 101325, 0.03 * 101325);
+
+  const auto methanol = methanol_.vapor_pressure(1e4, 298.15);
+  EXPECT_EQ(methanol.second.error, flash_iteration_error::success);
+  EXPECT_NEAR(methanol.first, 16.9e3, 0.03 * 16.9e3);
+
+  // Fugacities of liquid and vapor are equal at the vapor pressure
+  EXPECT_NEAR(
+      water_.ln_fugacity_coeff(water.first, 373.15, root_selection::smallest),
+      water_.ln_fugacity_coeff(water.first, 373.15, root_selection::largest),
+      1e-7);
+}
+
+TEST_F(CpaEosTest, WarmStartTest) {
+  using namespace eos;
+  std::vector<double> p(50, 1e5), t(50);
+  for (std::size_t i = 0; i < t.size(); ++i) {
+    t[i] = 280.0 + 1.0 * i;
+  }
+
+  cpa_state warm;
+  std::vector<double> z(p.size());
+  water_.zfactor(p, t, z, root_selection::smallest, warm);
+
+  int cold = 0;
+  for (std::size_t i = 0; i < p.size(); ++i) {
+    cpa_state state;
+    const auto expected =
+        water_.properties(p[i], t[i], root_selection::smallest, state).z;
+    cold += state.association.iterations;
+    EXPECT_NEAR(z[i], expected, 1e-10 * expected);
+  }
+  EXPECT_LT(warm.association.iterations, cold);
+}
+
+TEST_F(CpaEosTest, BatchTest) {
+  using namespace eos;
+  const std::vector<double> p = {1e3, 1e5, 1e6, 1e7};
+  const std::vector<double> t = {300.0, 350.0, 400.0, 450.0};
+  std::vector<double> z(p.size()), ln_phi(p.size());
+  cpa_state state;
+  methanol_.zfactor(p, t, z, root_selection::stable, state);
+  methanol_.ln_fugacity_coeff(p, t, ln_phi, root_selection::stable, state);
+  for (std::size_t i = 0; i < p.size(); ++i) {
+    EXPECT_NEAR(z[i], methanol_.zfactor(p[i], t[i], root_selection::stable),
+                1e-10 * z[i]);
+    EXPECT_NEAR(ln_phi[i],
+                methanol_.ln_fugacity_coeff(p[i], t[i],
+                                            root_selection::stable),
+                1e-9);
+  }
+  // The vapor at the lowest pressure and the liquid at the highest pressure
+  EXPECT_GT(z[0], 0.9);
+  EXPECT_LT(z[3], 0.2);
+}
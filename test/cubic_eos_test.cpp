@@ -1,6 +1,8 @@
 #include <gtest/gtest.h>
 
+#include <cmath>
 #include <iostream>
+#include <vector>
 
 #include "eos/cubic_eos/peng_robinson_eos.hpp"
 #include "eos/cubic_eos/soave_redlich_kwong_eos.hpp"
@@ -104,3 +106,226 @@ TEST(CubicEosTest, PengRobinsonEosTest) {
     EXPECT_NEAR(state.pressure(0.1), 1.494132e4, 0.01);
   }
 }
+
+TEST(CubicEosTest, ThermodynamicDerivativesTest) {
+  // Methane
+  const double pc = 4e6;       // Critical pressure [Pa]
+  const double tc = 190.6;     // Critical temperature [K]
+  const double omega = 0.008;  // Acentric factor
+  const double mw = 16.043;    // Molecular weight [kg/kmol]
+  const double cp = 35.7;      // Ideal gas isobaric heat capacity [J/mol-K]
+
+  auto eos = eos::make_peng_robinson_eos(pc, tc, omega);
+  const double p = 5e6;    // Pressure [Pa]
+  const double t = 250.0;  // Temperature [K]
+  const double dt = 1e-3;  // Temperature increment [K]
+
+  const auto residual_enthalpy = [&eos, p](double t) {
+    const auto state = eos.create_isobaric_isothermal_state(p, t);
+    const auto z = state.zfactor();
+    return state.residual_enthalpy(z.back());
+  };
+
+  const auto state = eos.create_isobaric_isothermal_state(p, t);
+  const auto z = state.zfactor();
+  ASSERT_EQ(z.size(), 1);
+
+  const auto d = state.derivatives(z[0], cp, mw);
+  const auto cp_res =
+      (residual_enthalpy(t + dt) - residual_enthalpy(t - dt)) / (2 * dt);
+  EXPECT_NEAR(d.residual_isobaric_heat_capacity, cp_res, 1e-4);
+  EXPECT_NEAR(d.isobaric_heat_capacity, cp + cp_res, 1e-4);
+
+  const auto v = z[0] * eos::gas_constant<double>() * t / p;
+  const auto dpdt =
+      (eos.pressure(t + dt, v) - eos.pressure(t - dt, v)) / (2 * dt);
+  EXPECT_NEAR(d.dpdt, dpdt, 1e-2);
+  const auto dv = 1e-6 * v;
+  const auto dpdv =
+      (eos.pressure(t, v + dv) - eos.pressure(t, v - dv)) / (2 * dv);
+  EXPECT_NEAR(d.dpdv / dpdv, 1.0, 1e-6);
+
+  // Ideal gas limit
+  {
+    const auto state = eos.create_isobaric_isothermal_state(1.0, t);
+    const auto z = state.zfactor();
+    const auto d = state.derivatives(z[0], cp, mw);
+    const auto R = eos::gas_constant<double>();
+    const auto c = std::sqrt(cp / (cp - R) * R * t / (1e-3 * mw));
+    EXPECT_NEAR(d.residual_isobaric_heat_capacity, 0.0, 1e-4);
+    EXPECT_NEAR(d.speed_of_sound, c, 1e-3);
+  }
+
+  // Batch evaluation
+  {
+    const std::vector<double> ps = {p, 1e6};
+    const std::vector<double> ts = {t, 300.0};
+    const std::vector<double> zs = {
+        z[0], eos.create_isobaric_isothermal_state(1e6, 300.0).zfactor()[0]};
+    const std::vector<double> cps = {cp, cp};
+    std::vector<eos::thermodynamic_derivatives> ds(2);
+    eos.derivatives(ps, ts, zs, cps, mw, ds);
+    EXPECT_DOUBLE_EQ(ds[0].joule_thomson_coeff, d.joule_thomson_coeff);
+    EXPECT_GT(ds[1].joule_thomson_coeff, 0.0);
+  }
+}
+
+TEST(CubicEosTest, IsothermalLineTest) {
+  using eos::root_selection;
+  // Methane
+  const double pc = 4e6;       // Critical pressure [Pa]
+  const double tc = 190.6;     // Critical temperature [K]
+  const double omega = 0.008;  // Acentric factor
+  const double mw = 16.043;    // Molecular weight [kg/kmol]
+
+  auto eos = eos::make_peng_robinson_eos(pc, tc, omega);
+  const double t = 180.0;  // Temperature [K]
+  const auto line = eos.create_isothermal_line(t);
+
+  {
+    const std::vector<double> v = {0.001, 0.01, 0.1};
+    std::vector<double> p(v.size());
+    std::vector<double> dpdv(v.size());
+    line.pressure(v, p, dpdv);
+    for (std::size_t i = 0; i < v.size(); ++i) {
+      const auto dv = 1e-6 * v[i];
+      EXPECT_DOUBLE_EQ(p[i], line.pressure(v[i]));
+      EXPECT_NEAR(dpdv[i] * 2 * dv,
+                  line.pressure(v[i] + dv) - line.pressure(v[i] - dv),
+                  1e-6 * std::fabs(p[i]));
+    }
+  }
+
+  {
+    // Vapor pressure of methane at 180 K is about 2.875 MPa
+    const std::vector<double> p = {2.5e6, 3e6};
+    std::vector<double> vl(p.size());
+    std::vector<double> vv(p.size());
+    std::vector<double> vs(p.size());
+    line.volume(p, vl, root_selection::smallest);
+    line.volume(p, vv, root_selection::largest);
+    line.volume(p, vs, root_selection::stable);
+
+    for (std::size_t i = 0; i < p.size(); ++i) {
+      EXPECT_LT(vl[i], vv[i]);
+      EXPECT_NEAR(line.pressure(vl[i]), p[i], 1e-4 * p[i]);
+      EXPECT_NEAR(line.pressure(vv[i]), p[i], 1e-4 * p[i]);
+    }
+    EXPECT_DOUBLE_EQ(vs[0], vv[0]);
+    EXPECT_DOUBLE_EQ(vs[1], vl[1]);
+
+    const auto z = eos.create_isobaric_isothermal_state(p[1], t).zfactor();
+    EXPECT_NEAR(vl[1], z[0] * eos::gas_constant<double>() * t / p[1], 1e-12);
+
+    std::vector<double> rho(p.size());
+    line.density(p, mw, rho, root_selection::stable);
+    EXPECT_DOUBLE_EQ(rho[1], 1e-3 * mw / vl[1]);
+  }
+}
+
+TEST(CubicEosTest, MaxwellConstructionTest) {
+  using namespace eos;
+  // Methane
+  const double pc = 4e6;       // Critical pressure [Pa]
+  const double tc = 190.6;     // Critical temperature [K]
+  const double omega = 0.008;  // Acentric factor
+  const double t = 180.0;      // Temperature [K]
+
+  {
+    const auto eos = make_peng_robinson_eos(pc, tc, omega);
+    const auto line = eos.create_isothermal_line(t);
+
+    const auto v = line.spinodal_volumes();
+    ASSERT_EQ(v.size(), 2);
+    std::vector<double> p(2);
+    std::vector<double> dpdv(2);
+    line.pressure(v, p, dpdv);
+    EXPECT_NEAR(dpdv[0] * v[0] / p[0], 0.0, 1e-8);
+    EXPECT_NEAR(dpdv[1] * v[1] / p[1], 0.0, 1e-8);
+    EXPECT_LT(p[0], p[1]);
+
+    // Agrees with the vapor pressure by successive substitution
+    const auto [psat, result] = line.saturation_pressure();
+    EXPECT_EQ(result.error, flash_iteration_error::success);
+    EXPECT_LT(result.iter, 10);
+    EXPECT_NEAR(psat, 2.87515e6, 10);
+
+    const auto state = eos.create_isobaric_isothermal_state(psat, t);
+    const auto z = state.zfactor();
+    EXPECT_NEAR(state.ln_fugacity_coeff(z.front()),
+                state.ln_fugacity_coeff(z.back()), 1e-8);
+
+    // No spinodal above the critical temperature
+    EXPECT_TRUE(eos.create_isothermal_line(200.0).spinodal_volumes().empty());
+  }
+
+  {
+    const auto eos = make_soave_redlich_kwong_eos(pc, tc, omega);
+    const auto line = eos.create_isothermal_line(t);
+    const auto [psat, result] = line.saturation_pressure();
+    EXPECT_EQ(result.error, flash_iteration_error::success);
+    const auto state = eos.create_isobaric_isothermal_state(psat, t);
+    const auto z = state.zfactor();
+    EXPECT_NEAR(state.ln_fugacity_coeff(z.front()),
+                state.ln_fugacity_coeff(z.back()), 1e-8);
+  }
+
+  {
+    const auto eos = make_van_der_waals_eos(pc, tc);
+    const auto line = eos.create_isothermal_line(t);
+    const auto [psat, result] = line.saturation_pressure();
+    EXPECT_EQ(result.error, flash_iteration_error::success);
+    const auto state = eos.create_isobaric_isothermal_state(psat, t);
+    const auto z = state.zfactor();
+    EXPECT_NEAR(state.ln_fugacity_coeff(z.front()),
+                state.ln_fugacity_coeff(z.back()), 1e-8);
+  }
+}
+
+TEST(CubicEosTest, MemoizedStateTest) {
+  // Methane
+  const double pc = 4e6;       // Critical pressure [Pa]
+  const double tc = 190.6;     // Critical temperature [K]
+  const double omega = 0.008;  // Acentric factor
+  const double p = 3e6;        // Pressure [Pa]
+  const double t = 180.0;      // Temperature [K]
+
+  {
+    const auto eos = eos::make_peng_robinson_eos(pc, tc, omega);
+    const auto state = eos.create_isobaric_isothermal_state(p, t);
+    const auto memo = eos.create_memoized_isobaric_isothermal_state(p, t);
+
+    const auto z = state.zfactor();
+    const auto &zm = memo.zfactor();
+    ASSERT_EQ(zm.size(), z.size());
+    EXPECT_EQ(&memo.zfactor(), &zm);
+
+    for (std::size_t i = 0; i < z.size(); ++i) {
+      EXPECT_DOUBLE_EQ(zm[i], z[i]);
+      EXPECT_NEAR(memo.fugacity_coeff(zm[i]), state.fugacity_coeff(z[i]),
+                  1e-14);
+      EXPECT_NEAR(memo.residual_enthalpy(zm[i]), state.residual_enthalpy(z[i]),
+                  1e-9);
+      EXPECT_NEAR(memo.residual_entropy(zm[i]), state.residual_entropy(z[i]),
+                  1e-12);
+      EXPECT_NEAR(memo.residual_helmholtz_energy(zm[i]),
+                  state.residual_helmholtz_energy(z[i]), 1e-9);
+    }
+
+    // A Z-factor which is not a root is evaluated without caching
+    EXPECT_NEAR(memo.ln_fugacity_coeff(0.5), state.ln_fugacity_coeff(0.5),
+                1e-14);
+  }
+
+  {
+    const auto eos = eos::make_van_der_waals_eos(pc, tc);
+    const auto state = eos.create_isobaric_isothermal_state(p, t);
+    const auto memo = eos.create_memoized_isobaric_isothermal_state(p, t);
+    for (const auto z : memo.zfactor()) {
+      EXPECT_NEAR(memo.ln_fugacity_coeff(z), state.ln_fugacity_coeff(z),
+                  1e-14);
+      EXPECT_NEAR(memo.residual_enthalpy(z), state.residual_enthalpy(z), 1e-9);
+      EXPECT_NEAR(memo.residual_entropy(z), state.residual_entropy(z), 1e-12);
+    }
+  }
+}
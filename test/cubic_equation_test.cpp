@@ -28,4 +28,35 @@ TEST(CubicEquationTest, RealRootsTest) {
     ASSERT_EQ(x.size(), 1);
     EXPECT_NEAR(x[0], 1.0, 1e-6);
   }
-}
\ No newline at end of file
+}
+
+TEST(CubicEquationTest, RealRootsWithoutAllocationTest) {
+  // x^3 -x = (x - 1)(x + 1)x =0
+  {
+    eos::cubic_equation eq(0.0, -1.0, 0.0);
+    std::array<double, 3> x;
+    ASSERT_EQ(eq.real_roots(x), 3);
+    EXPECT_NEAR(x[0], -1.0, 1e-6);
+    EXPECT_NEAR(x[1], 0.0, 1e-6);
+    EXPECT_NEAR(x[2], 1.0, 1e-6);
+  }
+
+  // x^3 - 1 = (x - 1)(x^2 + x + 1) =0
+  {
+    eos::cubic_equation eq(0.0, 0.0, -1.0);
+    std::array<double, 3> x;
+    ASSERT_EQ(eq.real_roots(x), 1);
+    EXPECT_NEAR(x[0], 1.0, 1e-6);
+  }
+}
+
+TEST(CubicEquationTest, DiscriminantTest) {
+  // x^3 -x = (x - 1)(x + 1)x =0
+  EXPECT_NEAR(eos::cubic_equation(0.0, -1.0, 0.0).discriminant(), 4.0, 1e-12);
+  // x^3 - 1 = (x - 1)(x^2 + x + 1) =0
+  EXPECT_NEAR(eos::cubic_equation(0.0, 0.0, -1.0).discriminant(), -27.0,
+              1e-12);
+  // x^3 - 3x^2 + 3x - 1 = (x - 1)^3 = 0
+  EXPECT_NEAR(eos::cubic_equation(-3.0, 3.0, -1.0).discriminant(), 0.0,
+              1e-12);
+}
@@ -0,0 +1,168 @@
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "eos/cubic_eos/peng_robinson_eos.hpp"
+#include "eos/cubic_eos/vapor_liquid_flash.hpp"
+#include "eos/cubic_eos/vapor_pressure_estimator.hpp"
+#include "eos/viscosity/lucas_method.hpp"
+
+#ifndef EOS_BATCH_PATH
+#error EOS_BATCH_PATH must be defined as the path of eos_batch
+#endif
+
+class EosBatchTest : public ::testing::Test {
+ protected:
+  // Methane
+  static constexpr double pc = 4e6;       // Critical pressure [Pa]
+  static constexpr double tc = 190.6;     // Critical temperature [K]
+  static constexpr double omega = 0.008;  // Acentric factor
+  static constexpr double zc = 0.286;     // Critical Z-factor
+  static constexpr double mw = 16.043;    // Molecular weight [kg/kmol]
+
+  EosBatchTest()
+      : prefix_{"/tmp/eoscpp-batch-" + std::to_string(::getpid())},
+        input_{prefix_ + ".in"},
+        output_{prefix_ + ".out"},
+        eos_{eos::make_peng_robinson_eos(pc, tc, omega)},
+        flash_{eos::make_vapor_liquid_flash(eos_)},
+        lucas_{eos::make_lucas_method(pc, tc, zc, mw, 0.0, 0.0)} {
+    // Some temperatures are above the critical temperature
+    for (std::size_t i = 0; i < 50; ++i) {
+      p_.push_back(1e5 * (i + 1));
+      t_.push_back(150.0 + i);
+    }
+  }
+
+  ~EosBatchTest() {
+    std::remove(input_.c_str());
+    std::remove(output_.c_str());
+  }
+
+  /// @brief Runs eos_batch with options followed by input and output
+  int run(const std::string &options) const {
+    const auto command = std::string(EOS_BATCH_PATH) +
+                         " --pc 4e6 --tc 190.6 --omega 0.008 --zc 0.286" +
+                         " --mw 16.043 " + options + " " + input_ + " " +
+                         output_ + " 2>/dev/null";
+    return std::system(command.c_str());
+  }
+
+  /// @brief Computes the properties of all the kinds by the library
+  std::vector<double> expected(double p, double t,
+                               eos::vapor_pressure_guess guess) {
+    flash_.set_initial_guess({guess, pc, tc, omega});
+    const auto state = eos_.create_isobaric_isothermal_state(p, t);
+    const auto z = state.zfactor(eos::root_selection::stable);
+    auto psat = std::nan("");
+    if (t < tc) {
+      const auto [ps, r] = flash_.vapor_pressure(t);
+      if (r.error == eos::flash_iteration_error::success) {
+        psat = ps;
+      }
+    }
+    return {p,
+            t,
+            z,
+            state.ln_fugacity_coeff(z),
+            state.residual_enthalpy(z),
+            state.residual_entropy(z),
+            lucas_.viscosity_at_high_pressure(p, t),
+            psat};
+  }
+
+  static void expect_equal(const std::vector<double> &x,
+                           const std::vector<double> &y) {
+    ASSERT_EQ(x.size(), y.size());
+    for (std::size_t i = 0; i < x.size(); ++i) {
+      if (std::isnan(y[i])) {
+        EXPECT_TRUE(std::isnan(x[i]));
+      } else {
+        EXPECT_EQ(x[i], y[i]);
+      }
+    }
+  }
+
+  std::string prefix_;
+  std::string input_;
+  std::string output_;
+  eos::peng_robinson_eos eos_;
+  eos::vapor_liquid_flash<eos::peng_robinson_eos> flash_;
+  eos::lucas_method lucas_;
+  std::vector<double> p_;
+  std::vector<double> t_;
+};
+
+TEST_F(EosBatchTest, CsvTest) {
+  {
+    // Lines which are not rows of numbers are skipped
+    std::ofstream file(input_);
+    file << "p,t\n";
+    for (std::size_t i = 0; i < p_.size(); ++i) {
+      file << p_[i] << ", " << t_[i] << "\r\n";
+    }
+  }
+  // Small chunks split the input among threads
+  ASSERT_EQ(run("--properties z,lnphi,hres,sres,visc,psat --chunk 64 "
+                "--threads 3"),
+            0);
+
+  std::ifstream file(output_);
+  std::string line;
+  ASSERT_TRUE(std::getline(file, line));
+  EXPECT_EQ(line, "p,t,z,lnphi,hres,sres,visc,psat");
+  std::size_t i = 0;
+  for (; std::getline(file, line); ++i) {
+    ASSERT_LT(i, p_.size());
+    std::vector<double> x;
+    std::istringstream ss(line);
+    std::string field;
+    while (std::getline(ss, field, ',')) {
+      x.push_back(std::strtod(field.c_str(), nullptr));
+    }
+    expect_equal(x, expected(p_[i], t_[i], eos::vapor_pressure_guess::wilson));
+  }
+  EXPECT_EQ(i, p_.size());
+}
+
+TEST_F(EosBatchTest, BinaryTest) {
+  {
+    std::ofstream file(input_, std::ios::binary);
+    for (std::size_t i = 0; i < p_.size(); ++i) {
+      const double row[2] = {p_[i], t_[i]};
+      file.write(reinterpret_cast<const char *>(row), sizeof(row));
+    }
+  }
+  ASSERT_EQ(run("--binary --properties z,lnphi,hres,sres,visc,psat "
+                "--guess lee-kesler --chunk 100 --threads 2"),
+            0);
+
+  std::ifstream file(output_, std::ios::binary);
+  std::vector<double> x(8);
+  std::size_t i = 0;
+  while (file.read(reinterpret_cast<char *>(x.data()),
+                   static_cast<std::streamsize>(x.size() * sizeof(double)))) {
+    ASSERT_LT(i, p_.size());
+    expect_equal(x,
+                 expected(p_[i], t_[i], eos::vapor_pressure_guess::lee_kesler));
+    ++i;
+  }
+  EXPECT_EQ(i, p_.size());
+}
+
+TEST_F(EosBatchTest, InvalidOptionsTest) {
+  {
+    std::ofstream file(input_);
+    file << "1e6,200\n";
+  }
+  EXPECT_NE(run("--properties density"), 0);
+  EXPECT_NE(run("--guess unknown"), 0);
+  EXPECT_NE(run("--eos vdw"), 0);
+}
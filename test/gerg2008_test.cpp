@@ -0,0 +1,323 @@
+#include "eos/gerg/gerg2008.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+#include "eos/common/thermodynamic_constants.hpp"
+#include "eos/gerg/gerg2008_parameters.hpp"
+
+namespace {
+
+// Critical properties of methane and ethane with synthetic terms
+eos::gerg_component make_component(double tc, double rhoc, double pc,
+                                   double omega) {
+  return {tc,
+          rhoc,
+          pc,
+          omega,
+          {{0.5, 1, 0.125, 0},
+           {-1.6, 1, 1.125, 0},
+           {0.2, 2, 0.375, 0},
+           {0.3, 2, 1.5, 1},
+           {-0.2, 3, 2.5, 2},
+           {0.05, 4, 3.0, 3}}};
+}
+
+}  // namespace
+
+class Gerg2008Test : public ::testing::Test {
+ protected:
+  Gerg2008Test()
+      : methane_{make_component(190.564, 10139.128, 4.5992e6, 0.011)},
+        ethane_{make_component(305.322, 6870.854, 4.8722e6, 0.099)} {}
+
+  eos::gerg_component methane_;
+  eos::gerg_component ethane_;
+};
+
+TEST_F(Gerg2008Test, ReducingFunctionTest) {
+  using namespace eos;
+  gerg_binary b{0, 1, 0.99, 1.02, 0.98, 1.03, 0.0, {}};
+  const gerg2008_eos eos1({methane_, ethane_}, {b});
+  std::swap(b.i, b.j);
+  const gerg2008_eos eos2({ethane_, methane_}, {b});
+
+  const std::vector<double> pure = {1.0, 0.0};
+  const auto m = eos1.create_mixture(pure);
+  EXPECT_DOUBLE_EQ(m.reducing_temperature(), methane_.tc);
+  EXPECT_DOUBLE_EQ(m.reducing_density(), methane_.rhoc);
+
+  // Invariant under the exchange of components
+  const std::vector<double> x = {0.3, 0.7}, y = {0.7, 0.3};
+  const auto m1 = eos1.create_mixture(x);
+  const auto m2 = eos2.create_mixture(y);
+  EXPECT_NEAR(m1.reducing_temperature(), m2.reducing_temperature(), 1e-10);
+  EXPECT_NEAR(m1.reducing_density(), m2.reducing_density(), 1e-8);
+}
+
+TEST_F(Gerg2008Test, DerivativeTest) {
+  using namespace eos;
+  const gerg_binary b{0,
+                      1,
+                      0.99,
+                      1.02,
+                      0.98,
+                      1.03,
+                      1.0,
+                      {{0.1, 1, 1.0, 0.0, 0.0, 0.0, 0.0},
+                       {-0.2, 2, 1.5, 1.0, 0.5, 0.5, 0.5}}};
+  const gerg2008_eos eos({methane_, ethane_}, {b});
+  const std::vector<double> x = {0.8, 0.2};
+  const auto line = eos.create_mixture(x).create_isothermal_line(250.0);
+
+  const auto h = 1e-6;
+  for (const auto delta : {0.01, 0.5, 1.0, 2.0}) {
+    const auto r = line.evaluate(delta);
+    const auto r1 = line.evaluate(delta - h);
+    const auto r2 = line.evaluate(delta + h);
+    EXPECT_NEAR(r.da, delta * (r2.a - r1.a) / (2 * h), 1e-8);
+    EXPECT_NEAR(r.d2a, delta * (r2.da - r1.da) / (2 * h) - r.da, 1e-7);
+  }
+}
+
+TEST_F(Gerg2008Test, DensityTest) {
+  using namespace eos;
+  constexpr auto R = gas_constant<double>();
+  // Z = 1 + B delta
+  const auto b = -0.3;
+  gerg_component virial = methane_;
+  virial.terms = {{b, 1, 0.0, 0}};
+  const gerg2008_eos eos({virial}, {});
+  const std::vector<double> x = {1.0};
+  const auto mixture = eos.create_mixture(x);
+
+  const auto t = 300.0;
+  for (const auto p : {1e5, 1e6, 1e7}) {
+    // p = rho R T (1 + B rho / rhoc)
+    const auto k = b / virial.rhoc;
+    const auto expected =
+        (-1 + std::sqrt(1 + 4 * k * p / (R * t))) / (2 * k);
+    EXPECT_NEAR(mixture.density(p, t), expected, 1e-10 * expected);
+    EXPECT_NEAR(mixture.zfactor(p, t), 1 + b * expected / virial.rhoc,
+                1e-12);
+  }
+}
+
+TEST_F(Gerg2008Test, MixtureTest) {
+  using namespace eos;
+  const gerg2008_eos eos({methane_, ethane_}, {});
+  const std::vector<double> x = {0.9, 0.1};
+  const auto mixture = eos.create_mixture(x);
+
+  const std::vector<double> p = {1e5, 1e6, 5e6, 1e5, 1e6, 5e6};
+  const std::vector<double> t = {250.0, 250.0, 250.0, 300.0, 300.0, 300.0};
+  std::vector<double> rho(p.size()), z(p.size());
+  mixture.density(p, t, rho);
+  mixture.zfactor(p, t, z);
+  const auto line = mixture.create_isothermal_line(300.0);
+  for (std::size_t i = 0; i < p.size(); ++i) {
+    EXPECT_DOUBLE_EQ(rho[i], mixture.density(p[i], t[i]));
+    EXPECT_DOUBLE_EQ(z[i], mixture.zfactor(p[i], t[i]));
+    if (t[i] == 300.0) {
+      EXPECT_NEAR(line.pressure(rho[i]), p[i], 1e-8 * p[i]);
+    }
+  }
+
+  // Identical components give the pure component
+  const gerg2008_eos same({methane_, methane_}, {});
+  const std::vector<double> y = {0.4, 0.6}, pure = {1.0};
+  const gerg2008_eos single({methane_}, {});
+  EXPECT_NEAR(same.create_mixture(y).zfactor(5e6, 250.0),
+              single.create_mixture(pure).zfactor(5e6, 250.0), 1e-12);
+}
+
+TEST_F(Gerg2008Test, InvalidArgumentTest) {
+  using namespace eos;
+  const gerg_binary b{0, 1, 1.0, 1.0, 1.0, 1.0, 0.0, {}};
+  EXPECT_THROW(gerg2008_eos({methane_}, {b}), std::invalid_argument);
+  auto c = methane_;
+  c.terms.push_back({1.0, gerg2008_eos::max_exponent + 1, 0.0, 0});
+  EXPECT_THROW(gerg2008_eos({c}, {}), std::invalid_argument);
+
+  const gerg2008_eos eos({methane_, ethane_}, {});
+  const std::vector<double> x = {1.0};
+  EXPECT_THROW(eos.create_mixture(x), std::invalid_argument);
+  const std::vector<double> y = {0.5, 0.5};
+  std::vector<double> ln_phi(1);
+  EXPECT_THROW(eos.ln_fugacity_coeffs(y, 1e6, 300.0, ln_phi),
+               std::invalid_argument);
+}
+
+TEST_F(Gerg2008Test, FugacityCoeffTest) {
+  using namespace eos;
+  constexpr auto R = gas_constant<double>();
+  const gerg_binary b{0,
+                      1,
+                      0.99,
+                      1.02,
+                      0.98,
+                      1.03,
+                      1.0,
+                      {{0.1, 1, 1.0, 0.0, 0.0, 0.0, 0.0},
+                       {-0.2, 2, 1.5, 1.0, 0.5, 0.5, 0.5}}};
+  const gerg2008_eos eos({methane_, ethane_}, {b});
+  const auto t = 250.0, p = 3e6;
+  const std::vector<double> x = {0.8, 0.2};
+  std::vector<double> ln_phi(2);
+  eos.ln_fugacity_coeffs(x, p, t, ln_phi);
+
+  // Derivatives of the residual Helmholtz energy at constant volume
+  const auto helmholtz = [&eos, t](double rho, double n0, double n1) {
+    const auto n = n0 + n1;
+    const std::vector<double> y = {n0 / n, n1 / n};
+    const auto m = eos.create_mixture(y);
+    const auto delta = n * rho / m.reducing_density();
+    return n * m.create_isothermal_line(t).evaluate(delta).a;
+  };
+  const auto h = 1e-6;
+  const auto rho = eos.create_mixture(x).density(p, t);
+  const auto ln_z = std::log(p / (rho * R * t));
+  const auto d0 =
+      helmholtz(rho, x[0] + h, x[1]) - helmholtz(rho, x[0] - h, x[1]);
+  const auto d1 =
+      helmholtz(rho, x[0], x[1] + h) - helmholtz(rho, x[0], x[1] - h);
+  EXPECT_NEAR(ln_phi[0], d0 / (2 * h) - ln_z, 1e-7);
+  EXPECT_NEAR(ln_phi[1], d1 / (2 * h) - ln_z, 1e-7);
+
+  // A pure component, and the other component at infinite dilution
+  const std::vector<double> pure = {1.0, 0.0};
+  eos.ln_fugacity_coeffs(pure, p, t, ln_phi);
+  const auto rho0 = eos.create_mixture(pure).density(p, t);
+  const auto r = eos.create_mixture(pure).create_isothermal_line(t).evaluate(
+      rho0 / methane_.rhoc);
+  const auto ln_z0 = std::log(1 + r.da);
+  EXPECT_NEAR(ln_phi[0], r.a + r.da - ln_z0, 1e-12);
+  EXPECT_NEAR(ln_phi[1],
+              (helmholtz(rho0, 1.0, h) - helmholtz(rho0, 1.0, 0.0)) / h - ln_z0,
+              1e-5);
+}
+
+TEST(Gerg2008ParametersTest, CriticalPointTest) {
+  // Equations of components give the critical pressures within 0.3% and
+  // nearly zero slopes of pressure at the critical temperatures and densities
+  using namespace eos;
+  const auto components = gerg2008_components();
+  ASSERT_EQ(components.size(), num_gerg_species);
+  for (const auto &c : components) {
+    const gerg2008_eos eos({c}, {});
+    const std::vector<double> x = {1.0};
+    const auto line = eos.create_mixture(x).create_isothermal_line(c.tc);
+    const auto h = 1e-4 * c.rhoc;
+    const auto dp =
+        (line.pressure(c.rhoc + h) - line.pressure(c.rhoc - h)) / (2 * h);
+    EXPECT_NEAR(line.pressure(c.rhoc), c.pc, 3e-3 * c.pc) << c.tc;
+    EXPECT_NEAR(dp * c.rhoc / c.pc, 0.0, 2e-2) << c.tc;
+  }
+}
+
+TEST(Gerg2008ParametersTest, SaturationTest) {
+  // Liquid and vapor have equal Gibbs energies at the normal boiling points,
+  // and at the triple point of carbon dioxide. The residual of g / RT is
+  // about the relative error of the vapor pressure.
+  using namespace eos;
+  struct saturation {
+    gerg_species s;
+    double t;
+    double p;
+  };
+  const saturation data[] = {
+      {gerg_species::methane, 111.667, 101325.0},
+      {gerg_species::nitrogen, 77.355, 101325.0},
+      {gerg_species::carbon_dioxide, 216.592, 517950.0},
+      {gerg_species::ethane, 184.569, 101325.0},
+      {gerg_species::propane, 231.036, 101325.0},
+      {gerg_species::isobutane, 261.401, 101325.0},
+      {gerg_species::n_butane, 272.66, 101325.0},
+      {gerg_species::isopentane, 300.98, 101325.0},
+      {gerg_species::n_pentane, 309.21, 101325.0},
+      {gerg_species::n_hexane, 341.86, 101325.0},
+      {gerg_species::n_heptane, 371.53, 101325.0},
+      {gerg_species::n_octane, 398.77, 101325.0},
+      {gerg_species::n_nonane, 423.91, 101325.0},
+      {gerg_species::n_decane, 447.27, 101325.0},
+      {gerg_species::hydrogen, 20.369, 101325.0},
+      {gerg_species::oxygen, 90.188, 101325.0},
+      {gerg_species::carbon_monoxide, 81.64, 101325.0},
+      {gerg_species::water, 373.124, 101325.0},
+      {gerg_species::hydrogen_sulfide, 212.85, 101325.0},
+      {gerg_species::helium, 4.2226, 101325.0},
+      {gerg_species::argon, 87.302, 101325.0},
+  };
+  constexpr auto R = gas_constant<double>();
+  const auto components = gerg2008_components();
+  for (const auto &d : data) {
+    const auto &c = components[static_cast<std::size_t>(d.s)];
+    const gerg2008_eos eos({c}, {});
+    const std::vector<double> x = {1.0};
+    const auto line = eos.create_mixture(x).create_isothermal_line(d.t);
+    const auto rho_l = line.density(d.p, 3 * c.rhoc);
+    const auto rho_v = line.density(d.p, d.p / (R * d.t));
+    ASSERT_GT(rho_l, 2 * rho_v) << d.t;
+    const auto g = [&line, &c](double rho) {
+      const auto r = line.evaluate(rho / c.rhoc);
+      return r.a + r.da + std::log(rho);
+    };
+    EXPECT_NEAR(g(rho_l), g(rho_v), 5e-3) << d.t;
+  }
+}
+
+TEST(Gerg2008ParametersTest, ReferenceTest) {
+  // The gas of AGA Report No. 8 Part 2 has the density of 12.79828626 mol/L
+  // and Z-factor of 1.17469067 at 400 K and 50 MPa
+  using namespace eos;
+  const auto eos = make_gerg2008_eos();
+  const std::vector<double> x = {
+      0.77824, 0.02,    0.06,    0.08,    0.03,    0.0015,  0.003,
+      0.0005,  0.00165, 0.00215, 0.00088, 0.00024, 0.00015, 0.00009,
+      0.004,   0.005,   0.002,   0.0001,  0.0025,  0.007,   0.001};
+  const auto t = 400.0, p = 50e6;
+  const auto mixture = eos.create_mixture(x);
+  const auto rho = mixture.density(p, t);
+  EXPECT_NEAR(rho, 12798.28626, 2e-6 * 12798.28626);
+  EXPECT_NEAR(mixture.zfactor(p, t), 1.17469067, 3e-6 * 1.17469067);
+
+  std::vector<double> ln_phi(num_gerg_species);
+  eos.ln_fugacity_coeffs(x, p, t, ln_phi);
+  const auto r = mixture.create_isothermal_line(t).evaluate(
+      rho / mixture.reducing_density());
+  const auto ln_z = std::log(1 + r.da);
+  double sum = 0.0;
+  for (std::size_t i = 0; i < x.size(); ++i) {
+    sum += x[i] * ln_phi[i];
+  }
+  EXPECT_NEAR(sum, r.a + r.da - ln_z, 1e-12);
+
+  // Derivatives of the residual Helmholtz energy at constant volume
+  const auto helmholtz = [&eos, rho, t](std::vector<double> n) {
+    double sum_n = 0.0;
+    for (const auto ni : n) {
+      sum_n += ni;
+    }
+    for (auto &ni : n) {
+      ni /= sum_n;
+    }
+    const auto m = eos.create_mixture(n);
+    const auto delta = sum_n * rho / m.reducing_density();
+    return sum_n * m.create_isothermal_line(t).evaluate(delta).a;
+  };
+  const auto h = 1e-6;
+  for (const auto s : {gerg_species::methane, gerg_species::nitrogen,
+                       gerg_species::carbon_dioxide, gerg_species::n_butane,
+                       gerg_species::hydrogen, gerg_species::helium}) {
+    const auto i = static_cast<std::size_t>(s);
+    auto n1 = x, n2 = x;
+    n1[i] -= h;
+    n2[i] += h;
+    EXPECT_NEAR(ln_phi[i], (helmholtz(n2) - helmholtz(n1)) / (2 * h) - ln_z,
+                1e-7)
+        << i;
+  }
+}
@@ -0,0 +1,233 @@
+#include "eos/water/iapws_if97.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+// Verification values are taken from the release of IAPWS-IF97.
+
+TEST(IapwsIf97Test, Region1Test) {
+  using eos::iapws_if97;
+  const auto x1 = iapws_if97::liquid_properties(3e6, 300.0);
+  EXPECT_NEAR(x1.v, 0.100215168e-2, 1e-11);
+  EXPECT_NEAR(x1.h, 115.331273e3, 1e-3);
+  EXPECT_NEAR(x1.s, 0.392294792e3, 1e-5);
+  EXPECT_NEAR(x1.cp, 4.17301218e3, 1e-4);
+  EXPECT_NEAR(x1.w, 1507.73921, 1e-5);
+
+  const auto x2 = iapws_if97::liquid_properties(80e6, 300.0);
+  EXPECT_NEAR(x2.v, 0.971180894e-3, 1e-11);
+  EXPECT_NEAR(x2.h, 184.142828e3, 1e-3);
+  EXPECT_NEAR(x2.s, 0.368563852e3, 1e-5);
+
+  const auto x3 = iapws_if97::liquid_properties(3e6, 500.0);
+  EXPECT_NEAR(x3.v, 0.120241800e-2, 1e-11);
+  EXPECT_NEAR(x3.h, 975.542239e3, 1e-3);
+  EXPECT_NEAR(x3.s, 2.58041912e3, 1e-4);
+}
+
+TEST(IapwsIf97Test, Region2Test) {
+  using eos::iapws_if97;
+  const auto x1 = iapws_if97::vapor_properties(3500.0, 300.0);
+  EXPECT_NEAR(x1.v, 39.4913866, 1e-7);
+  EXPECT_NEAR(x1.h, 2549.91145e3, 1e-2);
+  EXPECT_NEAR(x1.s, 8.52238967e3, 1e-4);
+  EXPECT_NEAR(x1.cp, 1.91300162e3, 1e-4);
+  EXPECT_NEAR(x1.w, 427.920172, 1e-6);
+
+  const auto x2 = iapws_if97::vapor_properties(3500.0, 700.0);
+  EXPECT_NEAR(x2.v, 92.3015898, 1e-7);
+  EXPECT_NEAR(x2.h, 3335.68375e3, 1e-2);
+  EXPECT_NEAR(x2.s, 10.1749996e3, 1e-4);
+
+  const auto x3 = iapws_if97::vapor_properties(30e6, 700.0);
+  EXPECT_NEAR(x3.v, 0.542946619e-2, 1e-11);
+  EXPECT_NEAR(x3.h, 2631.49474e3, 1e-2);
+  EXPECT_NEAR(x3.s, 5.17540298e3, 1e-5);
+}
+
+TEST(IapwsIf97Test, Region3Test) {
+  using eos::iapws_if97;
+  // Pressures of the verification values at given densities
+  const auto x1 = iapws_if97::near_critical_properties(25.5837018e6, 650.0);
+  EXPECT_NEAR(x1.v, 1 / 500.0, 1e-11);
+  EXPECT_NEAR(x1.h, 1863.43019e3, 1e-2);
+  EXPECT_NEAR(x1.s, 4.05427273e3, 1e-5);
+  EXPECT_NEAR(x1.cp, 13.8935717e3, 1e-3);
+  EXPECT_NEAR(x1.w, 502.005554, 1e-5);
+
+  // Near the critical point, the rounding of pressure changes density more
+  const auto x2 = iapws_if97::near_critical_properties(22.2930643e6, 650.0);
+  EXPECT_NEAR(x2.v, 1 / 200.0, 1e-10);
+  EXPECT_NEAR(x2.h, 2375.12401e3, 5e-2);
+  EXPECT_NEAR(x2.s, 4.85438792e3, 5e-5);
+
+  const auto x3 = iapws_if97::near_critical_properties(78.3095639e6, 750.0);
+  EXPECT_NEAR(x3.v, 1 / 500.0, 1e-11);
+  EXPECT_NEAR(x3.h, 2258.68845e3, 1e-2);
+  EXPECT_NEAR(x3.s, 4.46971906e3, 1e-5);
+
+  // Below the critical temperature, the liquid and vapor branches are
+  // separated by the saturation pressure
+  const auto ts = iapws_if97::saturation_temperature(20e6);
+  const auto liquid = iapws_if97::near_critical_properties(20e6, ts - 0.1);
+  const auto vapor = iapws_if97::near_critical_properties(20e6, ts + 0.1);
+  EXPECT_GT(1 / liquid.v, 450.0);
+  EXPECT_LT(1 / vapor.v, 200.0);
+  EXPECT_GT(vapor.h - liquid.h, 500e3);
+}
+
+TEST(IapwsIf97Test, Region3BoundaryTest) {
+  using eos::iapws_if97;
+  // Equations of adjacent regions agree at the boundaries, e.g. at 355
+  // Celsius degrees, which is in region 3 above 17.6 MPa
+  for (const auto p : {20e6, 50e6, 100e6}) {
+    const auto x1 = iapws_if97::liquid_properties(p, 623.15);
+    const auto x3 = iapws_if97::near_critical_properties(p, 623.15);
+    EXPECT_NEAR(x3.v, x1.v, 1e-3 * x1.v);
+    EXPECT_NEAR(x3.h, x1.h, 1e-3 * x1.h);
+    EXPECT_NEAR(x3.s, x1.s, 1e-3 * x1.s);
+  }
+  for (const auto t : {650.0, 700.0, 800.0}) {
+    const auto p = iapws_if97::boundary23_pressure(t);
+    const auto x2 = iapws_if97::vapor_properties(p, t);
+    const auto x3 = iapws_if97::near_critical_properties(p, t);
+    EXPECT_NEAR(x3.v, x2.v, 1e-3 * x2.v);
+    EXPECT_NEAR(x3.h, x2.h, 1e-3 * x2.h);
+    EXPECT_NEAR(x3.s, x2.s, 1e-3 * x2.s);
+  }
+  const auto x = iapws_if97::properties(20e6, 628.15);
+  EXPECT_EQ(iapws_if97::region(20e6, 628.15),
+            eos::if97_region::near_critical);
+  EXPECT_DOUBLE_EQ(x.v, iapws_if97::near_critical_properties(20e6, 628.15).v);
+  EXPECT_LT(x.v, iapws_if97::liquid_properties(20e6, 623.15).v * 1.1);
+}
+
+TEST(IapwsIf97Test, SaturationTest) {
+  using eos::iapws_if97;
+  EXPECT_NEAR(iapws_if97::saturation_pressure(300.0), 0.353658941e4, 1e-5);
+  EXPECT_NEAR(iapws_if97::saturation_pressure(500.0), 2.63889776e6, 1e-2);
+  EXPECT_NEAR(iapws_if97::saturation_pressure(600.0), 12.3443146e6, 1e-1);
+  EXPECT_NEAR(iapws_if97::saturation_temperature(0.1e6), 372.755919, 1e-6);
+  EXPECT_NEAR(iapws_if97::saturation_temperature(1e6), 453.035632, 1e-6);
+  EXPECT_NEAR(iapws_if97::saturation_temperature(10e6), 584.149488, 1e-6);
+  EXPECT_NEAR(iapws_if97::boundary23_pressure(623.15), 16.5291643e6, 1e-1);
+  EXPECT_NEAR(iapws_if97::boundary23_temperature(16.5291643e6), 623.15,
+              1e-6);
+  EXPECT_TRUE(std::isnan(iapws_if97::saturation_pressure(700.0)));
+}
+
+TEST(IapwsIf97Test, RegionTest) {
+  using eos::iapws_if97;
+  using eos::if97_region;
+  EXPECT_EQ(iapws_if97::region(3e6, 300.0), if97_region::liquid);
+  EXPECT_EQ(iapws_if97::region(3500.0, 300.0), if97_region::vapor);
+  EXPECT_EQ(iapws_if97::region(30e6, 700.0), if97_region::vapor);
+  EXPECT_EQ(iapws_if97::region(30e6, 650.0), if97_region::near_critical);
+  EXPECT_EQ(iapws_if97::region(30e6, 1500.0), if97_region::high_temperature);
+  EXPECT_EQ(iapws_if97::region(3e6, 250.0), if97_region::out_of_range);
+  EXPECT_EQ(iapws_if97::region(200e6, 500.0), if97_region::out_of_range);
+  EXPECT_TRUE(std::isnan(iapws_if97::properties(30e6, 1500.0).v));
+}
+
+TEST(IapwsIf97Test, BackwardPhTest) {
+  using eos::iapws_if97;
+  // Region 1
+  EXPECT_NEAR(iapws_if97::temperature_ph(3e6, 500e3), 391.798509, 1e-6);
+  EXPECT_NEAR(iapws_if97::temperature_ph(80e6, 500e3), 378.108626, 1e-6);
+  EXPECT_NEAR(iapws_if97::temperature_ph(80e6, 1500e3), 611.041229, 1e-6);
+  // Region 2a
+  EXPECT_NEAR(iapws_if97::temperature_ph(1e3, 3000e3), 534.433241, 1e-6);
+  EXPECT_NEAR(iapws_if97::temperature_ph(3e6, 3000e3), 575.373370, 1e-6);
+  EXPECT_NEAR(iapws_if97::temperature_ph(3e6, 4000e3), 1010.77577, 1e-5);
+  // Region 2b
+  EXPECT_NEAR(iapws_if97::temperature_ph(5e6, 3500e3), 801.299102, 1e-6);
+  EXPECT_NEAR(iapws_if97::temperature_ph(5e6, 4000e3), 1015.31583, 1e-5);
+  EXPECT_NEAR(iapws_if97::temperature_ph(25e6, 3500e3), 875.279054, 1e-6);
+  // Region 2c
+  EXPECT_NEAR(iapws_if97::temperature_ph(40e6, 2700e3), 743.056411, 1e-6);
+  EXPECT_NEAR(iapws_if97::temperature_ph(60e6, 2700e3), 791.137067, 1e-6);
+  EXPECT_NEAR(iapws_if97::temperature_ph(60e6, 3200e3), 882.756860, 1e-6);
+  // Two-phase region
+  EXPECT_NEAR(iapws_if97::temperature_ph(1e6, 1500e3), 453.035632, 1e-6);
+  // Region 3a
+  EXPECT_NEAR(iapws_if97::temperature_ph(20e6, 1700e3), 629.3083892, 1e-6);
+  EXPECT_NEAR(iapws_if97::temperature_ph(50e6, 2000e3), 690.5718338, 1e-6);
+  EXPECT_NEAR(iapws_if97::temperature_ph(100e6, 2100e3), 733.6163014, 1e-6);
+  // Region 3b
+  EXPECT_NEAR(iapws_if97::temperature_ph(20e6, 2500e3), 641.8418053, 1e-6);
+  EXPECT_NEAR(iapws_if97::temperature_ph(50e6, 2400e3), 735.1848618, 1e-6);
+  EXPECT_NEAR(iapws_if97::temperature_ph(100e6, 2700e3), 842.0460876, 1e-6);
+  // Two-phase region in region 3
+  EXPECT_NEAR(iapws_if97::temperature_ph(20e6, 2000e3),
+              iapws_if97::saturation_temperature(20e6), 1e-9);
+}
+
+TEST(IapwsIf97Test, BackwardPsTest) {
+  using eos::iapws_if97;
+  // Region 1
+  EXPECT_NEAR(iapws_if97::temperature_ps(3e6, 0.5e3), 307.842258, 1e-6);
+  EXPECT_NEAR(iapws_if97::temperature_ps(80e6, 0.5e3), 309.979785, 1e-6);
+  EXPECT_NEAR(iapws_if97::temperature_ps(80e6, 3e3), 565.899909, 1e-6);
+  // Region 2a
+  EXPECT_NEAR(iapws_if97::temperature_ps(0.1e6, 7.5e3), 399.517097, 1e-6);
+  EXPECT_NEAR(iapws_if97::temperature_ps(0.1e6, 8e3), 514.127081, 1e-6);
+  EXPECT_NEAR(iapws_if97::temperature_ps(2.5e6, 8e3), 1039.84917, 1e-5);
+  // Region 2b
+  EXPECT_NEAR(iapws_if97::temperature_ps(8e6, 6e3), 600.484040, 1e-6);
+  EXPECT_NEAR(iapws_if97::temperature_ps(8e6, 7.5e3), 1064.95556, 1e-5);
+  EXPECT_NEAR(iapws_if97::temperature_ps(90e6, 6e3), 1038.01126, 1e-5);
+  // Region 2c
+  EXPECT_NEAR(iapws_if97::temperature_ps(20e6, 5.75e3), 697.992849, 1e-6);
+  EXPECT_NEAR(iapws_if97::temperature_ps(80e6, 5.25e3), 854.011484, 1e-6);
+  EXPECT_NEAR(iapws_if97::temperature_ps(80e6, 5.75e3), 949.017998, 1e-6);
+  // Region 3a
+  EXPECT_NEAR(iapws_if97::temperature_ps(20e6, 3.8e3), 628.2959869, 1e-6);
+  EXPECT_NEAR(iapws_if97::temperature_ps(50e6, 3.6e3), 629.7158726, 1e-6);
+  EXPECT_NEAR(iapws_if97::temperature_ps(100e6, 4e3), 705.6880237, 1e-6);
+  // Region 3b
+  EXPECT_NEAR(iapws_if97::temperature_ps(20e6, 5e3), 640.1176443, 1e-6);
+  EXPECT_NEAR(iapws_if97::temperature_ps(50e6, 4.5e3), 716.3687517, 1e-6);
+  EXPECT_NEAR(iapws_if97::temperature_ps(100e6, 5e3), 847.4332825, 1e-6);
+  // Two-phase region in region 3
+  EXPECT_NEAR(iapws_if97::temperature_ps(20e6, 4.4e3),
+              iapws_if97::saturation_temperature(20e6), 1e-9);
+}
+
+TEST(IapwsIf97Test, ConsistencyTest) {
+  using eos::iapws_if97;
+  // Backward equations are consistent with the forward ones within the
+  // tolerances of IAPWS-IF97
+  for (const auto p : {0.01e6, 1e6, 10e6, 20e6, 50e6}) {
+    for (const auto t : {300.0, 400.0, 550.0, 630.0, 660.0, 800.0, 1000.0}) {
+      const auto x = iapws_if97::properties(p, t);
+      if (std::isnan(x.h)) {
+        continue;
+      }
+      EXPECT_NEAR(iapws_if97::temperature_ph(p, x.h), t, 25e-3);
+      EXPECT_NEAR(iapws_if97::temperature_ps(p, x.s), t, 25e-3);
+    }
+  }
+}
+
+TEST(IapwsIf97Test, BatchTest) {
+  using eos::iapws_if97;
+  const std::vector<double> p = {3e6, 3500.0, 30e6};
+  const std::vector<double> t = {300.0, 300.0, 700.0};
+  std::vector<double> rho(p.size()), h(p.size()), t2(p.size());
+  iapws_if97::density(p, t, rho);
+  iapws_if97::enthalpy(p, t, h);
+  iapws_if97::temperature_ph(p, h, t2);
+  for (std::size_t i = 0; i < p.size(); ++i) {
+    const auto x = iapws_if97::properties(p[i], t[i]);
+    EXPECT_DOUBLE_EQ(rho[i], 1 / x.v);
+    EXPECT_DOUBLE_EQ(h[i], x.h);
+    EXPECT_NEAR(t2[i], t[i], 25e-3);
+  }
+
+  std::vector<double> ps(t.size());
+  iapws_if97::saturation_pressure(t, ps);
+  EXPECT_DOUBLE_EQ(ps[0], iapws_if97::saturation_pressure(300.0));
+  EXPECT_TRUE(std::isnan(ps[2]));
+}
@@ -0,0 +1,131 @@
+#include "eos/cubic_eos/isobaric_flash.hpp"
+
+#include <gtest/gtest.h>
+
+#include "eos/cubic_eos/peng_robinson_eos.hpp"
+
+namespace {
+
+// Methane
+const double pc = 4e6;       // Critical pressure [Pa]
+const double tc = 190.6;     // Critical temperature [K]
+const double omega = 0.008;  // Acentric factor
+
+// Ideal gas heat capacity of methane taken from Appendix A of Poling et al.
+// 2001. "The Properties of Gases and Liquids", fifth edition.
+const auto cp = eos::make_ideal_gas_heat_capacity(4.568, -8.975e-3, 3.631e-5,
+                                                  -3.407e-8, 1.091e-11);
+
+}  // namespace
+
+TEST(IsobaricFlashTest, PressureEnthalpyFlashTest) {
+  using namespace eos;
+  const auto eos = make_peng_robinson_eos(pc, tc, omega);
+  const auto flash = make_isobaric_flash(eos, cp);
+
+  const auto enthalpy = [&eos](double p, double t, bool liquid) {
+    const auto state = eos.create_isobaric_isothermal_state(p, t);
+    const auto z = state.zfactor();
+    return cp.enthalpy(t) +
+           state.residual_enthalpy(liquid ? z.front() : z.back());
+  };
+
+  // Supercritical fluid
+  {
+    const double p = 5e6;
+    const double t = 250.0;
+    const auto r = flash.ph_flash(p, enthalpy(p, t, false), 300.0);
+    EXPECT_EQ(r.report.error, flash_iteration_error::success);
+    EXPECT_NEAR(r.t, t, 1e-4);
+    EXPECT_EQ(r.vapor_fraction, 1.0);
+  }
+
+  const double p = 2e6;
+  const auto t0 = estimate_saturation_temperature(p, pc, tc, omega);
+  const auto [tsat, result] =
+      make_vapor_liquid_flash(eos).saturation_temperature(t0, p);
+  ASSERT_EQ(result.error, flash_iteration_error::success);
+
+  // Two-phase
+  {
+    const auto hl = enthalpy(p, tsat, true);
+    const auto hv = enthalpy(p, tsat, false);
+    const auto r = flash.ph_flash(p, 0.7 * hl + 0.3 * hv, 200.0);
+    EXPECT_EQ(r.report.error, flash_iteration_error::success);
+    EXPECT_NEAR(r.t, tsat, 1e-6);
+    EXPECT_NEAR(r.vapor_fraction, 0.3, 1e-6);
+  }
+
+  // Subcooled liquid and superheated vapor
+  {
+    const std::vector<double> ps = {p, p};
+    const std::vector<double> hs = {enthalpy(p, tsat - 20.0, true),
+                                    enthalpy(p, tsat + 20.0, false)};
+    const std::vector<double> t_init = {tsat, tsat};
+    std::vector<isobaric_flash_result> r(2);
+    flash.ph_flash(ps, hs, t_init, r);
+    EXPECT_EQ(r[0].report.error, flash_iteration_error::success);
+    EXPECT_NEAR(r[0].t, tsat - 20.0, 1e-4);
+    EXPECT_EQ(r[0].vapor_fraction, 0.0);
+    EXPECT_EQ(r[1].report.error, flash_iteration_error::success);
+    EXPECT_NEAR(r[1].t, tsat + 20.0, 1e-4);
+    EXPECT_EQ(r[1].vapor_fraction, 1.0);
+  }
+}
+
+TEST(IsobaricFlashTest, PressureEntropyFlashTest) {
+  using namespace eos;
+  const auto eos = make_peng_robinson_eos(pc, tc, omega);
+  const auto flash = make_isobaric_flash(eos, cp);
+
+  const auto entropy = [&eos](double p, double t, bool liquid) {
+    const auto state = eos.create_isobaric_isothermal_state(p, t);
+    const auto z = state.zfactor();
+    return cp.entropy(p, t) +
+           state.residual_entropy(liquid ? z.front() : z.back());
+  };
+
+  // Residual entropy is consistent with residual heat capacity
+  {
+    const double p = 3e6;
+    const double t = 220.0;
+    const double dt = 1e-3;
+    const auto state = eos.create_isobaric_isothermal_state(p, t);
+    const auto z = state.zfactor().back();
+    const auto cp_res = state.residual_isobaric_heat_capacity(z);
+    const auto ds = (entropy(p, t + dt, false) - entropy(p, t - dt, false) -
+                     cp.entropy(p, t + dt) + cp.entropy(p, t - dt)) /
+                    (2 * dt);
+    EXPECT_NEAR(ds, cp_res / t, 1e-6);
+  }
+
+  {
+    const double p = 5e6;
+    const double t = 250.0;
+    const auto r = flash.ps_flash(p, entropy(p, t, false), 200.0);
+    EXPECT_EQ(r.report.error, flash_iteration_error::success);
+    EXPECT_NEAR(r.t, t, 1e-4);
+  }
+
+  const double p = 2e6;
+  const auto t0 = estimate_saturation_temperature(p, pc, tc, omega);
+  const auto [tsat, result] =
+      make_vapor_liquid_flash(eos).saturation_temperature(t0, p);
+  ASSERT_EQ(result.error, flash_iteration_error::success);
+
+  {
+    const auto sl = entropy(p, tsat, true);
+    const auto sv = entropy(p, tsat, false);
+    const auto r = flash.ps_flash(p, 0.4 * sl + 0.6 * sv, 150.0);
+    EXPECT_EQ(r.report.error, flash_iteration_error::success);
+    EXPECT_NEAR(r.t, tsat, 1e-6);
+    EXPECT_NEAR(r.vapor_fraction, 0.6, 1e-6);
+  }
+
+  {
+    const auto r = flash.ps_flash(p, entropy(p, tsat - 30.0, true), 150.0);
+    EXPECT_EQ(r.report.error, flash_iteration_error::success);
+    EXPECT_NEAR(r.t, tsat - 30.0, 1e-4);
+    EXPECT_EQ(r.vapor_fraction, 0.0);
+  }
+}
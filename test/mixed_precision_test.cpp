@@ -0,0 +1,78 @@
+#include "eos/cubic_eos/mixed_precision.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+#include "eos/cubic_eos/peng_robinson_eos.hpp"
+#include "eos/cubic_eos/soave_redlich_kwong_eos.hpp"
+#include "eos/cubic_eos/vapor_liquid_flash.hpp"
+
+class MixedPrecisionAccuracyTest : public ::testing::Test {
+ protected:
+  // Methane
+  static constexpr double pc = 4e6;       // Critical pressure [Pa]
+  static constexpr double tc = 190.6;     // Critical temperature [K]
+  static constexpr double omega = 0.008;  // Acentric factor
+
+  MixedPrecisionAccuracyTest() {
+    // Grid of reduced pressure 0.05-5 and reduced temperature 0.6-2,
+    // including the vicinity of the critical point
+    for (int i = 0; i < 50; ++i) {
+      for (int j = 0; j < 50; ++j) {
+        p_.push_back(pc * (0.05 + 0.1 * i));
+        t_.push_back(tc * (0.6 + 0.028 * j));
+      }
+    }
+  }
+
+  std::vector<double> p_;
+  std::vector<double> t_;
+};
+
+TEST_F(MixedPrecisionAccuracyTest, PengRobinsonTest) {
+  using namespace eos;
+  const auto eos = make_peng_robinson_eos(pc, tc, omega);
+  const auto report = measure_mixed_precision_accuracy(eos, p_, t_, 1e-7);
+  EXPECT_EQ(report.size, p_.size());
+  EXPECT_LT(report.refined, report.size);
+  EXPECT_LT(report.max_error_z, 1e-6);
+  EXPECT_LT(report.max_error_ln_phi, 1e-5);
+}
+
+TEST_F(MixedPrecisionAccuracyTest, SoaveRedlichKwongTest) {
+  using namespace eos;
+  const auto eos = make_soave_redlich_kwong_eos(pc, tc, omega);
+  const auto report = measure_mixed_precision_accuracy(eos, p_, t_, 1e-7);
+  EXPECT_LT(report.max_error_z, 1e-6);
+  EXPECT_LT(report.max_error_ln_phi, 1e-5);
+
+  // All the points are refined without threshold
+  const auto refined = measure_mixed_precision_accuracy(eos, p_, t_, 0.0);
+  EXPECT_EQ(refined.refined, refined.size);
+  EXPECT_LT(refined.max_error_z, 1e-10);
+  EXPECT_LT(refined.max_error_ln_phi, 1e-10);
+}
+
+TEST_F(MixedPrecisionAccuracyTest, SaturationTest) {
+  // Gibbs energies of the roots differ within the error of float near the
+  // vapor pressure, where the phase is selected in double precision
+  using namespace eos;
+  const auto eos = make_peng_robinson_eos(pc, tc, omega);
+  const auto flash = vapor_liquid_flash<decltype(eos)>(eos, 1e-12, 100);
+  for (const auto tr : {0.7, 0.8, 0.9}) {
+    const auto t = tr * tc;
+    const auto ps = flash.vapor_pressure(0.5 * pc, t).first;
+    std::vector<double> p, ts;
+    for (int k = -500; k <= 500; ++k) {
+      if (k != 0) {
+        p.push_back(ps * (1 + 1e-7 * k));
+        ts.push_back(t);
+      }
+    }
+    const auto report = measure_mixed_precision_accuracy(eos, p, ts, 1e-7);
+    EXPECT_LT(report.max_error_z, 1e-6) << tr;
+    EXPECT_LT(report.max_error_ln_phi, 1e-5) << tr;
+  }
+}
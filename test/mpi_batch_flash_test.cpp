@@ -0,0 +1,59 @@
+#include "eos/mpi/mpi_batch_flash.hpp"
+
+#include <gtest/gtest.h>
+#include <mpi.h>
+
+#include <vector>
+
+#include "eos/cubic_eos/peng_robinson_eos.hpp"
+
+TEST(MpiBatchFlashTest, LoadBalancingTest) {
+  using namespace eos;
+  // Methane
+  const double pc = 4e6;       // Critical pressure [Pa]
+  const double tc = 190.6;     // Critical temperature [K]
+  const double omega = 0.008;  // Acentric factor
+
+  int rank, size;
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &size);
+
+  // Rank 0 owns near-critical cells, which need many more iterations
+  const std::size_t n = 200;
+  std::vector<double> t(n), p_init(n), p(n);
+  std::vector<flash_iteration_result> r(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    t[i] = rank == 0 ? 185.0 + 5.0 * i / n : 120.0 + 30.0 * i / n;
+    p_init[i] = estimate_vapor_pressure(t[i], pc, tc, omega);
+  }
+
+  const auto eos = make_peng_robinson_eos(pc, tc, omega);
+  const auto flash = make_vapor_liquid_flash(eos);
+  mpi_batch_flash<peng_robinson_eos> mpi_flash(MPI_COMM_WORLD, flash);
+
+  mpi_flash.vapor_pressure(p_init, t, p, r);
+  EXPECT_EQ(mpi_flash.migrated_cells(), 0);
+  const auto imbalance = mpi_flash.imbalance();
+
+  // Costs measured in the first call redistribute cells
+  mpi_flash.vapor_pressure(p_init, t, p, r);
+  if (size > 1) {
+    EXPECT_GT(mpi_flash.migrated_cells(), 0);
+    EXPECT_LT(mpi_flash.imbalance(), imbalance);
+  }
+
+  for (std::size_t i = 0; i < n; ++i) {
+    const auto [p_expected, r_expected] = flash.vapor_pressure(p_init[i], t[i]);
+    EXPECT_EQ(p[i], p_expected);
+    EXPECT_EQ(r[i].iter, r_expected.iter);
+    EXPECT_EQ(r[i].error, r_expected.error);
+  }
+}
+
+int main(int argc, char **argv) {
+  MPI_Init(&argc, &argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  const auto result = RUN_ALL_TESTS();
+  MPI_Finalize();
+  return result;
+}
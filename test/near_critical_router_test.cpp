@@ -0,0 +1,78 @@
+#include "eos/cubic_eos/near_critical_router.hpp"
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "eos/cubic_eos/peng_robinson_eos.hpp"
+
+class NearCriticalRouterTest : public ::testing::Test {
+ protected:
+  // Methane
+  static constexpr double pc = 4e6;       // Critical pressure [Pa]
+  static constexpr double tc = 190.6;     // Critical temperature [K]
+  static constexpr double omega = 0.008;  // Acentric factor
+
+  NearCriticalRouterTest()
+      : eos_{eos::make_peng_robinson_eos(pc, tc, omega)} {}
+
+  eos::peng_robinson_eos eos_;
+};
+
+TEST_F(NearCriticalRouterTest, ClassifyTest) {
+  using namespace eos;
+  near_critical_router<peng_robinson_eos> router(eos_, omega);
+
+  auto t = 0.7 * tc;
+  EXPECT_EQ(router.classify(estimate_vapor_pressure(t, pc, tc, omega), t),
+            saturation_route::fast);
+
+  t = 0.99 * tc;
+  EXPECT_EQ(router.classify(estimate_vapor_pressure(t, pc, tc, omega), t),
+            saturation_route::robust);
+
+  // The initial pressure is far above the three-root region
+  t = 0.7 * tc;
+  EXPECT_EQ(router.classify(10 * pc, t), saturation_route::robust);
+
+  EXPECT_EQ(router.classify(pc, 1.1 * tc), saturation_route::supercritical);
+}
+
+TEST_F(NearCriticalRouterTest, VaporPressureTest) {
+  using namespace eos;
+  near_critical_router<peng_robinson_eos> router(eos_, omega);
+  const auto flash = make_vapor_liquid_flash(eos_);
+
+  std::vector<double> tr = {0.6, 0.7, 0.8, 0.9, 0.95, 0.98, 0.99, 0.999, 1.05};
+  std::vector<double> t, p_init;
+  for (const auto x : tr) {
+    t.push_back(x * tc);
+    p_init.push_back(x < 1 ? estimate_vapor_pressure(x * tc, pc, tc, omega)
+                           : pc);
+  }
+  const auto n = t.size();
+  std::vector<double> p(n);
+  std::vector<flash_iteration_result> r(n);
+  router.vapor_pressure(p_init, t, p, r);
+
+  int iter_router = 0, iter_flash = 0;
+  for (std::size_t i = 0; i + 1 < n; ++i) {
+    ASSERT_EQ(r[i].error, flash_iteration_error::success);
+    const auto [p_ref, r_ref] = flash.vapor_pressure(p_init[i], t[i]);
+    ASSERT_EQ(r_ref.error, flash_iteration_error::success);
+    EXPECT_NEAR(p[i], p_ref, 1e-4 * p_ref);
+    iter_router += r[i].iter;
+    iter_flash += r_ref.iter;
+  }
+  EXPECT_LT(iter_router, iter_flash);
+  EXPECT_EQ(r[n - 1].error, flash_iteration_error::multiple_roots_not_found);
+  EXPECT_EQ(r[n - 1].iter, 0);
+
+  EXPECT_EQ(router.count(saturation_route::fast), 4);
+  EXPECT_EQ(router.count(saturation_route::robust), 4);
+  EXPECT_EQ(router.count(saturation_route::supercritical), 1);
+  EXPECT_EQ(router.fallbacks(), 0);
+
+  router.reset_counters();
+  EXPECT_EQ(router.count(saturation_route::fast), 0);
+}
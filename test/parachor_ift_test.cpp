@@ -0,0 +1,73 @@
+#include "eos/interfacial_tension/parachor_ift.hpp"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cmath>
+#include <vector>
+
+#include "eos/cubic_eos/flash_iteration_result.hpp"
+#include "eos/cubic_eos/peng_robinson_eos.hpp"
+#include "eos/cubic_eos/vapor_liquid_flash.hpp"
+
+TEST(ParachorIftTest, PureComponentTest) {
+  // n-Hexane at 298.15 K, whose measured value is 17.9 mN/m
+  const eos::parachor_ift ift(271.0);
+  const auto rho_l = 655.0 / 86.177e-3;
+  const auto sigma = ift.interfacial_tension(rho_l, 0.0);
+  EXPECT_NEAR(sigma, 17.9e-3, 0.5e-3);
+  EXPECT_DOUBLE_EQ(ift.interfacial_tension(rho_l, rho_l), 0.0);
+}
+
+TEST(ParachorIftTest, MixtureTest) {
+  const std::vector<double> parachors = {77.0, 271.0};
+  const eos::parachor_ift ift(parachors);
+  const eos::parachor_ift pure(271.0);
+  // Reduces to the pure component
+  const std::vector<double> x = {0.0, 1.0};
+  EXPECT_DOUBLE_EQ(ift.interfacial_tension(7000.0, 100.0, x, x),
+                   pure.interfacial_tension(7000.0, 100.0));
+
+  const std::vector<double> xl = {0.3, 0.7}, yv = {0.9, 0.1};
+  const auto s = 77.0 * (0.3 * 7000.0 - 0.9 * 500.0) +
+                 271.0 * (0.7 * 7000.0 - 0.1 * 500.0);
+  const auto expected = 1e-3 * std::pow(s * 1e-6, 4);
+  EXPECT_NEAR(ift.interfacial_tension(7000.0, 500.0, xl, yv), expected,
+              1e-12);
+}
+
+TEST(ParachorIftTest, FusedFlashTest) {
+  // n-Hexane
+  const double pc = 3.025e6;
+  const double tc = 507.6;
+  const double omega = 0.301;
+  const auto eos = eos::make_peng_robinson_eos(pc, tc, omega);
+  const auto flash = eos::make_vapor_liquid_flash(eos);
+  const eos::parachor_ift ift(271.0);
+
+  const std::vector<double> t = {300.0, 350.0, 400.0, 450.0};
+  const std::vector<double> p_init(t.size(), 1e5);
+  std::vector<double> p(t.size()), sigma(t.size());
+  std::vector<eos::flash_iteration_result> r(t.size());
+  flash.vapor_pressure(p_init, t, ift, p, sigma, r);
+
+  constexpr auto R = eos::gas_constant<double>();
+  for (std::size_t i = 0; i < t.size(); ++i) {
+    ASSERT_EQ(r[i].error, eos::flash_iteration_error::success);
+    const auto [ps, result] = flash.vapor_pressure(p_init[i], t[i]);
+    EXPECT_DOUBLE_EQ(p[i], ps);
+
+    // Same as the tension from the Z-factors at the vapor pressure
+    const auto state = eos.create_isobaric_isothermal_state(ps, t[i]);
+    std::array<double, 3> z;
+    const auto n = state.zfactor(z);
+    const auto c = ps / (R * t[i]);
+    const auto expected = ift.interfacial_tension(c / z[0], c / z[n - 1]);
+    EXPECT_NEAR(sigma[i], expected, 1e-4 * expected);
+
+    // Decreases toward the critical point
+    if (i > 0) {
+      EXPECT_LT(sigma[i], sigma[i - 1]);
+    }
+  }
+}
@@ -0,0 +1,84 @@
+#include "eos/saft/pc_saft_eos.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+class PcSaftEosTest : public ::testing::Test {
+ protected:
+  // n-Hexane of Gross and Sadowski (2001)
+  static constexpr double m = 3.0576;          // Segment number
+  static constexpr double sigma = 3.7983;      // Segment diameter [Angstrom]
+  static constexpr double epsilon_k = 236.77;  // Dispersion energy [K]
+  static constexpr double mw = 86.18e-3;       // Molecular weight [kg/mol]
+
+  PcSaftEosTest() : eos_{m, sigma, epsilon_k} {}
+
+  eos::pc_saft_eos eos_;
+};
+
+TEST_F(PcSaftEosTest, DensityTest) {
+  using namespace eos;
+  const auto line = eos_.create_isothermal_line(298.15);
+  const auto v = line.volume(1e5, root_selection::smallest);
+  EXPECT_NEAR(mw / v, 655.0, 0.02 * 655.0);
+  EXPECT_NEAR(line.pressure(v), 1e5, 1e-4);
+
+  // Vapor is nearly ideal at low pressure
+  EXPECT_NEAR(line.zfactor(1e3, root_selection::largest), 1.0, 1e-2);
+  EXPECT_NEAR(line.zfactor(1e3, root_selection::stable),
+              line.zfactor(1e3, root_selection::largest), 1e-12);
+}
+
+TEST_F(PcSaftEosTest, DerivativeTest) {
+  const auto line = eos_.create_isothermal_line(350.0);
+  const auto h = 1e-6;
+  for (const auto eta : {1e-3, 0.1, 0.3, 0.45}) {
+    const auto x = line.evaluate(eta);
+    EXPECT_NEAR(x.dzde,
+                (line.evaluate(eta + h).z - line.evaluate(eta - h).z) / (2 * h),
+                1e-6 * std::fabs(x.dzde) + 1e-6);
+
+    // Z - 1 is the density derivative of the residual Helmholtz energy
+    const auto da = (line.reduced_residual_helmholtz_energy(eta + h) -
+                     line.reduced_residual_helmholtz_energy(eta - h)) /
+                    (2 * h);
+    EXPECT_NEAR(x.z - 1, eta * da, 1e-6);
+  }
+}
+
+TEST_F(PcSaftEosTest, SaturationPressureTest) {
+  using namespace eos;
+  // Normal boiling point
+  const auto [p, result] =
+      eos_.create_isothermal_line(341.88).saturation_pressure(1e5);
+  EXPECT_EQ(result.error, flash_iteration_error::success);
+  EXPECT_NEAR(p, 101325, 0.01 * 101325);
+
+  const auto s = eos_.create_isobaric_isothermal_state(p, 341.88);
+  const auto zl = s.zfactor(root_selection::smallest);
+  const auto zv = s.zfactor(root_selection::largest);
+  EXPECT_LT(zl, zv);
+  EXPECT_NEAR(s.ln_fugacity_coeff(zl), s.ln_fugacity_coeff(zv), 1e-9);
+
+  // Supercritical temperature
+  EXPECT_EQ(
+      eos_.create_isothermal_line(600.0).saturation_pressure(1e6).second.error,
+      flash_iteration_error::multiple_roots_not_found);
+}
+
+TEST_F(PcSaftEosTest, BatchTest) {
+  using namespace eos;
+  const std::vector<double> p = {1e3, 1e5, 1e6, 1e3, 1e5, 1e7};
+  const std::vector<double> t = {300.0, 300.0, 300.0, 400.0, 400.0, 400.0};
+  std::vector<double> z(p.size()), ln_phi(p.size());
+  eos_.zfactor(p, t, z, root_selection::stable);
+  eos_.ln_fugacity_coeff(p, t, ln_phi, root_selection::stable);
+  for (std::size_t i = 0; i < p.size(); ++i) {
+    const auto s = eos_.create_isobaric_isothermal_state(p[i], t[i]);
+    const auto expected = s.zfactor(root_selection::stable);
+    EXPECT_DOUBLE_EQ(z[i], expected);
+    EXPECT_DOUBLE_EQ(ln_phi[i], s.ln_fugacity_coeff(expected));
+  }
+}
@@ -0,0 +1,178 @@
+#include "eos/cubic_eos/property_cache.hpp"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "eos/cubic_eos/peng_robinson_eos.hpp"
+#include "eos/cubic_eos/vapor_liquid_flash.hpp"
+
+class PropertyCacheTest : public ::testing::Test {
+ protected:
+  // Methane
+  static constexpr double pc = 4e6;       // Critical pressure [Pa]
+  static constexpr double tc = 190.6;     // Critical temperature [K]
+  static constexpr double omega = 0.008;  // Acentric factor
+
+  PropertyCacheTest() : eos_{eos::make_peng_robinson_eos(pc, tc, omega)} {}
+
+  eos::peng_robinson_eos eos_;
+};
+
+TEST_F(PropertyCacheTest, HitTest) {
+  using namespace eos;
+  property_cache<peng_robinson_eos> cache(eos_, 1024, 1e-6, 1e-4);
+
+  const auto x1 = cache.get(5e6, 300.0);
+  // Within the same quantization cell
+  const auto x2 = cache.get(5e6 * (1 + 1e-8), 300.0 + 1e-6);
+  EXPECT_EQ(cache.hits(), 1);
+  EXPECT_EQ(cache.misses(), 1);
+  EXPECT_DOUBLE_EQ(cache.hit_rate(), 0.5);
+  EXPECT_EQ(x1.z, x2.z);
+
+  const auto state = eos_.create_isobaric_isothermal_state(5e6, 300.0);
+  const auto z = state.zfactor(root_selection::stable);
+  EXPECT_NEAR(x1.z, z, 1e-6);
+  EXPECT_NEAR(x1.ln_fugacity_coeff, state.ln_fugacity_coeff(z), 1e-6);
+  EXPECT_NEAR(x1.residual_enthalpy, state.residual_enthalpy(z), 1e-2);
+  EXPECT_NEAR(x1.residual_entropy, state.residual_entropy(z), 1e-4);
+
+  cache.clear();
+  EXPECT_EQ(cache.hits(), 0);
+  cache.get(5e6, 300.0);
+  EXPECT_EQ(cache.misses(), 1);
+}
+
+TEST_F(PropertyCacheTest, EvictionTest) {
+  using namespace eos;
+  property_cache<peng_robinson_eos> cache(eos_, 64, 1e-3, 0.1, 2);
+  EXPECT_EQ(cache.capacity(), 64);
+
+  for (int i = 0; i < 1000; ++i) {
+    cache.get(1e6, 200.0 + 0.1 * i);
+  }
+  EXPECT_EQ(cache.misses(), 1000);
+  EXPECT_GE(cache.evictions(), 1000 - 64);
+
+  // Recently inserted entries survive
+  cache.get(1e6, 200.0 + 0.1 * 999);
+  EXPECT_EQ(cache.hits(), 1);
+}
+
+TEST_F(PropertyCacheTest, ConcurrentTest) {
+  using namespace eos;
+  property_cache<peng_robinson_eos> cache(eos_, 4096, 1e-4, 0.01);
+
+  std::vector<std::thread> threads;
+  std::vector<int> mismatches(4, 0);
+  for (int k = 0; k < 4; ++k) {
+    threads.emplace_back([this, &cache, &mismatches, k] {
+      for (int i = 0; i < 2000; ++i) {
+        const auto p = 1e6 + 1e4 * (i % 100);
+        const auto t = 250.0 + (i % 37);
+        const auto x = cache.get(p, t);
+        const auto state = eos_.create_isobaric_isothermal_state(p, t);
+        const auto z = state.zfactor(root_selection::stable);
+        if (std::fabs(x.z - z) > 1e-4) {
+          ++mismatches[k];
+        }
+      }
+    });
+  }
+  for (auto &t : threads) {
+    t.join();
+  }
+
+  for (const auto m : mismatches) {
+    EXPECT_EQ(m, 0);
+  }
+  EXPECT_EQ(cache.hits() + cache.misses(), 8000);
+  EXPECT_GT(cache.hit_rate(), 0.5);
+}
+
+TEST_F(PropertyCacheTest, SaturationTest) {
+  using namespace eos;
+  const double p_tol = 1e-2;
+  property_cache<peng_robinson_eos> cache(eos_, 1024, p_tol, 0.1);
+
+  // Points on either side of the vapor pressure in the same cell
+  const double t = 180.0;
+  const auto [psat, r] = make_vapor_liquid_flash(eos_).vapor_pressure(3e6, t);
+  ASSERT_EQ(r.error, flash_iteration_error::success);
+  const auto k = std::llround(std::log(psat) / p_tol);
+  const auto p_below = std::sqrt(std::exp((k - 0.5) * p_tol) * psat);
+  const auto p_above = std::sqrt(std::exp((k + 0.5) * p_tol) * psat);
+
+  for (const auto p : {p_below, p_above, p_below, p_above}) {
+    const auto state = eos_.create_isobaric_isothermal_state(p, t);
+    std::array<double, 3> z;
+    const auto n = state.zfactor(z);
+    ASSERT_EQ(n, 3);
+    // Vapor below and liquid above the vapor pressure
+    const auto expected = p < psat ? z[n - 1] : z[0];
+    EXPECT_DOUBLE_EQ(cache.get(p, t).z, expected);
+  }
+  EXPECT_EQ(cache.hits(), 0);
+  EXPECT_EQ(cache.misses(), 1);
+  EXPECT_EQ(cache.bypasses(), 3);
+
+  // Cells away from the vapor pressure are cached
+  cache.get(0.5 * psat, t);
+  cache.get(0.5 * psat, t);
+  EXPECT_EQ(cache.hits(), 1);
+}
+
+TEST_F(PropertyCacheTest, NearCriticalSaturationTest) {
+  using namespace eos;
+  const double p_tol = 0.05, t_tol = 1.0;
+  property_cache<peng_robinson_eos> cache(eos_, 1024, p_tol, t_tol);
+
+  // The corners of the cell crossed by the saturation curve have single roots
+  const double t = 187.0;
+  const auto [psat, r] = make_vapor_liquid_flash(eos_).vapor_pressure(3.5e6, t);
+  ASSERT_EQ(r.error, flash_iteration_error::success);
+  const auto k = std::llround(std::log(psat) / p_tol);
+  const auto dp = std::exp(0.5 * p_tol);
+  for (const auto &[pk, tk] : {std::make_pair(std::exp(k * p_tol) * dp,
+                                              t - 0.5 * t_tol),
+                               std::make_pair(std::exp(k * p_tol) / dp,
+                                              t + 0.5 * t_tol)}) {
+    std::array<double, 3> z;
+    ASSERT_EQ(eos_.create_isobaric_isothermal_state(pk, tk).zfactor(z), 1);
+  }
+
+  for (const auto p : {0.999 * psat, 1.001 * psat}) {
+    const auto state = eos_.create_isobaric_isothermal_state(p, t);
+    EXPECT_DOUBLE_EQ(cache.get(p, t).z, state.zfactor(root_selection::stable));
+  }
+  EXPECT_EQ(cache.misses(), 1);
+  EXPECT_EQ(cache.bypasses(), 1);
+}
+
+TEST_F(PropertyCacheTest, InvalidPressureTest) {
+  using namespace eos;
+  property_cache<peng_robinson_eos> cache(eos_, 1024, 1e-6, 1e-4);
+  EXPECT_THROW(cache.get(0.0, 300.0), std::invalid_argument);
+  EXPECT_THROW(cache.get(-1e5, 300.0), std::invalid_argument);
+  EXPECT_THROW(cache.get(std::numeric_limits<double>::quiet_NaN(), 300.0),
+               std::invalid_argument);
+  EXPECT_THROW(cache.get(std::numeric_limits<double>::infinity(), 300.0),
+               std::invalid_argument);
+}
+
+TEST_F(PropertyCacheTest, InvalidTemperatureTest) {
+  using namespace eos;
+  property_cache<peng_robinson_eos> cache(eos_, 1024, 1e-6, 1e-4);
+  EXPECT_THROW(cache.get(1e5, 0.0), std::invalid_argument);
+  EXPECT_THROW(cache.get(1e5, std::numeric_limits<double>::quiet_NaN()),
+               std::invalid_argument);
+  EXPECT_THROW(cache.get(1e5, std::numeric_limits<double>::infinity()),
+               std::invalid_argument);
+  EXPECT_THROW(cache.get(1e5, 1e300), std::invalid_argument);
+}
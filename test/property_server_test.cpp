@@ -0,0 +1,167 @@
+#include "eos/server/property_server.hpp"
+
+#include <gtest/gtest.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <cstring>
+#include <future>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "eos/cubic_eos/peng_robinson_eos.hpp"
+#include "eos/cubic_eos/vapor_liquid_flash.hpp"
+#include "eos/server/property_client.hpp"
+#include "eos/viscosity/lucas_method.hpp"
+
+class PropertyServerTest : public ::testing::Test {
+ protected:
+  // Methane
+  static constexpr double pc = 4e6;       // Critical pressure [Pa]
+  static constexpr double tc = 190.6;     // Critical temperature [K]
+  static constexpr double omega = 0.008;  // Acentric factor
+  static constexpr double zc = 0.286;     // Critical Z-factor
+  static constexpr double mw = 16.043;    // Molecular weight [kg/kmol]
+
+  PropertyServerTest()
+      : path_{"/tmp/eoscpp-test-" + std::to_string(::getpid()) + ".sock"},
+        server_{path_},
+        thread_{[this] { server_.run(); }} {}
+
+  ~PropertyServerTest() {
+    server_.stop();
+    thread_.join();
+  }
+
+  static eos::fluid_params methane() {
+    return {eos::served_eos::peng_robinson, pc, tc, omega, zc, mw, 0.0, 0.0};
+  }
+
+  std::string path_;
+  eos::property_server server_;
+  std::thread thread_;
+};
+
+TEST_F(PropertyServerTest, ZFactorTest) {
+  using namespace eos;
+  const auto eos = make_peng_robinson_eos(pc, tc, omega);
+
+  // Small staging area splits the batch into chunks
+  property_client client(path_, 0, 16);
+  const auto id = client.register_fluid(methane());
+  EXPECT_EQ(client.register_fluid(methane()), id);
+
+  const std::size_t n = 100;
+  std::vector<double> p(n), t(n), z(n), z_expected(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    p[i] = 1e5 * (i + 1);
+    t[i] = 150.0 + i;
+  }
+
+  client.zfactor(id, p, t, z, root_selection::stable);
+  eos.zfactor(p, t, z_expected, root_selection::stable);
+  for (std::size_t i = 0; i < n; ++i) {
+    EXPECT_EQ(z[i], z_expected[i]);
+  }
+}
+
+TEST_F(PropertyServerTest, ZeroCopyTest) {
+  using namespace eos;
+  const auto eos = make_peng_robinson_eos(pc, tc, omega);
+
+  const std::size_t n = 10;
+  property_client client(path_, 3 * n, 0);
+  const auto id = client.register_fluid(methane());
+
+  const auto buffer = client.buffer();
+  ASSERT_EQ(buffer.size(), 3 * n);
+  const auto p = buffer.subspan(0, n);
+  const auto t = buffer.subspan(n, n);
+  const auto z = buffer.subspan(2 * n, n);
+  for (std::size_t i = 0; i < n; ++i) {
+    p[i] = 1e6 * (i + 1);
+    t[i] = 200.0;
+  }
+
+  client.zfactor(id, p, t, z, root_selection::largest);
+  for (std::size_t i = 0; i < n; ++i) {
+    const auto z_expected = eos.zfactor(p[i], t[i]).back();
+    EXPECT_EQ(z[i], z_expected);
+  }
+}
+
+TEST_F(PropertyServerTest, VaporPressureAndViscosityTest) {
+  using namespace eos;
+  const auto eos = make_peng_robinson_eos(pc, tc, omega);
+  const auto flash = make_vapor_liquid_flash(eos);
+  const auto lucas = make_lucas_method(pc, tc, zc, mw, 0.0, 0.0);
+
+  property_client client(path_);
+  const auto id = client.register_fluid(methane());
+
+  const std::vector<double> t = {150.0, 160.0, 170.0, 180.0};
+  std::vector<double> p_init(t.size());
+  for (std::size_t i = 0; i < t.size(); ++i) {
+    p_init[i] = estimate_vapor_pressure(t[i], pc, tc, omega);
+  }
+
+  std::vector<double> pvap(t.size());
+  std::vector<flash_iteration_result> r(t.size());
+  client.vapor_pressure(id, p_init, t, pvap, r);
+  for (std::size_t i = 0; i < t.size(); ++i) {
+    const auto [pvap_expected, r_expected] =
+        flash.vapor_pressure(p_init[i], t[i]);
+    EXPECT_EQ(pvap[i], pvap_expected);
+    EXPECT_EQ(r[i].iter, r_expected.iter);
+    EXPECT_EQ(r[i].error, flash_iteration_error::success);
+  }
+
+  std::vector<double> mu(t.size());
+  client.viscosity(id, pvap, t, mu);
+  for (std::size_t i = 0; i < t.size(); ++i) {
+    EXPECT_EQ(mu[i], lucas.viscosity_at_high_pressure(pvap[i], t[i]));
+  }
+}
+
+TEST_F(PropertyServerTest, InvalidFluidTest) {
+  using namespace eos;
+  property_client client(path_);
+  std::vector<double> p = {1e6}, t = {200.0}, z(1);
+  EXPECT_THROW(client.zfactor(42, p, t, z, root_selection::stable),
+               std::invalid_argument);
+}
+
+TEST_F(PropertyServerTest, StalledClientTest) {
+  using namespace eos;
+  // A client sends a part of a request and stalls
+  const int fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+  ASSERT_GE(fd, 0);
+  sockaddr_un addr;
+  std::memset(&addr, 0, sizeof(addr));
+  addr.sun_family = AF_UNIX;
+  std::strcpy(addr.sun_path, path_.c_str());
+  ASSERT_EQ(::connect(fd, reinterpret_cast<sockaddr *>(&addr), sizeof(addr)),
+            0);
+  const char partial[4] = {};
+  ASSERT_EQ(::send(fd, partial, sizeof(partial), 0), 4);
+
+  // Other clients are still served
+  auto other = std::async(std::launch::async, [this] {
+    property_client client(path_);
+    const auto id = client.register_fluid(methane());
+    std::vector<double> p = {1e6}, t = {200.0}, z(1);
+    client.zfactor(id, p, t, z, root_selection::stable);
+    return z[0];
+  });
+  const auto status = other.wait_for(std::chrono::seconds(10));
+  EXPECT_EQ(status, std::future_status::ready);
+  ::close(fd);
+
+  const auto eos = make_peng_robinson_eos(pc, tc, omega);
+  const auto state = eos.create_isobaric_isothermal_state(1e6, 200.0);
+  EXPECT_EQ(other.get(), state.zfactor(root_selection::stable));
+}
@@ -0,0 +1,188 @@
+#include "eos/table/property_table.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+#include "eos/cubic_eos/peng_robinson_eos.hpp"
+#include "eos/cubic_eos/root_selection.hpp"
+#include "eos/viscosity/lucas_method.hpp"
+
+class PropertyTableTest : public ::testing::Test {
+ protected:
+  // Methane
+  static constexpr double pc = 4.599e6;   // Critical pressure [Pa]
+  static constexpr double tc = 190.6;     // Critical temperature [K]
+  static constexpr double omega = 0.008;  // Acentric factor
+
+  // Supercritical region of 1-20 MPa and 250-450 K
+  PropertyTableTest()
+      : x_{1e6, 1e5, 191}, y_{250.0, 1.0, 201}, eos_{pc, tc, omega} {}
+
+  /// @brief Returns Z-factors at nodes
+  std::vector<double> zfactors() const {
+    return eos::tabulate(x_, y_, [this](double p, double t) {
+      return eos_.create_isobaric_isothermal_state(p, t).zfactor(
+          eos::root_selection::stable);
+    });
+  }
+
+  /// @brief Returns the maximum relative error of interpolation against the
+  /// table in double precision at cell centers
+  double interpolation_error(const eos::property_table &table,
+                             const eos::property_table &reference) const {
+    std::vector<double> p, t;
+    for (std::size_t j = 0; j + 1 < y_.size; j += 7) {
+      for (std::size_t i = 0; i + 1 < x_.size; i += 3) {
+        p.push_back(x_[i] + 0.5 * x_.step);
+        t.push_back(y_[j] + 0.5 * y_.step);
+      }
+    }
+    std::vector<double> v(p.size()), v_ref(p.size());
+    table.interpolate(p, t, v);
+    reference.interpolate(p, t, v_ref);
+    double max_error = 0.0;
+    for (std::size_t k = 0; k < v.size(); ++k) {
+      max_error = std::max(max_error, std::fabs(v[k] / v_ref[k] - 1));
+    }
+    return max_error;
+  }
+
+  eos::table_axis x_;
+  eos::table_axis y_;
+  eos::peng_robinson_eos eos_;
+};
+
+TEST_F(PropertyTableTest, InterpolationTest) {
+  using namespace eos;
+  const auto z = zfactors();
+  const property_table table(table_encoding::float64, x_, y_, z);
+  EXPECT_EQ(table.header().max_abs_error, 0.0);
+  EXPECT_EQ(table.value(10, 20), z[20 * x_.size + 10]);
+
+  // Bilinear interpolation on a fine grid
+  const auto p = 5.05e6, t = 300.5;
+  const auto z_ref = eos_.create_isobaric_isothermal_state(p, t).zfactor(
+      root_selection::stable);
+  EXPECT_NEAR(table.interpolate(p, t), z_ref, 1e-5);
+
+  // Exact at nodes and extrapolated linearly outside the grid
+  EXPECT_DOUBLE_EQ(table.interpolate(x_[3], y_[5]), z[5 * x_.size + 3]);
+  const auto z0 = z[0], z1 = z[1];
+  EXPECT_NEAR(table.interpolate(x_.first - x_.step, y_.first), 2 * z0 - z1,
+              1e-12);
+}
+
+TEST_F(PropertyTableTest, NonFiniteTest) {
+  const auto z = zfactors();
+  const eos::property_table table(eos::table_encoding::delta8, x_, y_, z);
+  constexpr auto nan = std::numeric_limits<double>::quiet_NaN();
+  constexpr auto inf = std::numeric_limits<double>::infinity();
+  EXPECT_TRUE(std::isnan(table.interpolate(nan, y_.first)));
+  EXPECT_TRUE(std::isnan(table.interpolate(x_.first, -inf)));
+
+  // Non-finite points do not affect the others of a batch, which spans
+  // several tiles
+  std::vector<double> p, t;
+  for (int k = 0; k < 200; ++k) {
+    p.push_back(k % 7 == 0 ? nan : k % 11 == 0 ? inf : 1e6 + 9.3e4 * k);
+    t.push_back(k % 13 == 0 ? -inf : 250.0 + 0.97 * k);
+  }
+  std::vector<double> v(p.size());
+  table.interpolate(p, t, v);
+  for (std::size_t k = 0; k < v.size(); ++k) {
+    if (std::isfinite(p[k]) && std::isfinite(t[k])) {
+      EXPECT_DOUBLE_EQ(v[k], table.interpolate(p[k], t[k]));
+    } else {
+      EXPECT_TRUE(std::isnan(v[k]));
+    }
+  }
+}
+
+TEST_F(PropertyTableTest, EncodingTest) {
+  using namespace eos;
+  const auto z = zfactors();
+  const property_table reference(table_encoding::float64, x_, y_, z);
+
+  struct expectation {
+    table_encoding encoding;
+    double bytes_per_value;
+    double max_rel_error;
+  };
+  // delta8 keeps an anchor of 2 bytes at every 8th value
+  for (const auto &e : {expectation{table_encoding::float32, 4, 1e-7},
+                        expectation{table_encoding::bfloat16, 2, 1e-3},
+                        expectation{table_encoding::float16, 2, 1e-4},
+                        expectation{table_encoding::delta8, 1.25, 1e-4}}) {
+    const property_table table(e.encoding, x_, y_, z);
+    const auto &h = table.header();
+    EXPECT_EQ(h.encoding, e.encoding);
+    EXPECT_GT(h.max_abs_error, 0.0);
+    EXPECT_LT(h.max_rel_error, e.max_rel_error);
+    EXPECT_LE(table.storage_bytes(),
+              static_cast<double>(z.size()) * e.bytes_per_value +
+                  static_cast<double>(z.size() / h.block_size + y_.size) * 16);
+
+    // The recorded error bounds the error of values at nodes
+    for (std::size_t j = 0; j < y_.size; j += 13) {
+      for (std::size_t i = 0; i < x_.size; i += 11) {
+        EXPECT_LE(std::fabs(table.value(i, j) - z[j * x_.size + i]),
+                  h.max_abs_error);
+      }
+    }
+    // Interpolation errors are bounded by those of nodes
+    EXPECT_LT(interpolation_error(table, reference), 2 * h.max_rel_error);
+  }
+}
+
+TEST_F(PropertyTableTest, Delta8BlockSizeTest) {
+  using namespace eos;
+  const auto z = zfactors();
+  // Block sizes which are and are not multiples of the anchor interval
+  for (const std::size_t block_size : {1, 7, 8, 13, 64, 256}) {
+    const property_table table(table_encoding::delta8, x_, y_, z, block_size);
+    const auto &h = table.header();
+    EXPECT_LT(h.max_rel_error, 1e-3);
+    for (std::size_t j = 0; j < y_.size; j += 17) {
+      for (std::size_t i = 0; i < x_.size; ++i) {
+        EXPECT_LE(std::fabs(table.value(i, j) - z[j * x_.size + i]),
+                  h.max_abs_error);
+      }
+    }
+  }
+  EXPECT_THROW(property_table(table_encoding::delta8, x_, y_, z, 257),
+               std::invalid_argument);
+}
+
+TEST_F(PropertyTableTest, ViscosityTest) {
+  using namespace eos;
+  const lucas_method lucas(pc, tc, 0.286, 16.043, 0.0, 0.0);
+  const auto mu = tabulate(x_, y_, [&lucas](double p, double t) {
+    return lucas.viscosity_at_high_pressure(p, t);
+  });
+  const property_table table(table_encoding::float16, x_, y_, mu);
+  EXPECT_LT(table.header().max_rel_error, 1e-4);
+  const auto p = 8.02e6, t = 333.3;
+  EXPECT_NEAR(table.interpolate(p, t), lucas.viscosity_at_high_pressure(p, t),
+              1e-4 * lucas.viscosity_at_high_pressure(p, t));
+}
+
+TEST_F(PropertyTableTest, ReadWriteTest) {
+  using namespace eos;
+  const auto z = zfactors();
+  const property_table table(table_encoding::delta8, x_, y_, z);
+  std::stringstream ss;
+  table.write(ss);
+  const auto copy = property_table::read(ss);
+  EXPECT_EQ(copy.header().encoding, table_encoding::delta8);
+  EXPECT_EQ(copy.header().max_abs_error, table.header().max_abs_error);
+  EXPECT_EQ(copy.storage_bytes(), table.storage_bytes());
+  EXPECT_EQ(copy.interpolate(3.3e6, 321.0), table.interpolate(3.3e6, 321.0));
+
+  std::stringstream invalid("not a table");
+  EXPECT_THROW(property_table::read(invalid), std::runtime_error);
+}
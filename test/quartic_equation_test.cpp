@@ -0,0 +1,43 @@
+#include "eos/math/quartic_equation.hpp"
+
+#include <gtest/gtest.h>
+
+TEST(QuarticEquationTest, RealRootsTest) {
+  // x^4 + 2x^3 - x^2 - 2x = (x + 2)(x - 1)(x + 1)x = 0
+  {
+    eos::quartic_equation eq(2.0, -1.0, -2.0, 0.0);
+    std::array<double, 4> x;
+    ASSERT_EQ(eq.real_roots(x), 4);
+    EXPECT_NEAR(x[0], -2.0, 1e-10);
+    EXPECT_NEAR(x[1], -1.0, 1e-10);
+    EXPECT_NEAR(x[2], 0.0, 1e-10);
+    EXPECT_NEAR(x[3], 1.0, 1e-10);
+  }
+
+  // x^4 - 5x^2 + 4 = (x^2 - 1)(x^2 - 4) = 0
+  {
+    eos::quartic_equation eq(0.0, -5.0, 0.0, 4.0);
+    std::array<double, 4> x;
+    ASSERT_EQ(eq.real_roots(x), 4);
+    EXPECT_NEAR(x[0], -2.0, 1e-10);
+    EXPECT_NEAR(x[1], -1.0, 1e-10);
+    EXPECT_NEAR(x[2], 1.0, 1e-10);
+    EXPECT_NEAR(x[3], 2.0, 1e-10);
+  }
+
+  // x^4 - 1 = (x - 1)(x + 1)(x^2 + 1) = 0
+  {
+    eos::quartic_equation eq(0.0, 0.0, 0.0, -1.0);
+    std::array<double, 4> x;
+    ASSERT_EQ(eq.real_roots(x), 2);
+    EXPECT_NEAR(x[0], -1.0, 1e-10);
+    EXPECT_NEAR(x[1], 1.0, 1e-10);
+  }
+
+  // x^4 + x^3 + x^2 + x + 1 = 0 has no real roots
+  {
+    eos::quartic_equation eq(1.0, 1.0, 1.0, 1.0);
+    std::array<double, 4> x;
+    EXPECT_EQ(eq.real_roots(x), 0);
+  }
+}
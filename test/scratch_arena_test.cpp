@@ -0,0 +1,103 @@
+#include "eos/common/scratch_arena.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#include "eos/cubic_eos/isobaric_flash.hpp"
+#include "eos/cubic_eos/peng_robinson_eos.hpp"
+#include "eos/cubic_eos/vapor_liquid_flash.hpp"
+
+namespace {
+
+std::atomic<std::size_t> num_allocations{0};
+
+}  // namespace
+
+// Counts heap allocations of the test program
+void* operator new(std::size_t size) {
+  ++num_allocations;
+  if (auto p = std::malloc(size > 0 ? size : 1)) {
+    return p;
+  }
+  throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+
+TEST(ScratchArenaTest, AllocationTest) {
+  eos::scratch_arena arena(64);
+  EXPECT_EQ(arena.capacity(), 64);
+  EXPECT_EQ(arena.heap_allocations(), 1);
+
+  for (int k = 0; k < 3; ++k) {
+    eos::scratch_arena::scope scope(arena);
+    const auto x = arena.allocate<double>(4);
+    EXPECT_EQ(x.size(), 4);
+    {
+      eos::scratch_arena::scope inner(arena);
+      // Exceeds the main block at the first iteration
+      const auto y = arena.allocate<double>(16);
+      y[15] = 1.0;
+      EXPECT_EQ(arena.used(), 20 * sizeof(double));
+    }
+    EXPECT_EQ(arena.used(), 4 * sizeof(double));
+  }
+
+  EXPECT_EQ(arena.used(), 0);
+  EXPECT_EQ(arena.peak(), 20 * sizeof(double));
+  EXPECT_GE(arena.capacity(), arena.peak());
+  // The initial block, an overflow block and the merged block
+  EXPECT_EQ(arena.heap_allocations(), 3);
+}
+
+TEST(ScratchArenaTest, NestedOverflowTest) {
+  // Overflow blocks of inner scopes are freed under a long-lived scope
+  eos::scratch_arena arena(64);
+  eos::scratch_arena::scope outer(arena);
+  arena.allocate<double>(4);
+  for (int k = 0; k < 100; ++k) {
+    eos::scratch_arena::scope inner(arena);
+    arena.allocate<double>(16);
+    arena.allocate<double>(16);
+    EXPECT_EQ(arena.overflow_blocks(), 2);
+  }
+  EXPECT_EQ(arena.overflow_blocks(), 0);
+  EXPECT_EQ(arena.used(), 4 * sizeof(double));
+}
+
+TEST(ScratchArenaTest, ThreadArenaTest) {
+  auto& arena = eos::thread_scratch_arena();
+  EXPECT_EQ(&arena, &eos::thread_scratch_arena());
+  eos::scratch_arena::scope scope(arena);
+  const auto x = arena.allocate<int>(10);
+  EXPECT_EQ(x.size(), 10);
+}
+
+TEST(ScratchArenaTest, FlashWithoutHeapAllocationTest) {
+  using namespace eos;
+  // Methane
+  const double pc = 4e6;       // Critical pressure [Pa]
+  const double tc = 190.6;     // Critical temperature [K]
+  const double omega = 0.008;  // Acentric factor
+
+  const auto eos = make_peng_robinson_eos(pc, tc, omega);
+  const auto flash = make_vapor_liquid_flash(eos);
+  const auto cp = make_ideal_gas_heat_capacity(4.568, -8.975e-3, 3.631e-5,
+                                               -3.407e-8, 1.091e-11);
+  const auto isobaric = make_isobaric_flash(eos, cp);
+
+  const auto before = num_allocations.load();
+  const auto [pvap, r1] = flash.vapor_pressure(2.9e6, 180.0);
+  const auto [tsat, r2] = flash.saturation_temperature(180.0, 2.87e6);
+  const auto r3 = isobaric.ph_flash(2e6, -5000.0, 200.0);
+  const auto after = num_allocations.load();
+
+  EXPECT_EQ(r1.error, flash_iteration_error::success);
+  EXPECT_EQ(r2.error, flash_iteration_error::success);
+  EXPECT_EQ(r3.report.error, flash_iteration_error::success);
+  EXPECT_EQ(after, before);
+}
@@ -0,0 +1,95 @@
+#include "eos/diffusion/sigmund_diffusion.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+#include "eos/common/thermodynamic_constants.hpp"
+
+class SigmundDiffusionTest : public ::testing::Test {
+ protected:
+  // Methane, nitrogen and n-decane
+  SigmundDiffusionTest()
+      : diffusion_{std::vector<double>{190.56, 126.2, 617.7},
+                   std::vector<double>{98.6e-6, 89.2e-6, 624e-6},
+                   std::vector<double>{0.286, 0.289, 0.256},
+                   std::vector<double>{16.043, 28.014, 142.285}} {}
+
+  eos::sigmund_diffusion diffusion_;
+};
+
+TEST_F(SigmundDiffusionTest, DiluteGasTest) {
+  // Measured value of methane in nitrogen at 298 K and 1 atm is 2.16e-5 m2/s
+  const auto rho = 101325.0 / (eos::gas_constant<double>() * 298.15);
+  const std::vector<double> x = {0.5, 0.5, 0.0};
+  std::vector<double> d(9);
+  diffusion_.binary_coefficients(298.15, rho, x, d);
+  EXPECT_NEAR(d[1], 2.16e-5, 0.1e-5);
+  for (std::size_t i = 0; i < 3; ++i) {
+    for (std::size_t j = 0; j < 3; ++j) {
+      EXPECT_DOUBLE_EQ(d[i * 3 + j], d[j * 3 + i]);
+    }
+  }
+}
+
+TEST_F(SigmundDiffusionTest, DensityCorrectionTest) {
+  using eos::sigmund_diffusion;
+  EXPECT_DOUBLE_EQ(sigmund_diffusion::density_correction(0.0), 0.99589);
+  // The extrapolation is continuous at the reduced density of three
+  EXPECT_NEAR(sigmund_diffusion::density_correction(3.0 - 1e-12),
+              sigmund_diffusion::density_correction(3.0 + 1e-12), 1e-5);
+  EXPECT_GT(sigmund_diffusion::density_correction(5.0), 0.0);
+}
+
+TEST_F(SigmundDiffusionTest, WilkeTest) {
+  const auto t = 344.0;
+  const auto rho = 4500.0;
+  std::vector<double> d(9), de(3);
+
+  // Coefficients of a binary are the binary coefficient
+  const std::vector<double> x1 = {0.3, 0.0, 0.7};
+  diffusion_.binary_coefficients(t, rho, x1, d);
+  diffusion_.effective_coefficients(t, rho, x1, de);
+  EXPECT_NEAR(de[0], d[2], 1e-15);
+  EXPECT_NEAR(de[2], d[2], 1e-15);
+
+  const std::vector<double> x2 = {0.3, 0.2, 0.5};
+  diffusion_.binary_coefficients(t, rho, x2, d);
+  diffusion_.effective_coefficients(t, rho, x2, de);
+  for (std::size_t i = 0; i < 3; ++i) {
+    double sum = 0.0;
+    for (std::size_t j = 0; j < 3; ++j) {
+      if (j != i) {
+        sum += x2[j] / d[i * 3 + j];
+      }
+    }
+    EXPECT_NEAR(de[i], (1 - x2[i]) / sum, 1e-6 * de[i]);
+  }
+
+  // Undefined without other components
+  const std::vector<double> x3 = {1.0, 0.0, 0.0};
+  diffusion_.effective_coefficients(t, rho, x3, de);
+  EXPECT_TRUE(std::isnan(de[0]));
+}
+
+TEST_F(SigmundDiffusionTest, BatchTest) {
+  const std::vector<double> t = {300.0, 344.0};
+  const std::vector<double> rho = {40.0, 4500.0};
+  const std::vector<double> x = {0.6, 0.4, 0.0, 0.3, 0.2, 0.5};
+  std::vector<double> d(6), d1(3);
+  diffusion_.effective_coefficients(t, rho, x, d);
+  for (std::size_t i = 0; i < 2; ++i) {
+    diffusion_.effective_coefficients(
+        t[i], rho[i], gsl::span<const double>(x).subspan(i * 3, 3), d1);
+    for (std::size_t j = 0; j < 3; ++j) {
+      EXPECT_DOUBLE_EQ(d[i * 3 + j], d1[j]);
+    }
+  }
+}
+
+TEST_F(SigmundDiffusionTest, InvalidArgumentTest) {
+  const std::vector<double> a = {1.0, 2.0}, b = {1.0};
+  EXPECT_THROW(eos::sigmund_diffusion(a, a, b, a), std::invalid_argument);
+}
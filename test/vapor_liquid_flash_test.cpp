@@ -23,4 +23,25 @@ TEST(VaporLiquidFlashTest, VaporPressureTest) {
 
   EXPECT_NEAR(pvap, 2.87515e6, 10);
   EXPECT_EQ(result.error, flash_iteration_error::success);
-}
\ No newline at end of file
+}
+
+TEST(VaporLiquidFlashTest, SaturationTemperatureTest) {
+  using namespace eos;
+  // Methane
+  const double pc = 4e6;       // Critical pressure [Pa]
+  const double tc = 190.6;     // Critical temperature [K]
+  const double omega = 0.008;  // Acentric factor
+
+  // Pressure
+  const double p = 2.87515e6;
+
+  const auto t0 = eos::estimate_saturation_temperature(p, pc, tc, omega);
+  EXPECT_NEAR(t0, 180.0, 0.5);
+
+  const auto eos = eos::make_peng_robinson_eos(pc, tc, omega);
+  auto flash = eos::make_vapor_liquid_flash(eos);
+  auto [tsat, result] = flash.saturation_temperature(t0, p);
+
+  EXPECT_NEAR(tsat, 180.0, 1e-3);
+  EXPECT_EQ(result.error, flash_iteration_error::success);
+}
@@ -0,0 +1,130 @@
+#include "eos/cubic_eos/vapor_pressure_estimator.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+#include "eos/cubic_eos/peng_robinson_eos.hpp"
+#include "eos/cubic_eos/vapor_liquid_flash.hpp"
+
+namespace {
+
+// EoS whose saturation pressures are found only above a temperature
+struct failing_eos {
+  struct isothermal_line {
+    double tr;
+    double tr_min;
+
+    std::pair<double, eos::flash_iteration_result> saturation_pressure()
+        const {
+      if (tr < tr_min) {
+        return {std::numeric_limits<double>::quiet_NaN(),
+                {1.0, 100, eos::flash_iteration_error::not_converged}};
+      }
+      return {std::exp(5 * (1 - 1 / tr)),
+              {0.0, 1, eos::flash_iteration_error::success}};
+    }
+  };
+
+  double tr_min;
+
+  double critical_pressure() const noexcept { return 1.0; }
+  double critical_temperature() const noexcept { return 1.0; }
+  isothermal_line create_isothermal_line(double t) const noexcept {
+    return {t, tr_min};
+  }
+};
+
+}  // namespace
+
+class VaporPressureEstimatorTest : public ::testing::Test {
+ protected:
+  // n-Decane
+  static constexpr double pc = 2.11e6;   // Critical pressure [Pa]
+  static constexpr double tc = 617.7;    // Critical temperature [K]
+  static constexpr double omega = 0.49;  // Acentric factor
+
+  VaporPressureEstimatorTest()
+      : eos_{eos::make_peng_robinson_eos(pc, tc, omega)} {}
+
+  /// @brief Returns the maximum relative error of estimates and the total
+  /// number of iterations over 0.45 <= Tr <= 0.99
+  std::pair<double, int> evaluate(
+      const eos::vapor_pressure_estimator &guess) const {
+    auto flash = eos::make_vapor_liquid_flash(eos_);
+    flash.set_initial_guess(guess);
+    double max_error = 0.0;
+    int iter = 0;
+    for (int i = 0; i <= 54; ++i) {
+      const auto t = (0.45 + 0.01 * i) * tc;
+      const auto [p, r] = flash.vapor_pressure(t);
+      EXPECT_EQ(r.error, eos::flash_iteration_error::success);
+      max_error = std::max(max_error, std::fabs(guess(t) / p - 1));
+      iter += r.iter;
+    }
+    return {max_error, iter};
+  }
+
+  eos::peng_robinson_eos eos_;
+};
+
+TEST_F(VaporPressureEstimatorTest, LeeKeslerTest) {
+  // ln(Pr) = 0 at the critical point
+  EXPECT_NEAR(eos::estimate_vapor_pressure_lee_kesler(tc, pc, tc, omega), pc,
+              1e-3 * pc);
+  // Pr = 0.1 at Tr = 0.7 by the definition of acentric factor
+  const auto p = eos::estimate_vapor_pressure_lee_kesler(0.7 * tc, pc, tc,
+                                                         omega);
+  EXPECT_NEAR(std::log10(p / pc), -1.0 - omega, 1e-2);
+}
+
+TEST_F(VaporPressureEstimatorTest, NoInitialGuessTest) {
+  const auto flash = eos::make_vapor_liquid_flash(eos_);
+  EXPECT_FALSE(flash.initial_guess().valid());
+  const auto [p, r] = flash.vapor_pressure(0.7 * tc);
+  EXPECT_EQ(p, 0.0);
+  EXPECT_EQ(r.error, eos::flash_iteration_error::initial_guess_not_set);
+}
+
+TEST_F(VaporPressureEstimatorTest, InitialGuessTest) {
+  using namespace eos;
+  const auto [e_wilson, iter_wilson] =
+      evaluate({vapor_pressure_guess::wilson, pc, tc, omega});
+  const auto [e_lee_kesler, iter_lee_kesler] =
+      evaluate({vapor_pressure_guess::lee_kesler, pc, tc, omega});
+
+  const auto fitted = fit_vapor_pressure_correlation(eos_);
+  EXPECT_EQ(fitted.method(), vapor_pressure_guess::fitted_correlation);
+  const auto [e_fitted, iter_fitted] = evaluate(fitted);
+
+  const auto curve = make_saturation_curve(eos_);
+  EXPECT_EQ(curve.method(), vapor_pressure_guess::saturation_curve);
+  const auto [e_curve, iter_curve] = evaluate(curve);
+
+  EXPECT_LT(e_lee_kesler, e_wilson);
+  EXPECT_LT(e_fitted, 1e-2);
+  EXPECT_LT(e_curve, 1e-3);
+  EXPECT_LT(iter_lee_kesler, iter_wilson);
+  EXPECT_LT(iter_fitted, iter_lee_kesler);
+  EXPECT_LT(iter_curve, iter_fitted);
+
+  // Critical pressure at and above the critical temperature
+  EXPECT_EQ(curve(tc), pc);
+  EXPECT_EQ(fitted(1.1 * tc), pc);
+}
+
+TEST_F(VaporPressureEstimatorTest, SaturationFailureTest) {
+  using namespace eos;
+  // Points are computed from the highest temperature and truncated at the
+  // first failure
+  const failing_eos few{0.998};
+  EXPECT_THROW(fit_vapor_pressure_correlation(few), std::invalid_argument);
+  EXPECT_THROW(make_saturation_curve(few), std::invalid_argument);
+  const failing_eos many{0.8};
+  EXPECT_NO_THROW(fit_vapor_pressure_correlation(many));
+  EXPECT_NO_THROW(make_saturation_curve(many));
+  EXPECT_THROW(make_saturation_curve(eos_, 0.45, 1), std::invalid_argument);
+}
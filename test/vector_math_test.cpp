@@ -0,0 +1,105 @@
+#include "eos/math/vector_math.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdlib>
+#include <limits>
+
+namespace vm = eos::vector_math;
+
+TEST(VectorMathTest, ExpTest) {
+  for (int i = -7000; i <= 7000; ++i) {
+    const auto x = 0.1013 * i;
+    EXPECT_NEAR(vm::exp(x), std::exp(x), 4e-16 * std::exp(x));
+  }
+  for (int i = -850; i <= 850; ++i) {
+    const auto x = 0.1013f * i;
+    EXPECT_NEAR(vm::exp(x), std::exp(x), 3e-7f * std::exp(x));
+  }
+  constexpr auto inf = std::numeric_limits<double>::infinity();
+  EXPECT_EQ(vm::exp(1000.0), inf);
+  EXPECT_EQ(vm::exp(-1000.0), 0.0);
+  EXPECT_EQ(vm::exp(-inf), 0.0);
+  EXPECT_TRUE(std::isnan(vm::exp(std::nan(""))));
+}
+
+TEST(VectorMathTest, LogTest) {
+  for (int i = -3000; i <= 3000; ++i) {
+    const auto x = std::exp(0.2357 * i);
+    EXPECT_NEAR(vm::log(x), std::log(x),
+                4e-16 * std::fabs(std::log(x)) + 1e-16);
+    const auto xf = static_cast<float>(std::exp(0.0289 * i));
+    EXPECT_NEAR(vm::log(xf), std::log(xf),
+                2e-7f * std::fabs(std::log(xf)) + 2e-7f);
+  }
+  // Subnormal numbers
+  EXPECT_NEAR(vm::log(1e-310), std::log(1e-310), 1e-12);
+  EXPECT_NEAR(vm::log(1e-40f), std::log(1e-40f), 1e-5f);
+
+  constexpr auto inf = std::numeric_limits<double>::infinity();
+  EXPECT_EQ(vm::log(0.0), -inf);
+  EXPECT_EQ(vm::log(inf), inf);
+  EXPECT_TRUE(std::isnan(vm::log(-1.0)));
+  EXPECT_TRUE(std::isnan(vm::log(std::nan(""))));
+}
+
+TEST(VectorMathTest, Expm1Test) {
+  for (int i = -2600; i <= 2600; ++i) {
+    const auto x = 1e-4 * i * std::abs(i);
+    EXPECT_NEAR(vm::expm1(x), std::expm1(x), 1e-15 * std::fabs(std::expm1(x)));
+  }
+  for (const auto x : {1e-300, 1e-17, -1e-17, 1e-8, -1e-8}) {
+    EXPECT_NEAR(vm::expm1(x), std::expm1(x), 1e-15 * std::fabs(x));
+  }
+  constexpr auto inf = std::numeric_limits<double>::infinity();
+  EXPECT_EQ(vm::expm1(0.0), 0.0);
+  EXPECT_EQ(vm::expm1(-1000.0), -1.0);
+  EXPECT_EQ(vm::expm1(1000.0), inf);
+  EXPECT_EQ(vm::expm1(-inf), -1.0);
+  EXPECT_TRUE(std::isnan(vm::expm1(std::nan(""))));
+}
+
+TEST(VectorMathTest, CbrtTest) {
+  for (int i = -3000; i <= 3000; ++i) {
+    const auto x = std::exp(0.2357 * i);
+    EXPECT_NEAR(vm::cbrt(x), std::cbrt(x), 1e-15 * std::cbrt(x));
+    EXPECT_NEAR(vm::cbrt(-x), -std::cbrt(x), 1e-15 * std::cbrt(x));
+  }
+  EXPECT_EQ(vm::cbrt(0.0), 0.0);
+  EXPECT_EQ(vm::cbrt(-8.0f), -2.0f);
+}
+
+TEST(VectorMathTest, AcosTest) {
+  for (int i = -1000; i <= 1000; ++i) {
+    const auto x = 0.001 * i;
+    EXPECT_NEAR(vm::acos(x), std::acos(x), 5e-16);
+    EXPECT_NEAR(vm::acos(static_cast<float>(x)),
+                std::acos(static_cast<float>(x)), 5e-7f);
+  }
+}
+
+TEST(VectorMathTest, SolveCubicTest) {
+  // (x - 1)(x - 2)(x - 3) = x^3 - 6x^2 + 11x - 6
+  double x0, x1, x2;
+  ASSERT_TRUE(vm::solve_cubic(-6.0, 11.0, -6.0, x0, x1, x2));
+  EXPECT_NEAR(x0, 1.0, 1e-12);
+  EXPECT_NEAR(x1, 2.0, 1e-12);
+  EXPECT_NEAR(x2, 3.0, 1e-12);
+
+  // (x + 2)(x - 0.5)(x - 4) = x^3 - 2.5x^2 - 7x + 4
+  ASSERT_TRUE(vm::solve_cubic(-2.5, -7.0, 4.0, x0, x1, x2));
+  EXPECT_NEAR(x0, -2.0, 1e-12);
+  EXPECT_NEAR(x1, 0.5, 1e-12);
+  EXPECT_NEAR(x2, 4.0, 1e-12);
+
+  // (x - 2)(x^2 + 1) = x^3 - 2x^2 + x - 2
+  ASSERT_FALSE(vm::solve_cubic(-2.0, 1.0, -2.0, x0, x1, x2));
+  EXPECT_NEAR(x0, 2.0, 1e-12);
+  EXPECT_EQ(x1, x0);
+  EXPECT_EQ(x2, x0);
+
+  // (x - 1)^3 = x^3 - 3x^2 + 3x - 1
+  ASSERT_FALSE(vm::solve_cubic(-3.0, 3.0, -1.0, x0, x1, x2));
+  EXPECT_NEAR(x0, 1.0, 1e-12);
+}
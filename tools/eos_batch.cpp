@@ -0,0 +1,506 @@
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <exception>
+#include <future>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include "eos/common/scratch_arena.hpp"
+#include "eos/cubic_eos/peng_robinson_eos.hpp"
+#include "eos/cubic_eos/soave_redlich_kwong_eos.hpp"
+#include "eos/cubic_eos/vapor_liquid_flash.hpp"
+#include "eos/parallel/thread_pool.hpp"
+#include "eos/viscosity/lucas_method.hpp"
+
+namespace {
+
+const char* usage =
+    "Usage: eos_batch [options] <input> <output>\n"
+    "\n"
+    "Evaluates properties of a pure component at (p [Pa], T [K]) rows.\n"
+    "\n"
+    "Options:\n"
+    "  --eos pr|srk          Cubic EoS (default: pr)\n"
+    "  --pc <Pa>             Critical pressure (required)\n"
+    "  --tc <K>              Critical temperature (required)\n"
+    "  --omega <->           Acentric factor (required)\n"
+    "  --zc, --mw, --dm, --q Parameters of Lucas' method for viscosity\n"
+    "  --properties <list>   Comma-separated list of z, lnphi, hres, sres,\n"
+    "                        visc, psat (default: z)\n"
+    "  --guess <method>      Initial guess of psat: wilson, lee-kesler,\n"
+    "                        fitted, curve (default: wilson)\n"
+    "  --binary              Read and write rows of native doubles instead\n"
+    "                        of CSV\n"
+    "  --threads <n>         Number of threads (default: hardware threads)\n"
+    "  --chunk <bytes>       Size of an input chunk (default: 1048576)\n";
+
+enum class property { z, lnphi, hres, sres, visc, psat };
+
+struct options {
+  std::string eos = "pr";
+  double pc = 0.0;
+  double tc = 0.0;
+  double omega = 0.0;
+  double zc = 0.0;
+  double mw = 0.0;
+  double dm = 0.0;
+  double q = 0.0;
+  std::vector<property> properties = {property::z};
+  eos::vapor_pressure_guess guess = eos::vapor_pressure_guess::wilson;
+  bool binary = false;
+  std::size_t threads = 0;
+  std::size_t chunk = 1 << 20;
+  std::string input;
+  std::string output;
+};
+
+std::vector<property> parse_properties(const std::string& s) {
+  static const std::map<std::string, property> names = {
+      {"z", property::z},       {"lnphi", property::lnphi},
+      {"hres", property::hres}, {"sres", property::sres},
+      {"visc", property::visc}, {"psat", property::psat}};
+  std::vector<property> x;
+  std::size_t first = 0;
+  while (first <= s.size()) {
+    const auto last = std::min(s.find(',', first), s.size());
+    const auto it = names.find(s.substr(first, last - first));
+    if (it == names.end()) {
+      throw std::invalid_argument("Error: unknown property in " + s);
+    }
+    x.push_back(it->second);
+    first = last + 1;
+  }
+  return x;
+}
+
+eos::vapor_pressure_guess parse_guess(const std::string& s) {
+  static const std::map<std::string, eos::vapor_pressure_guess> names = {
+      {"wilson", eos::vapor_pressure_guess::wilson},
+      {"lee-kesler", eos::vapor_pressure_guess::lee_kesler},
+      {"fitted", eos::vapor_pressure_guess::fitted_correlation},
+      {"curve", eos::vapor_pressure_guess::saturation_curve}};
+  const auto it = names.find(s);
+  if (it == names.end()) {
+    throw std::invalid_argument("Error: unknown initial guess " + s);
+  }
+  return it->second;
+}
+
+const char* property_name(property x) {
+  switch (x) {
+    case property::z:
+      return "z";
+    case property::lnphi:
+      return "lnphi";
+    case property::hres:
+      return "hres";
+    case property::sres:
+      return "sres";
+    case property::visc:
+      return "visc";
+    default:
+      return "psat";
+  }
+}
+
+options parse_options(int argc, char* argv[]) {
+  options opts;
+  bool has_pc = false, has_tc = false, has_omega = false;
+  std::vector<std::string> positional;
+  for (int i = 1; i < argc; ++i) {
+    const std::string arg = argv[i];
+    const auto value = [&]() -> std::string {
+      if (i + 1 >= argc) {
+        throw std::invalid_argument("Error: missing value of " + arg);
+      }
+      return argv[++i];
+    };
+    if (arg == "--eos") {
+      opts.eos = value();
+    } else if (arg == "--pc") {
+      opts.pc = std::stod(value());
+      has_pc = true;
+    } else if (arg == "--tc") {
+      opts.tc = std::stod(value());
+      has_tc = true;
+    } else if (arg == "--omega") {
+      opts.omega = std::stod(value());
+      has_omega = true;
+    } else if (arg == "--zc") {
+      opts.zc = std::stod(value());
+    } else if (arg == "--mw") {
+      opts.mw = std::stod(value());
+    } else if (arg == "--dm") {
+      opts.dm = std::stod(value());
+    } else if (arg == "--q") {
+      opts.q = std::stod(value());
+    } else if (arg == "--properties") {
+      opts.properties = parse_properties(value());
+    } else if (arg == "--guess") {
+      opts.guess = parse_guess(value());
+    } else if (arg == "--binary") {
+      opts.binary = true;
+    } else if (arg == "--threads") {
+      opts.threads = std::stoul(value());
+    } else if (arg == "--chunk") {
+      opts.chunk = std::max<std::size_t>(std::stoul(value()), 1);
+    } else if (!arg.empty() && arg[0] == '-') {
+      throw std::invalid_argument("Error: unknown option " + arg);
+    } else {
+      positional.push_back(arg);
+    }
+  }
+  if (!(has_pc && has_tc && has_omega) || positional.size() != 2) {
+    throw std::invalid_argument(usage);
+  }
+  if (opts.eos != "pr" && opts.eos != "srk") {
+    throw std::invalid_argument("Error: unknown EoS " + opts.eos);
+  }
+  opts.input = positional[0];
+  opts.output = positional[1];
+  return opts;
+}
+
+/// @brief Read-only memory map of a file
+class mapped_file {
+ public:
+  mapped_file(const std::string& path) : data_{nullptr}, size_{0} {
+    const auto fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+      throw std::system_error(errno, std::generic_category(), path);
+    }
+    struct stat st;
+    if (::fstat(fd, &st) != 0) {
+      ::close(fd);
+      throw std::system_error(errno, std::generic_category(), path);
+    }
+    size_ = static_cast<std::size_t>(st.st_size);
+    if (size_ > 0) {
+      data_ = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+      if (data_ == MAP_FAILED) {
+        ::close(fd);
+        throw std::system_error(errno, std::generic_category(), path);
+      }
+      ::madvise(data_, size_, MADV_SEQUENTIAL);
+    }
+    ::close(fd);
+  }
+
+  mapped_file(const mapped_file&) = delete;
+  mapped_file& operator=(const mapped_file&) = delete;
+
+  ~mapped_file() {
+    if (size_ > 0) {
+      ::munmap(data_, size_);
+    }
+  }
+
+  const char* data() const noexcept { return static_cast<const char*>(data_); }
+  std::size_t size() const noexcept { return size_; }
+
+ private:
+  void* data_;
+  std::size_t size_;
+};
+
+/// @brief Parses a number from a field which is not null-terminated
+bool parse_field(const char*& first, const char* last, double& x) {
+  while (first != last && (*first == ' ' || *first == '\t')) {
+    ++first;
+  }
+  char buf[64];
+  std::size_t n = 0;
+  while (first != last && *first != ',' && *first != ' ' && *first != '\t' &&
+         *first != '\r' && n + 1 < sizeof(buf)) {
+    buf[n++] = *first++;
+  }
+  buf[n] = '\0';
+  char* end;
+  x = std::strtod(buf, &end);
+  return n > 0 && end == buf + n;
+}
+
+/// @brief Chunk of rows processed by a worker thread
+struct chunk {
+  const char* first;
+  const char* last;
+  std::size_t rows = 0;
+  std::size_t skipped = 0;
+  long iterations = 0;  /// Iterations of vapor pressure
+  std::string csv;
+  std::vector<double> binary;
+};
+
+/// @brief Property evaluator of a pure component
+template <typename Eos>
+class evaluator {
+ public:
+  evaluator(const options& opts)
+      : opts_{opts},
+        eos_{opts.pc, opts.tc, opts.omega},
+        flash_{eos_},
+        lucas_{opts.pc, opts.tc, opts.zc, opts.mw, opts.dm, opts.q} {
+    switch (opts.guess) {
+      case eos::vapor_pressure_guess::fitted_correlation:
+        flash_.set_initial_guess(eos::fit_vapor_pressure_correlation(eos_));
+        break;
+      case eos::vapor_pressure_guess::saturation_curve:
+        flash_.set_initial_guess(eos::make_saturation_curve(eos_));
+        break;
+      default:
+        flash_.set_initial_guess(
+            {opts.guess, opts.pc, opts.tc, opts.omega});
+        break;
+    }
+  }
+
+  /// @brief Evaluates properties at a row
+  /// @param[in,out] iterations Count to which iterations of vapor pressure
+  /// are added
+  void evaluate(double p, double t, double* x,
+                long& iterations) const noexcept {
+    const auto state = eos_.create_isobaric_isothermal_state(p, t);
+    const auto z = state.zfactor(eos::root_selection::stable);
+    for (const auto prop : opts_.properties) {
+      switch (prop) {
+        case property::z:
+          *x++ = z;
+          break;
+        case property::lnphi:
+          *x++ = state.ln_fugacity_coeff(z);
+          break;
+        case property::hres:
+          *x++ = state.residual_enthalpy(z);
+          break;
+        case property::sres:
+          *x++ = state.residual_entropy(z);
+          break;
+        case property::visc:
+          *x++ = lucas_.viscosity_at_high_pressure(p, t);
+          break;
+        case property::psat:
+          *x++ = this->vapor_pressure(t, iterations);
+          break;
+      }
+    }
+  }
+
+ private:
+  double vapor_pressure(double t, long& iterations) const noexcept {
+    if (!(t < opts_.tc)) {
+      return std::numeric_limits<double>::quiet_NaN();
+    }
+    const auto [p, r] = flash_.vapor_pressure(t);
+    iterations += r.iter;
+    return r.error == eos::flash_iteration_error::success
+               ? p
+               : std::numeric_limits<double>::quiet_NaN();
+  }
+
+  const options& opts_;
+  Eos eos_;
+  eos::vapor_liquid_flash<Eos> flash_;
+  eos::lucas_method lucas_;
+};
+
+template <typename Eos>
+void process_csv(const evaluator<Eos>& e, std::size_t num_props, chunk& c) {
+  auto& arena = eos::thread_scratch_arena();
+  eos::scratch_arena::scope scope(arena);
+  const auto x = arena.allocate<double>(num_props);
+  char buf[32];
+  auto line = c.first;
+  while (line != c.last) {
+    const auto end = static_cast<const char*>(
+        std::memchr(line, '\n', static_cast<std::size_t>(c.last - line)));
+    const auto eol = end ? end : c.last;
+    auto it = line;
+    double p, t;
+    if (parse_field(it, eol, p) && it != eol && *it++ == ',' &&
+        parse_field(it, eol, t)) {
+      e.evaluate(p, t, x.data(), c.iterations);
+      c.csv.append(buf, std::snprintf(buf, sizeof(buf), "%.17g,%.17g", p, t));
+      for (const auto xi : x) {
+        c.csv.append(buf, std::snprintf(buf, sizeof(buf), ",%.17g", xi));
+      }
+      c.csv += '\n';
+      ++c.rows;
+    } else if (eol != line) {
+      ++c.skipped;
+    }
+    line = end ? end + 1 : c.last;
+  }
+}
+
+template <typename Eos>
+void process_binary(const evaluator<Eos>& e, std::size_t num_props,
+                    chunk& c) {
+  const auto n = static_cast<std::size_t>(c.last - c.first) /
+                 (2 * sizeof(double));
+  c.binary.resize(n * (num_props + 2));
+  auto x = c.binary.data();
+  for (std::size_t i = 0; i < n; ++i) {
+    double row[2];
+    std::memcpy(row, c.first + 2 * sizeof(double) * i, sizeof(row));
+    *x++ = row[0];
+    *x++ = row[1];
+    e.evaluate(row[0], row[1], x, c.iterations);
+    x += num_props;
+  }
+  c.rows = n;
+}
+
+/// @brief Submits a task to a thread pool
+/// @return Future which becomes ready when the task returns or throws
+template <typename Function>
+std::future<void> submit(eos::thread_pool& pool, Function&& f) {
+  auto task = std::make_shared<std::packaged_task<void()>>(
+      std::forward<Function>(f));
+  auto future = task->get_future();
+  pool.submit([task] { (*task)(); });
+  return future;
+}
+
+template <typename Eos>
+void run(const options& opts) {
+  const evaluator<Eos> e(opts);
+  const auto num_props = opts.properties.size();
+
+  const mapped_file input(opts.input);
+  const auto row_size = 2 * sizeof(double);
+  if (opts.binary && input.size() % row_size != 0) {
+    throw std::runtime_error("Error: truncated row at the end of " +
+                             opts.input);
+  }
+  std::FILE* out = std::fopen(opts.output.c_str(), opts.binary ? "wb" : "w");
+  if (!out) {
+    throw std::system_error(errno, std::generic_category(), opts.output);
+  }
+
+  if (!opts.binary) {
+    std::fputs("p,t", out);
+    for (const auto prop : opts.properties) {
+      std::fprintf(out, ",%s", property_name(prop));
+    }
+    std::fputc('\n', out);
+  }
+
+  // Chunks outlive the pool, whose destructor waits for running tasks
+  std::vector<chunk> chunks;
+  eos::thread_pool pool(opts.threads);
+  // The number of chunks in memory is bounded by twice the number of threads
+  const auto max_in_flight = 2 * pool.size();
+  chunks.resize(max_in_flight + 1);
+  std::deque<std::pair<std::future<void>, chunk*>> pending;
+  std::size_t rows = 0, skipped = 0, next = 0;
+  long iterations = 0;
+
+  const auto flush = [&] {
+    auto [f, c] = std::move(pending.front());
+    pending.pop_front();
+    f.get();
+    const auto ok =
+        opts.binary ? std::fwrite(c->binary.data(), sizeof(double),
+                                  c->binary.size(), out) == c->binary.size()
+                    : std::fwrite(c->csv.data(), 1, c->csv.size(), out) ==
+                          c->csv.size();
+    if (!ok) {
+      throw std::system_error(errno, std::generic_category(), opts.output);
+    }
+    rows += c->rows;
+    skipped += c->skipped;
+    iterations += c->iterations;
+  };
+
+  const auto start = std::chrono::steady_clock::now();
+  auto first = input.data();
+  const auto last = input.data() + input.size();
+  while (first != last) {
+    auto chunk_last = first + std::min<std::size_t>(
+                                  opts.chunk, static_cast<std::size_t>(
+                                                  last - first));
+    if (opts.binary) {
+      const auto n = static_cast<std::size_t>(chunk_last - first) / row_size;
+      chunk_last = first + std::max<std::size_t>(n, 1) * row_size;
+    } else {
+      while (chunk_last != last && chunk_last[-1] != '\n') {
+        ++chunk_last;
+      }
+    }
+
+    if (pending.size() == max_in_flight) {
+      flush();
+    }
+    auto& c = chunks[next++ % chunks.size()];
+    c.first = first;
+    c.last = chunk_last;
+    c.rows = 0;
+    c.skipped = 0;
+    c.iterations = 0;
+    c.csv.clear();
+    c.binary.clear();
+    pending.emplace_back(submit(pool, [&e, num_props, &c, &opts] {
+      if (opts.binary) {
+        process_binary(e, num_props, c);
+      } else {
+        process_csv(e, num_props, c);
+      }
+    }), &c);
+    first = chunk_last;
+  }
+  while (!pending.empty()) {
+    flush();
+  }
+  const auto elapsed = std::chrono::duration<double>(
+                           std::chrono::steady_clock::now() - start)
+                           .count();
+
+  // Also reports a failure of the header, which is not checked by itself
+  const auto failed = std::ferror(out) != 0;
+  if (std::fclose(out) != 0 || failed) {
+    throw std::system_error(errno, std::generic_category(), opts.output);
+  }
+
+  std::cerr << rows << " rows in " << elapsed << " s ("
+            << (elapsed > 0 ? rows / elapsed : 0.0) << " rows/s, "
+            << pool.size() << " threads)\n";
+  if (iterations > 0) {
+    std::cerr << iterations << " iterations of vapor pressure\n";
+  }
+  if (skipped > 0) {
+    std::cerr << skipped << " lines skipped\n";
+  }
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  try {
+    const auto opts = parse_options(argc, argv);
+    if (opts.eos == "srk") {
+      run<eos::soave_redlich_kwong_eos>(opts);
+    } else {
+      run<eos::peng_robinson_eos>(opts);
+    }
+  } catch (const std::exception& e) {
+    std::cerr << e.what() << '\n';
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,37 @@
+#include <csignal>
+#include <exception>
+#include <iostream>
+
+#include "eos/server/property_server.hpp"
+
+namespace {
+
+eos::property_server* server = nullptr;
+
+void handle_signal(int) {
+  if (server) {
+    server->stop();
+  }
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  if (argc != 2) {
+    std::cerr << "Usage: " << argv[0] << " <socket path>\n";
+    return 1;
+  }
+
+  try {
+    eos::property_server s(argv[1]);
+    server = &s;
+    std::signal(SIGINT, handle_signal);
+    std::signal(SIGTERM, handle_signal);
+    s.run();
+    server = nullptr;
+  } catch (const std::exception& e) {
+    std::cerr << e.what() << '\n';
+    return 1;
+  }
+  return 0;
+}